@@ -0,0 +1,106 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include "driver/gptimer.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+unsigned int esp_host_log_error_count = 0;
+
+const esp_host_heap_hooks_t *esp_host_heap_hooks = NULL;
+
+void esp_host_heap_set_hooks(const esp_host_heap_hooks_t *hooks) {
+    esp_host_heap_hooks = hooks;
+}
+
+struct gptimer_t {
+    uint32_t resolution_hz;
+    bool enabled;
+    bool running;
+    uint64_t elapsed_ns;                                                            // Time accumulated before the current start
+    uint64_t start_ns;                                                              // Monotonic timestamp of the current start
+};
+
+static uint64_t host_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t ns_to_ticks(const struct gptimer_t *timer, uint64_t ns) {
+    return ns * timer->resolution_hz / 1000000000ull;
+}
+
+static uint64_t ticks_to_ns(const struct gptimer_t *timer, uint64_t ticks) {
+    return ticks * 1000000000ull / timer->resolution_hz;
+}
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *config, gptimer_handle_t *ret_timer) {
+    if (!config || !ret_timer || config->resolution_hz == 0) { return ESP_ERR_INVALID_ARG;}
+    struct gptimer_t *timer = calloc(1, sizeof(struct gptimer_t));
+    if (!timer) { return ESP_ERR_NO_MEM;}
+    timer->resolution_hz = config->resolution_hz;
+    *ret_timer = timer;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_del_timer(gptimer_handle_t timer) {
+    if (!timer) { return ESP_ERR_INVALID_ARG;}
+    if (timer->enabled) { return ESP_ERR_INVALID_STATE;}
+    free(timer);
+    return ESP_OK;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t timer) {
+    if (!timer) { return ESP_ERR_INVALID_ARG;}
+    if (timer->enabled) { return ESP_ERR_INVALID_STATE;}
+    timer->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_disable(gptimer_handle_t timer) {
+    if (!timer) { return ESP_ERR_INVALID_ARG;}
+    if (!timer->enabled || timer->running) { return ESP_ERR_INVALID_STATE;}
+    timer->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_start(gptimer_handle_t timer) {
+    if (!timer) { return ESP_ERR_INVALID_ARG;}
+    if (!timer->enabled || timer->running) { return ESP_ERR_INVALID_STATE;}
+    timer->start_ns = host_now_ns();
+    timer->running = true;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_stop(gptimer_handle_t timer) {
+    if (!timer) { return ESP_ERR_INVALID_ARG;}
+    if (!timer->running) { return ESP_ERR_INVALID_STATE;}
+    timer->elapsed_ns += host_now_ns() - timer->start_ns;
+    timer->running = false;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_get_raw_count(gptimer_handle_t timer, uint64_t *value) {
+    if (!timer || !value) { return ESP_ERR_INVALID_ARG;}
+    uint64_t elapsed = timer->elapsed_ns;
+    if (timer->running) {
+        elapsed += host_now_ns() - timer->start_ns;
+    }
+    *value = ns_to_ticks(timer, elapsed);
+    return ESP_OK;
+}
+
+esp_err_t gptimer_set_raw_count(gptimer_handle_t timer, uint64_t value) {
+    if (!timer) { return ESP_ERR_INVALID_ARG;}
+    // Host kernels often finish within a single 1 MHz tick. The sub-tick remainder is carried over
+    // so totals accumulated by the test suite across many short intervals stay meaningful.
+    uint64_t remainder = timer->elapsed_ns - ticks_to_ns(timer, ns_to_ticks(timer, timer->elapsed_ns));
+    timer->elapsed_ns = ticks_to_ns(timer, value) + remainder;
+    if (timer->running) {
+        timer->start_ns = host_now_ns();
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,40 @@
+#ifndef DRIVER_GPTIMER_H
+#define DRIVER_GPTIMER_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+/**
+ * Host stand-in for ESP-IDF's general purpose timer driver, backed by CLOCK_MONOTONIC.
+ *
+ * Only the calls used by the esp_simd test suite are provided. The raw count advances at
+ * resolution_hz like the hardware timer, so logged runtimes keep their units on the host.
+ */
+
+typedef enum {
+    GPTIMER_CLK_SRC_DEFAULT = 0,
+} gptimer_clock_source_t;
+
+typedef enum {
+    GPTIMER_COUNT_DOWN = 0,
+    GPTIMER_COUNT_UP = 1,
+} gptimer_count_direction_t;
+
+typedef struct {
+    gptimer_clock_source_t clk_src;
+    gptimer_count_direction_t direction;
+    uint32_t resolution_hz;
+} gptimer_config_t;
+
+typedef struct gptimer_t *gptimer_handle_t;
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *config, gptimer_handle_t *ret_timer);
+esp_err_t gptimer_del_timer(gptimer_handle_t timer);
+esp_err_t gptimer_enable(gptimer_handle_t timer);
+esp_err_t gptimer_disable(gptimer_handle_t timer);
+esp_err_t gptimer_start(gptimer_handle_t timer);
+esp_err_t gptimer_stop(gptimer_handle_t timer);
+esp_err_t gptimer_get_raw_count(gptimer_handle_t timer, uint64_t *value);
+esp_err_t gptimer_set_raw_count(gptimer_handle_t timer, uint64_t value);
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Host stand-in for ESP-IDF's esp_heap_caps.h.
+ *
+ * Capability flags keep their ESP-IDF values. By default they are ignored and every allocation comes
+ * from the host heap. A test or benchmark can install esp_host_heap_hooks_t to route allocations
+ * through its own allocator, e.g. one that models a small internal SRAM backed by a larger PSRAM,
+ * so placement policies can be exercised off target. esp_memory_utils.h asks the same hooks where
+ * a pointer lives.
+ */
+
+#define MALLOC_CAP_EXEC             (1 << 0)
+#define MALLOC_CAP_32BIT            (1 << 1)
+#define MALLOC_CAP_8BIT             (1 << 2)
+#define MALLOC_CAP_DMA              (1 << 3)
+#define MALLOC_CAP_SPIRAM           (1 << 10)
+#define MALLOC_CAP_INTERNAL         (1 << 11)
+#define MALLOC_CAP_DEFAULT          (1 << 12)
+
+typedef struct {
+    void *(*aligned_alloc)(size_t alignment, size_t size, uint32_t caps, void *ctx);    // NULL on failure, as heap_caps_aligned_alloc()
+    void (*free)(void *ptr, void *ctx);
+    uint32_t (*get_caps)(const void *ptr, void *ctx);                                   // MALLOC_CAP_* of the memory holding ptr
+    void *ctx;
+} esp_host_heap_hooks_t;
+
+extern const esp_host_heap_hooks_t *esp_host_heap_hooks;
+
+/**
+ * Install @p hooks for every later heap_caps_* call, or restore the plain host heap with NULL.
+ * Memory must be freed under the hooks it was allocated with.
+ */
+void esp_host_heap_set_hooks(const esp_host_heap_hooks_t *hooks);
+
+static inline void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    if (size == 0) { return NULL;}                                                  // Matches heap_caps_malloc(0)
+    if (esp_host_heap_hooks) { return esp_host_heap_hooks->aligned_alloc(alignment, size, caps, esp_host_heap_hooks->ctx);}
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, alignment < sizeof(void *) ? sizeof(void *) : alignment, size) != 0) { return NULL;}
+    return ptr;
+}
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps) {
+    if (size == 0) { return NULL;}
+    if (esp_host_heap_hooks) { return esp_host_heap_hooks->aligned_alloc(16, size, caps, esp_host_heap_hooks->ctx);}
+    return malloc(size);
+}
+
+static inline void heap_caps_free(void *ptr) {
+    if (esp_host_heap_hooks) {
+        if (ptr) { esp_host_heap_hooks->free(ptr, esp_host_heap_hooks->ctx);}
+        return;
+    }
+    free(ptr);
+}
+
+#endif
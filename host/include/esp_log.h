@@ -0,0 +1,24 @@
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+#include <stdio.h>
+
+/**
+ * Host stand-in for ESP-IDF's esp_log.h.
+ *
+ * Messages are written to stdout/stderr. Error-level messages are also counted so a host test
+ * runner can fail when a check only logs instead of asserting.
+ */
+
+extern unsigned int esp_host_log_error_count;
+
+#define ESP_LOGE(tag, format, ...) do {                                             \
+        esp_host_log_error_count++;                                                 \
+        fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__);                 \
+    } while (0)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) fprintf(stdout, "I (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) do { } while (0)
+#define ESP_LOGV(tag, format, ...) do { } while (0)
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef ESP_MEMORY_UTILS_H
+#define ESP_MEMORY_UTILS_H
+
+#include <stdbool.h>
+#include "esp_heap_caps.h"
+
+/**
+ * Host stand-in for ESP-IDF's esp_memory_utils.h.
+ *
+ * Placement is whatever the installed esp_host_heap_hooks_t reports; without hooks the host heap is
+ * treated as DMA-capable internal RAM.
+ */
+
+static inline uint32_t esp_host_ptr_caps(const void *ptr) {
+    if (esp_host_heap_hooks) { return esp_host_heap_hooks->get_caps(ptr, esp_host_heap_hooks->ctx);}
+    return MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT | MALLOC_CAP_32BIT;
+}
+
+static inline bool esp_ptr_internal(const void *ptr) {
+    return (esp_host_ptr_caps(ptr) & MALLOC_CAP_INTERNAL) != 0;
+}
+
+static inline bool esp_ptr_external_ram(const void *ptr) {
+    return (esp_host_ptr_caps(ptr) & MALLOC_CAP_SPIRAM) != 0;
+}
+
+static inline bool esp_ptr_dma_capable(const void *ptr) {
+    return (esp_host_ptr_caps(ptr) & MALLOC_CAP_DMA) != 0;
+}
+
+#endif
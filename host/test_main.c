@@ -0,0 +1,208 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "vector.h"
+#include "vector_basic_test.h"
+#include "vector_bitwise_test.h"
+#include "vector_compare_test.h"
+#include "vector_dispatch_test.h"
+#include "vector_expr_test.h"
+#include "vector_arena_test.h"
+#include "vector_placement_test.h"
+#include "vector_unaligned_test.h"
+#include "vector_view_test.h"
+#include "vector_parallel_test.h"
+#include "vector_stream_test.h"
+#include "vector_pingpong_test.h"
+#include "vector_filter_test.h"
+#include "vector_fft_test.h"
+#include "matrix_test.h"
+#include "tensor_test.h"
+#include "esp_log.h"
+
+/**
+ * Host runner for the correctness suite in test/. Every test compares the library against the
+ * scalar references and reports mismatches through ESP_LOGE, so the run fails if any error was logged.
+ * Pass -v to print the vector and scalar timings of each test.
+ */
+
+static const dtype int_types[] = { DTYPE_INT8, DTYPE_INT16, DTYPE_INT32 };
+static const dtype all_types[] = { DTYPE_INT8, DTYPE_INT16, DTYPE_INT32, DTYPE_FLOAT32 };
+static const dtype uint_types[] = { DTYPE_UINT8, DTYPE_UINT16, DTYPE_UINT32 };
+
+static const dtype gemm_types[] = { DTYPE_INT8, DTYPE_INT16, DTYPE_FLOAT32 };
+
+#define NUM_INT_TYPES (sizeof(int_types) / sizeof(int_types[0]))
+#define NUM_ALL_TYPES (sizeof(all_types) / sizeof(all_types[0]))
+#define NUM_UINT_TYPES (sizeof(uint_types) / sizeof(uint_types[0]))
+#define NUM_GEMM_TYPES (sizeof(gemm_types) / sizeof(gemm_types[0]))
+
+static void run_int_tests(bool verbose, dtype type) {
+    vector_test_add_scalar(verbose, type);
+    vector_test_add_scalar_alias(verbose, type);
+    vector_test_sum(verbose, type);
+    vector_test_sum_i64(verbose, type);
+    vector_test_mul_shift(verbose, type);
+    vector_test_mul_shift_alias(verbose, type);
+    vector_test_dotp(verbose, type);
+    vector_test_dotp_i64(verbose, type);
+    vector_test_ceil(verbose, type);
+    vector_test_floor(verbose, type);
+    vector_test_mac(verbose, type);
+    vector_test_mac_i64(verbose, type);
+    vector_test_fill(verbose, type);
+    vector_test_and(verbose, type);
+    vector_test_and_alias(verbose, type);
+    vector_test_xor(verbose, type);
+    vector_test_xor_alias(verbose, type);
+    vector_test_or(verbose, type);
+    vector_test_or_alias(verbose, type);
+    vector_test_not(verbose, type);
+}
+
+static void run_compare_tests(bool verbose, dtype type) {
+    vector_test_max(verbose, type);
+    vector_test_min(verbose, type);
+    vector_test_gt(verbose, type);
+    vector_test_lt(verbose, type);
+    vector_test_eq(verbose, type);
+    vector_test_ge(verbose, type);
+    vector_test_le(verbose, type);
+    vector_test_ne(verbose, type);
+}
+
+static void run_uint_tests(bool verbose, dtype type) {
+    vector_test_add(verbose, type);
+    vector_test_add_alias(verbose, type);
+    vector_test_sub(verbose, type);
+    vector_test_sub_alias(verbose, type);
+    vector_test_mul_shift(verbose, type);
+    vector_test_mul_shift_alias(verbose, type);
+    vector_test_fma(verbose, type);
+    vector_test_sum_unsigned(verbose, type);
+    vector_test_copy(verbose, type);
+    vector_test_prepared_binary(verbose, type);
+    vector_test_prepared_unary(verbose, type);
+}
+
+static void run_f32_tests(bool verbose) {
+    vector_test_add_scalar_f32(verbose, DTYPE_FLOAT32);
+    vector_test_add_scalar_f32_alias(verbose, DTYPE_FLOAT32);
+    vector_test_sum_f32(verbose, DTYPE_FLOAT32);
+    vector_test_dotp_f32(verbose, DTYPE_FLOAT32);
+    vector_test_ceil_f32(verbose, DTYPE_FLOAT32);
+    vector_test_floor_f32(verbose, DTYPE_FLOAT32);
+    vector_test_mac_f32(verbose, DTYPE_FLOAT32);
+    vector_test_fill_f32(verbose, DTYPE_FLOAT32);
+}
+
+static void run_common_tests(bool verbose, dtype type) {
+    vector_test_add(verbose, type);
+    vector_test_add_alias(verbose, type);
+    vector_test_sub(verbose, type);
+    vector_test_sub_alias(verbose, type);
+    vector_test_mul_scalar_shift(verbose, type);
+    vector_test_fma(verbose, type);
+    vector_test_abs(verbose, type);
+    vector_test_neg(verbose, type);
+    vector_test_zeros(verbose, type);
+    vector_test_ones(verbose, type);
+    vector_test_copy(verbose, type);
+    vector_test_prepared_binary(verbose, type);
+    vector_test_prepared_unary(verbose, type);
+    vector_bench_dispatch(verbose, type);
+}
+
+int main(int argc, char **argv) {
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) { verbose = true;}
+    }
+
+    for (size_t i = 0; i < NUM_ALL_TYPES; i++) {
+        run_common_tests(verbose, all_types[i]);
+    }
+    for (size_t i = 0; i < NUM_INT_TYPES; i++) {
+        run_int_tests(verbose, int_types[i]);
+    }
+    run_f32_tests(verbose);
+    for (size_t i = 0; i < NUM_UINT_TYPES; i++) {
+        run_uint_tests(verbose, uint_types[i]);
+    }
+    for (size_t i = 0; i < NUM_INT_TYPES; i++) {
+        run_compare_tests(verbose, int_types[i]);
+    }
+    for (size_t i = 0; i < NUM_UINT_TYPES; i++) {
+        run_compare_tests(verbose, uint_types[i]);
+    }
+    run_compare_tests(verbose, DTYPE_FLOAT32);
+
+    for (size_t i = 0; i < NUM_GEMM_TYPES; i++) {
+        matrix_test_mul(verbose, gemm_types[i]);
+        matrix_test_mul_bt(verbose, gemm_types[i]);
+    }
+    for (size_t i = 0; i < NUM_INT_TYPES; i++) {
+        matrix_test_gemv(verbose, int_types[i]);
+    }
+
+    for (size_t i = 0; i < NUM_ALL_TYPES; i++) {
+        tensor_test_broadcast(verbose, all_types[i]);
+        tensor_test_views(verbose, all_types[i]);
+    }
+
+    for (size_t i = 0; i < NUM_ALL_TYPES; i++) {
+        vector_test_expr_eval(verbose, all_types[i]);
+        vector_test_expr_reduce(verbose, all_types[i]);
+        vector_test_expr_errors(verbose, all_types[i]);
+    }
+    for (size_t i = 0; i < NUM_ALL_TYPES; i++) {
+        vector_test_arena(verbose, all_types[i]);
+        vector_test_pool(verbose, all_types[i]);
+        vector_test_placement(verbose, all_types[i]);
+        vector_test_unaligned(verbose, all_types[i]);
+        vector_test_view(verbose, all_types[i]);
+        vector_test_parallel(verbose, all_types[i]);
+        vector_test_stream(verbose, all_types[i]);
+        vector_test_pingpong(verbose, all_types[i]);
+        vector_test_fir(verbose, all_types[i]);
+        vector_test_biquad(verbose, all_types[i]);
+        vector_test_fft(verbose, all_types[i]);
+        vector_test_xcorr(verbose, all_types[i]);
+    }
+    for (size_t i = 0; i < NUM_UINT_TYPES; i++) {
+        vector_test_arena(verbose, uint_types[i]);
+        vector_test_pool(verbose, uint_types[i]);
+        vector_test_unaligned(verbose, uint_types[i]);
+        vector_test_view(verbose, uint_types[i]);
+        vector_test_parallel(verbose, uint_types[i]);
+        vector_test_stream(verbose, uint_types[i]);
+        vector_test_pingpong(verbose, uint_types[i]);
+    }
+    vector_bench_parallel(verbose, DTYPE_INT16);
+    vector_bench_parallel(verbose, DTYPE_FLOAT32);
+
+    vector_test_convert(verbose, DTYPE_INT8, DTYPE_INT16);
+    vector_test_convert(verbose, DTYPE_INT8, DTYPE_INT32);
+    vector_test_convert(verbose, DTYPE_INT16, DTYPE_INT32);
+    vector_test_convert(verbose, DTYPE_INT16, DTYPE_INT8);
+    vector_test_convert(verbose, DTYPE_INT32, DTYPE_INT8);
+    vector_test_convert(verbose, DTYPE_INT32, DTYPE_INT16);
+    vector_test_convert_shift(verbose, DTYPE_INT16, DTYPE_INT8);
+    vector_test_convert_shift(verbose, DTYPE_INT32, DTYPE_INT8);
+    vector_test_convert_shift(verbose, DTYPE_INT32, DTYPE_INT16);
+    vector_test_convert(verbose, DTYPE_INT8, DTYPE_FLOAT32);
+    vector_test_convert(verbose, DTYPE_INT16, DTYPE_FLOAT32);
+    vector_test_convert(verbose, DTYPE_FLOAT32, DTYPE_INT8);
+    vector_test_convert(verbose, DTYPE_FLOAT32, DTYPE_INT16);
+    vector_test_quantize(verbose, DTYPE_INT8);
+    vector_test_quantize(verbose, DTYPE_INT16);
+    vector_test_dequantize(verbose, DTYPE_INT8);
+    vector_test_dequantize(verbose, DTYPE_INT16);
+
+    if (esp_host_log_error_count) {
+        fprintf(stderr, "esp_simd_test: %u error(s) logged\n", esp_host_log_error_count);
+        return 1;
+    }
+    printf("esp_simd_test: all tests passed\n");
+    return 0;
+}
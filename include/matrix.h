@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Represents a row-major 2-D array of elements with a specified data type intended for SIMD operations.
+ *
+ * Follows the same rules as vector_t: the data must be 128-bit aligned, and the row stride is
+ * padded so that every row also starts on a 16-byte boundary. Each row can therefore be handed
+ * to the simd_* kernels directly. Padding elements past @p cols are never read or written.
+ */
+typedef struct {
+    void *data;             // Pointer to the first row *data must be 128-bit aligned*
+    dtype type;             // Data type of the elements in the matrix_t
+    size_t rows;            // Number of rows
+    size_t cols;            // Number of valid elements per row
+    size_t stride;          // Elements between the starts of consecutive rows; stride * sizeof_dtype(type) is a multiple of 16
+    bool owns_data;         // Indicates if the matrix_t owns the data (true if allocated with heap_caps_aligned_alloc)
+} matrix_t;
+
+/**
+ * @brief Smallest row stride (in elements) for @p cols elements of @p type that keeps every row 16-byte aligned.
+ *
+ * @param cols  Number of elements per row.
+ * @param type  Element dtype.
+ * @return Stride in elements, or 0 for an invalid dtype.
+ */
+static inline size_t matrix_min_stride(size_t cols, dtype type) {
+    size_t elem = sizeof_dtype(type);
+    if (!elem) { return 0;}
+    size_t row_bytes = (cols * elem + 15) & ~(size_t)15;
+    return row_bytes / elem;
+}
+
+/**
+ * @brief Create a heap-allocated matrix with 16-byte aligned, padded rows.
+ *
+ * Allocates a matrix_t and its data buffer for @p rows x @p cols elements of @p type, with the
+ * stride given by ::matrix_min_stride(). Padding elements are zeroed.
+ *
+ * @param rows  Number of rows.
+ * @param cols  Number of elements per row.
+ * @param type  Element dtype (DTYPE_INT8/INT16/INT32/FLOAT32/UINT8/UINT16/UINT32).
+ * @return Pointer to a newly created matrix_t on success, or NULL on allocation failure.
+ *
+ * @note The returned matrix owns its data (owns_data = true).
+ * @warning Returns NULL when rows == 0 or cols == 0
+ */
+matrix_t *matrix_create(size_t rows, size_t cols, dtype type);
+
+/**
+ * @brief Validate a matrix_t instance and its storage.
+ *
+ * Verifies non-NULL matrix and data, supported dtype, 16-byte alignment of the data and row stride.
+ *
+ * @param mat  Matrix to check.
+ * @retval VECTOR_SUCCESS           Matrix is valid.
+ * @retval VECTOR_NULL              @p mat is NULL or @p mat->data is NULL.
+ * @retval VECTOR_UNALIGNED_DATA    @p mat->data or a row start is not 16-byte aligned.
+ * @retval VECTOR_SIZE_MISMATCH     @p mat->stride is smaller than @p mat->cols.
+ * @retval VECTOR_TYPE_MISMATCH     @p mat->type is invalid/unsupported.
+ */
+vector_status_t matrix_ok(const matrix_t *mat);
+
+/**
+ * @brief Frees the data buffer of a matrix_t if owns_data is true
+ *
+ * @param mat  Matrix pointer (may be NULL).
+ * @retval VECTOR_SUCCESS  Always.
+ */
+vector_status_t matrix_free_data(matrix_t *mat);
+
+/**
+ * @brief Destroy a matrix_t and optionally its data buffer.
+ *
+ * If @p mat->owns_data is true, frees the data buffer. Always frees the matrix container.
+ *
+ * @param mat  Matrix to destroy (may be NULL).
+ * @retval VECTOR_SUCCESS  Always.
+ */
+vector_status_t matrix_destroy(matrix_t *mat);
+
+/**
+ * @brief Set data pointer and metadata of a matrix_t.
+ *
+ * @param mat       Pointer to the matrix_t to initialize.
+ * @param data      Pointer to the data buffer (must be 16-byte aligned).
+ * @param rows      Number of rows.
+ * @param cols      Number of elements per row.
+ * @param stride    Elements between row starts; at least @p cols, and stride * sizeof_dtype(type) a multiple of 16.
+ * @param type      Data type of the elements.
+ * @param owns_data Boolean indicating if the matrix owns the data buffer.
+ * @retval VECTOR_SUCCESS           Matrix initialized successfully.
+ * @retval VECTOR_NULL              @p mat or @p data is NULL.
+ * @retval VECTOR_UNALIGNED_DATA    @p data or the row stride breaks 16-byte alignment.
+ * @retval VECTOR_SIZE_MISMATCH     @p stride < @p cols.
+ * @retval VECTOR_TYPE_MISMATCH     Invalid dtype.
+ */
+vector_status_t matrix_set(matrix_t *mat, void *data, size_t rows, size_t cols, size_t stride, dtype type, bool owns_data);
+
+/**
+ * @brief Zero-copy vector view of one matrix row.
+ *
+ * @param mat  Source matrix.
+ * @param row  Row index.
+ * @param out  Receives a non-owning vector_t of @p mat->cols elements aliasing the row.
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p mat or @p out is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p row is out of range.
+ */
+vector_status_t matrix_row(const matrix_t *mat, size_t row, vector_t *out);
+
+#ifdef __cplusplus
+}
+#endif
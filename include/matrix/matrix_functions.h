@@ -0,0 +1,106 @@
+#ifndef MATRIX_FUNCTIONS_H
+#define MATRIX_FUNCTIONS_H
+
+#include "matrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Matrix multiply, @p result = @p a x @p b.
+ *
+ * Blocked GEMM built on the SIMD dot-product kernels (ee.vmulas.s8/s16.accx for integer inputs).
+ * Column panels of @p b are packed once into a transposed, 16-byte aligned scratch buffer, so
+ * the strided columns of @p b are gathered once instead of once per output row. Each packed panel
+ * is then used by every row of @p a, with the K dimension split into blocks. FLOAT32 outputs are
+ * computed in 2 x 2 blocks that load each row segment once for two outputs.
+ *
+ * Supported dtype combinations:
+ *  - INT8  x INT8  -> INT32
+ *  - INT16 x INT16 -> INT32
+ *  - FLOAT32 x FLOAT32 -> FLOAT32
+ *
+ * @param a       Left operand, M x K.
+ * @param b       Right operand, K x N.
+ * @param result  Output, M x N. Must not alias @p a or @p b.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_SIZE_MISMATCH         @p a->cols != @p b->rows, or @p result is not M x N.
+ * @retval VECTOR_TYPE_MISMATCH         Dtypes are not one of the supported combinations.
+ * @retval VECTOR_UNSUPPORTED_OPERATION INT32 or unsigned inputs.
+ * @retval VECTOR_ERROR                 Scratch allocation failed.
+ *
+ * @note Integer accumulation wraps in 32 bits, as ::vec_dotp does.
+ * @note FLOAT32 partial sums are formed per K block and summed in order of k, so rounding may differ slightly from a single ::vec_dotp_f32.
+ * @note Recommend ::matrix_ok() on all operands.
+ */
+vector_status_t mat_mul(const matrix_t *a, const matrix_t *b, matrix_t *result);
+
+/**
+ * @brief Matrix multiply with a pre-transposed right operand, @p result = @p a x @p bt^T.
+ *
+ * Same as ::mat_mul() but takes the right operand already transposed (N x K), which is the
+ * natural [out][in] layout of dense-layer weights. No packing or scratch memory is needed.
+ *
+ * @param a       Left operand, M x K.
+ * @param bt      Transposed right operand, N x K.
+ * @param result  Output, M x N. Must not alias @p a or @p bt.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_SIZE_MISMATCH         @p a->cols != @p bt->cols, or @p result is not M x N.
+ * @retval VECTOR_TYPE_MISMATCH         Dtypes are not one of the supported combinations.
+ * @retval VECTOR_UNSUPPORTED_OPERATION INT32 or unsigned inputs.
+ */
+vector_status_t mat_mul_bt(const matrix_t *a, const matrix_t *bt, matrix_t *result);
+
+/**
+ * @brief Matrix-vector product, @p result = @p weights x @p input.
+ *
+ * The inner loop of a fully connected layer: INT8 weights (one output per row) times an INT8
+ * input vector, accumulated in 32 bits. All rows are reduced in a single kernel call, so the
+ * entry and tail overhead of a per-row ::vec_dotp is paid once per matrix.
+ *
+ * @param weights  INT8 matrix, N x K.
+ * @param input    INT8 vector of K elements.
+ * @param result   INT32 vector of N elements.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_SIZE_MISMATCH         @p input->size != @p weights->cols, or @p result->size != @p weights->rows.
+ * @retval VECTOR_TYPE_MISMATCH         @p input is not INT8 or @p result is not INT32.
+ * @retval VECTOR_UNSUPPORTED_OPERATION @p weights is not INT8.
+ *
+ * @note Accumulation wraps in 32 bits, as ::vec_dotp does.
+ * @note Recommend ::matrix_ok() and ::vector_ok() on all operands.
+ */
+vector_status_t vec_gemv(const matrix_t *weights, const vector_t *input, vector_t *result);
+
+/**
+ * @brief Matrix-vector product with bias and requantization, fused in the same pass.
+ *
+ * Computes result[r] = sat((Σ weights[r][i] * input[i] + bias[r]) >> @p shift_amount), where the
+ * shift is arithmetic (rounds toward negative infinity) and sat() saturates to the dtype of @p result.
+ * Each row is requantized as soon as its dot product is done, in the same kernel call, so no INT32
+ * intermediate is written for INT8/INT16 outputs.
+ *
+ * @param weights       INT8 matrix, N x K.
+ * @param input         INT8 vector of K elements.
+ * @param bias          INT32 vector of N elements, or NULL for no bias.
+ * @param result        INT8, INT16 or INT32 vector of N elements.
+ * @param shift_amount  Right shift applied after the bias add (0..31).
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_SIZE_MISMATCH         Operand sizes do not match @p weights.
+ * @retval VECTOR_TYPE_MISMATCH         @p input is not INT8, @p bias is not INT32, or @p result is FLOAT32.
+ * @retval VECTOR_UNSUPPORTED_OPERATION @p weights is not INT8.
+ * @retval VECTOR_INVALID_ARGUMENT      @p shift_amount > 31.
+ *
+ * @note The bias is added to the wrapped 32-bit dot product in 64 bits, so the bias add itself does not overflow.
+ */
+vector_status_t vec_gemv_requant(const matrix_t *weights, const vector_t *input, const vector_t *bias, vector_t *result, unsigned int shift_amount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TENSOR_MAX_DIMS 4   // Maximum number of axes of a tensor_t
+
+/**
+ * @brief Represents an N-D (1 to TENSOR_MAX_DIMS axes) array of elements with explicit strides.
+ *
+ * Axes are ordered outermost first, so an HWC activation has shape {H, W, C}. Strides are in
+ * elements, which lets a tensor_t describe a zero-copy view (slice, reshape) of a vector_t or of
+ * another tensor. A tensor created with ::tensor_create() is contiguous and 128-bit aligned; views
+ * need not be, and the tensor_* operations fall back to a small aligned scratch buffer for runs
+ * the simd_* kernels cannot take directly.
+ */
+typedef struct {
+    void *data;                         // Pointer to the first element
+    dtype type;                         // Data type of the elements in the tensor_t
+    size_t ndim;                        // Number of axes, 1..TENSOR_MAX_DIMS
+    size_t shape[TENSOR_MAX_DIMS];      // Extent of each axis; entries past ndim are 1
+    size_t strides[TENSOR_MAX_DIMS];    // Elements between neighbours along each axis; entries past ndim are 0
+    bool owns_data;                     // Indicates if the tensor_t owns the data (true if allocated with heap_caps_aligned_alloc)
+} tensor_t;
+
+/**
+ * @brief Number of elements in a tensor.
+ *
+ * @param tensor  Tensor.
+ * @return Product of the extents of all axes.
+ */
+static inline size_t tensor_numel(const tensor_t *tensor) {
+    size_t n = 1;
+    for (size_t i = 0; i < tensor->ndim; i++) {
+        n *= tensor->shape[i];
+    }
+    return n;
+}
+
+/**
+ * @brief Create a heap-allocated, contiguous tensor.
+ *
+ * Allocates a tensor_t and a zeroed, 128-bit aligned data buffer of the product of @p shape elements,
+ * with row-major (C order) strides.
+ *
+ * @param ndim   Number of axes, 1..TENSOR_MAX_DIMS.
+ * @param shape  Extent of each axis, outermost first.
+ * @param type   Element dtype (DTYPE_INT8/INT16/INT32/FLOAT32/UINT8/UINT16/UINT32).
+ * @return Pointer to a newly created tensor_t on success, or NULL on allocation failure.
+ *
+ * @note The returned tensor owns its data (owns_data = true).
+ * @warning Returns NULL when ndim is out of range or any extent is 0.
+ */
+tensor_t *tensor_create(size_t ndim, const size_t *shape, dtype type);
+
+/**
+ * @brief Validate a tensor_t instance.
+ *
+ * Verifies non-NULL tensor and data, supported dtype, axis count and non-zero extents.
+ * Alignment is not required, since views may start anywhere in a buffer.
+ *
+ * @param tensor  Tensor to check.
+ * @retval VECTOR_SUCCESS           Tensor is valid.
+ * @retval VECTOR_NULL              @p tensor is NULL or @p tensor->data is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p tensor->ndim is out of range.
+ * @retval VECTOR_SIZE_MISMATCH     An extent is 0.
+ * @retval VECTOR_TYPE_MISMATCH     @p tensor->type is invalid/unsupported.
+ */
+vector_status_t tensor_ok(const tensor_t *tensor);
+
+/**
+ * @brief Frees the data buffer of a tensor_t if owns_data is true
+ *
+ * @param tensor  Tensor pointer (may be NULL).
+ * @retval VECTOR_SUCCESS  Always.
+ */
+vector_status_t tensor_free_data(tensor_t *tensor);
+
+/**
+ * @brief Destroy a tensor_t and optionally its data buffer.
+ *
+ * If @p tensor->owns_data is true, frees the data buffer. Always frees the tensor container.
+ *
+ * @param tensor  Tensor to destroy (may be NULL).
+ * @retval VECTOR_SUCCESS  Always.
+ */
+vector_status_t tensor_destroy(tensor_t *tensor);
+
+/**
+ * @brief Zero-copy contiguous tensor view of a vector's buffer.
+ *
+ * @param vec    Source vector.
+ * @param ndim   Number of axes, 1..TENSOR_MAX_DIMS.
+ * @param shape  Extent of each axis, outermost first. The product must equal @p vec->size.
+ * @param out    Receives a non-owning view aliasing @p vec->data.
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p ndim is out of range.
+ * @retval VECTOR_SIZE_MISMATCH     The number of elements differs from @p vec->size.
+ */
+vector_status_t tensor_from_vector(const vector_t *vec, size_t ndim, const size_t *shape, tensor_t *out);
+
+/**
+ * @brief Zero-copy view of a range along one axis.
+ *
+ * The view covers indices start, start + step, ... below @p stop of @p axis; all other axes are kept.
+ * @p out may be @p src.
+ *
+ * @param src    Source tensor.
+ * @param axis   Axis to slice.
+ * @param start  First index.
+ * @param stop   One past the last index (at most @p src->shape[axis]).
+ * @param step   Index step, at least 1.
+ * @param out    Receives a non-owning view aliasing @p src->data.
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p src or @p out is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p axis, the range or @p step is out of range, or the range is empty.
+ */
+vector_status_t tensor_slice(const tensor_t *src, size_t axis, size_t start, size_t stop, size_t step, tensor_t *out);
+
+/**
+ * @brief Check whether a tensor's elements are densely packed in row-major order.
+ *
+ * @param tensor  Tensor.
+ * @return true if a contiguous vector_t of ::tensor_numel() elements at @p tensor->data covers it.
+ */
+bool tensor_is_contiguous(const tensor_t *tensor);
+
+#ifdef __cplusplus
+}
+#endif
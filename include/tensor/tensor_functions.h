@@ -0,0 +1,62 @@
+#ifndef TENSOR_FUNCTIONS_H
+#define TENSOR_FUNCTIONS_H
+
+#include "tensor.h"
+#include "vector_dispatch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Broadcasting element-wise binary op on tensors, @p result = @p a op @p b.
+ *
+ * Shapes broadcast as in NumPy: axes are aligned from the innermost one, and each operand axis
+ * must either match the corresponding axis of @p result or have extent 1, in which case it is
+ * repeated. Operands may have fewer axes than @p result.
+ *
+ * The op runs through the same simd_* kernels as the vec_* wrappers (see ::vec_binary_kernel()).
+ * Trailing axes that are contiguous in all three tensors are merged, so a dense HWC activation
+ * is a single kernel call. Runs the kernels cannot take directly (broadcast, strided or
+ * unaligned views) are staged through a fixed-size aligned scratch buffer, chunk by chunk,
+ * so no temporary the size of the tensor is allocated.
+ *
+ * @param op            Binary op.
+ * @param a             Left operand.
+ * @param b             Right operand.
+ * @param result        Output, with the broadcast shape of @p a and @p b.
+ * @param shift_amount  Post-shift for ::VECTOR_OP_MUL; must be 0 for every other op.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p op is out of range, @p shift_amount is too large, or an operand has more axes than @p result.
+ * @retval VECTOR_SIZE_MISMATCH     Shapes do not broadcast to @p result.
+ * @retval VECTOR_TYPE_MISMATCH     Dtypes differ.
+ * @retval VECTOR_NOT_IMPLEMENTED   No kernel for this op and dtype.
+ * @retval VECTOR_ERROR             Scratch allocation failed.
+ *
+ * @note @p result may be the same view as @p a or @p b, but must not otherwise overlap them.
+ * @note Recommend ::tensor_ok() on all operands.
+ */
+vector_status_t tensor_binary(vector_binary_op_t op, const tensor_t *a, const tensor_t *b, tensor_t *result, unsigned int shift_amount);
+
+/**
+ * @brief Broadcasting saturated addition, as ::vec_add(). See ::tensor_binary().
+ */
+vector_status_t tensor_add(const tensor_t *a, const tensor_t *b, tensor_t *result);
+
+/**
+ * @brief Broadcasting saturated subtraction, as ::vec_sub(). See ::tensor_binary().
+ */
+vector_status_t tensor_sub(const tensor_t *a, const tensor_t *b, tensor_t *result);
+
+/**
+ * @brief Broadcasting multiply with post-shift, as ::vec_mul(). See ::tensor_binary().
+ */
+vector_status_t tensor_mul(const tensor_t *a, const tensor_t *b, tensor_t *result, unsigned int shift_amount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -52,6 +52,9 @@ typedef enum {
     DTYPE_INT16,
     DTYPE_INT32,
     DTYPE_FLOAT32,
+    DTYPE_UINT8,
+    DTYPE_UINT16,
+    DTYPE_UINT32,
 } dtype;
  
 static inline size_t sizeof_dtype(dtype t) {
@@ -60,6 +63,9 @@ static inline size_t sizeof_dtype(dtype t) {
         case DTYPE_INT16:   return sizeof(int16_t);
         case DTYPE_INT32:   return sizeof(int32_t);
         case DTYPE_FLOAT32: return sizeof(float);
+        case DTYPE_UINT8:   return sizeof(uint8_t);
+        case DTYPE_UINT16:  return sizeof(uint16_t);
+        case DTYPE_UINT32:  return sizeof(uint32_t);
         default:            return 0;
     }
 }
@@ -79,6 +85,20 @@ typedef struct {
     bool owns_data;         // Indicates if the vector_t owns the data (true if allocated with heap_caps_aligned_alloc)
 } vector_t;
  
+/**
+ * @brief Where a vector's data lives, as a request to ::vector_create_ex() or a report from ::vector_placement().
+ *
+ * PIE loads from PSRAM are several times slower than from internal SRAM, and the default heap may
+ * place large buffers in PSRAM. Hot vectors should therefore ask for VECTOR_PLACEMENT_INTERNAL.
+ */
+typedef enum {
+    VECTOR_PLACEMENT_DEFAULT  = 0,          // Any 8-bit capable heap (MALLOC_CAP_DEFAULT), as vector_create()
+    VECTOR_PLACEMENT_INTERNAL = 1 << 0,     // Internal SRAM
+    VECTOR_PLACEMENT_PSRAM    = 1 << 1,     // External PSRAM
+    VECTOR_PLACEMENT_DMA      = 1 << 2,     // DMA-capable memory
+    VECTOR_PLACEMENT_FALLBACK = 1 << 3,     // Request only: fall back to the default heap if the placement is exhausted
+} vector_placement_t;
+
 /**
  * @brief Create a heap-allocated vector with 16-byte aligned storage.
  *
@@ -86,7 +106,7 @@ typedef struct {
  * The data pointer is guaranteed to be 128-bit (16-byte) aligned.
  *
  * @param size  Number of elements.
- * @param type  Element dtype (DTYPE_INT8/INT16/INT32/FLOAT32).
+ * @param type  Element dtype (DTYPE_INT8/INT16/INT32/FLOAT32/UINT8/UINT16/UINT32).
  * @return Pointer to a newly created vector_t on success, or NULL on allocation failure.
  *
  * @note The returned vector owns its data (owns_data = true).
@@ -95,6 +115,47 @@ typedef struct {
  */
 vector_t *vector_create(size_t size, dtype type);
 
+/**
+ * @brief Create a heap-allocated vector with 16-byte aligned storage in a given kind of memory.
+ *
+ * As ::vector_create(), but the data buffer is allocated with the heap_caps capabilities matching
+ * @p placement. VECTOR_PLACEMENT_DMA combines with either memory kind.
+ *
+ * @param size       Number of elements.
+ * @param type       Element dtype.
+ * @param placement  Bitwise OR of vector_placement_t flags; VECTOR_PLACEMENT_DEFAULT behaves as ::vector_create().
+ * @return Pointer to a newly created vector_t on success, or NULL if size == 0, the flags ask for both
+ *         internal RAM and PSRAM, or the requested memory is exhausted and VECTOR_PLACEMENT_FALLBACK is not set.
+ */
+vector_t *vector_create_ex(size_t size, dtype type, uint32_t placement);
+
+/**
+ * @brief Report where a vector's data lives.
+ *
+ * @param vec  Vector to query.
+ * @return Bitwise OR of VECTOR_PLACEMENT_INTERNAL, VECTOR_PLACEMENT_PSRAM and VECTOR_PLACEMENT_DMA;
+ *         0 if @p vec or its data is NULL.
+ */
+uint32_t vector_placement(const vector_t *vec);
+
+/**
+ * @brief Move a vector's data into memory of the given placement, e.g. hot vectors into internal RAM.
+ *
+ * Nothing is done if the data already satisfies @p placement. Otherwise a new buffer is allocated,
+ * the data copied, and the old buffer freed if the vector owned it. The vector owns the new buffer
+ * afterwards; pointers to the old data are invalid. VECTOR_PLACEMENT_FALLBACK is ignored.
+ *
+ * @param vec        Vector to migrate.
+ * @param placement  Bitwise OR of vector_placement_t flags.
+ * @retval VECTOR_SUCCESS           Data is in the requested memory.
+ * @retval VECTOR_NULL              @p vec or its data is NULL.
+ * @retval VECTOR_UNALIGNED_DATA    @p vec->data is not 16-byte aligned.
+ * @retval VECTOR_TYPE_MISMATCH     @p vec->type is invalid.
+ * @retval VECTOR_INVALID_ARGUMENT  The flags ask for both internal RAM and PSRAM.
+ * @retval VECTOR_ERROR             Allocation failed; @p vec is unchanged.
+ */
+vector_status_t vector_migrate(vector_t *vec, uint32_t placement);
+
 /**
  * @brief Validate a vector_t instance and its storage.
  *
@@ -139,12 +200,32 @@ vector_status_t vector_destroy(vector_t *vec);
  * @param vec       Pointer to the vector_t to initialize.
  * @param data      Pointer to the data buffer (must be 16-byte aligned).
  * @param size      Number of elements in the data buffer.
- * @param type      Data type of the elements (DTYPE_INT8/INT16/INT32/FLOAT32).
+ * @param type      Data type of the elements (DTYPE_INT8/INT16/INT32/FLOAT32/UINT8/UINT16/UINT32).
  * @param owns_data Boolean indicating if the vector owns the data buffer.
  * @retval VECTOR_SUCCESS           Vector initialized successfully.
  */
 vector_status_t vector_set(vector_t* vec, void* data, size_t size, dtype type, bool owns_data);
 
+/**
+ * @brief Wrap a buffer of any 16-byte alignment, e.g. a DMA buffer or a network payload, without copying.
+ *
+ * The element-wise ops backed by the dispatch table (vec_add, vec_sub, vec_mul, vec_and, vec_or, vec_xor,
+ * vec_not, vec_abs, vec_neg, vec_copy and the comparisons) and the reductions vec_sum, vec_sum_f32,
+ * vec_sum_unsigned, vec_dotp and vec_dotp_f32 accept such vectors: the elements up to the first 16-byte
+ * boundary are handled separately and the rest runs on the SIMD kernels. Every other function, and
+ * ::vec_run_binary()/::vec_run_unary(), still requires 16-byte aligned data.
+ *
+ * @param vec   Pointer to the vector_t to initialize.
+ * @param data  Pointer to the data buffer, aligned to the element size.
+ * @param size  Number of elements in the data buffer.
+ * @param type  Data type of the elements.
+ * @retval VECTOR_SUCCESS           Vector initialized; it does not own the data.
+ * @retval VECTOR_NULL              @p vec or @p data is NULL.
+ * @retval VECTOR_UNALIGNED_DATA    @p data is not aligned to the element size.
+ * @retval VECTOR_TYPE_MISMATCH     Invalid dtype.
+ */
+vector_status_t vector_set_unaligned(vector_t *vec, void *data, size_t size, dtype type);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,180 @@
+#ifndef VECTOR_ARENA_H
+#define VECTOR_ARENA_H
+
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Allocation without heap churn for short- and long-lived vectors.
+ *
+ * ::vector_create() makes two heap allocations per vector, and ::vector_destroy() two frees. Code that
+ * builds and drops dozens of temporaries per frame pays for that in time and in fragmentation.
+ *
+ * - vector_arena_t carves vectors (struct and data) out of one buffer with a bump pointer. Nothing is
+ *   freed individually; ::vector_arena_reset() releases everything in O(1), e.g. once per frame.
+ * - vector_pool_t holds a fixed number of equally sized blocks for long-lived vectors that come and go
+ *   in any order. Creation and release are O(1) and never touch the heap.
+ *
+ * Both take their backing memory from heap_caps_aligned_alloc() with caller-chosen capability flags
+ * (e.g. MALLOC_CAP_INTERNAL to keep hot data out of PSRAM); on the host the flags are ignored.
+ * Vectors from either have owns_data = false and must never be passed to ::vector_destroy().
+ */
+
+/**
+ * @brief Bump allocator for 16-byte aligned vectors and buffers.
+ */
+typedef struct {
+    uint8_t *base;              // Start of the buffer, 16-byte aligned
+    size_t capacity;            // Buffer size in bytes
+    size_t used;                // Bytes handed out since the last reset
+    size_t high_water;          // Largest value of used since init, for sizing the arena
+    bool owns_buffer;           // True if base was allocated by vector_arena_init()
+} vector_arena_t;
+
+/**
+ * @brief Fixed-size-class pool of vectors.
+ */
+typedef struct {
+    uint8_t *blocks;            // block_count data blocks of block_bytes each, 16-byte aligned
+    vector_t *vectors;          // One vector_t per block; data is NULL while the block is free
+    void *free_list;            // First free block; each free block stores a pointer to the next
+    size_t block_bytes;         // Data capacity of one block, a multiple of 16
+    size_t block_count;         // Number of blocks
+    size_t free_count;          // Number of blocks currently free
+} vector_pool_t;
+
+/**
+ * @brief Allocate a @p capacity byte buffer and set up an empty arena on it.
+ *
+ * @param arena     Arena to initialize.
+ * @param capacity  Buffer size in bytes.
+ * @param caps      heap_caps capability flags for the buffer (MALLOC_CAP_DEFAULT, MALLOC_CAP_INTERNAL, ...).
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p arena is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p capacity is 0.
+ * @retval VECTOR_ERROR             Allocation failed.
+ */
+vector_status_t vector_arena_init(vector_arena_t *arena, size_t capacity, uint32_t caps);
+
+/**
+ * @brief Set up an empty arena on a caller-provided buffer, e.g. a static array.
+ *
+ * @param arena     Arena to initialize.
+ * @param buffer    Buffer, 16-byte aligned; must outlive the arena.
+ * @param capacity  Buffer size in bytes.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p arena or @p buffer is NULL.
+ * @retval VECTOR_UNALIGNED_DATA    @p buffer is not 16-byte aligned.
+ */
+vector_status_t vector_arena_init_static(vector_arena_t *arena, void *buffer, size_t capacity);
+
+/**
+ * @brief Release the arena's buffer if vector_arena_init() allocated it.
+ *
+ * Every vector and buffer taken from the arena becomes invalid.
+ *
+ * @param arena  Arena (may be NULL).
+ * @retval VECTOR_SUCCESS
+ */
+vector_status_t vector_arena_deinit(vector_arena_t *arena);
+
+/**
+ * @brief Take @p bytes of 16-byte aligned memory from the arena.
+ *
+ * @param arena  Arena.
+ * @param bytes  Number of bytes; rounded up to a multiple of 16.
+ * @return Pointer to the memory, or NULL if @p arena is NULL, @p bytes is 0 or the arena is exhausted.
+ */
+void *vector_arena_alloc(vector_arena_t *arena, size_t bytes);
+
+/**
+ * @brief Create a vector whose struct and data both live in the arena.
+ *
+ * @param arena  Arena.
+ * @param size   Number of elements.
+ * @param type   Element dtype (DTYPE_INT8/INT16/INT32/FLOAT32/UINT8/UINT16/UINT32).
+ * @return Pointer to the vector, or NULL on an invalid dtype, size == 0 or an exhausted arena.
+ *
+ * @note The data is not zeroed. The vector has owns_data = false; do not pass it to ::vector_destroy().
+ */
+vector_t *vector_arena_create(vector_arena_t *arena, size_t size, dtype type);
+
+/**
+ * @brief Current allocation offset, for a later ::vector_arena_rewind().
+ */
+size_t vector_arena_mark(const vector_arena_t *arena);
+
+/**
+ * @brief Release everything allocated after @p mark was taken, keeping earlier allocations.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p arena is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p mark lies beyond the current allocation offset.
+ */
+vector_status_t vector_arena_rewind(vector_arena_t *arena, size_t mark);
+
+/**
+ * @brief Release every allocation in O(1). The buffer is kept for reuse.
+ *
+ * @param arena  Arena (may be NULL).
+ */
+void vector_arena_reset(vector_arena_t *arena);
+
+/**
+ * @brief Allocate a pool of @p block_count blocks, each holding up to @p block_bytes of vector data.
+ *
+ * @param pool         Pool to initialize.
+ * @param block_bytes  Data capacity of each block in bytes; rounded up to a multiple of 16.
+ * @param block_count  Number of blocks.
+ * @param caps         heap_caps capability flags for the data blocks.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p pool is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p block_bytes or @p block_count is 0.
+ * @retval VECTOR_ERROR             Allocation failed.
+ */
+vector_status_t vector_pool_init(vector_pool_t *pool, size_t block_bytes, size_t block_count, uint32_t caps);
+
+/**
+ * @brief Free the pool's memory. Every vector taken from the pool becomes invalid.
+ *
+ * @param pool  Pool (may be NULL).
+ * @retval VECTOR_SUCCESS
+ */
+vector_status_t vector_pool_deinit(vector_pool_t *pool);
+
+/**
+ * @brief Take a free block and return it as a vector of @p size elements of @p type.
+ *
+ * @param pool  Pool.
+ * @param size  Number of elements; size * sizeof_dtype(type) must fit in one block.
+ * @param type  Element dtype.
+ * @return Pointer to the vector, or NULL on an invalid dtype, size == 0, a size too large for the
+ *         pool's blocks or an exhausted pool.
+ *
+ * @note The data is not zeroed. The vector has owns_data = false; release it with ::vector_pool_release().
+ */
+vector_t *vector_pool_create(vector_pool_t *pool, size_t size, dtype type);
+
+/**
+ * @brief Return a vector's block to the pool.
+ *
+ * @param pool  Pool the vector was created from.
+ * @param vec   Vector to release; invalid afterwards.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p pool or @p vec is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p vec was not created from @p pool or was already released.
+ */
+vector_status_t vector_pool_release(vector_pool_t *pool, vector_t *vec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
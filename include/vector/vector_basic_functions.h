@@ -79,6 +79,33 @@ vector_status_t vec_sub(const vector_t *vec1, const vector_t *vec2, vector_t *re
  */
 vector_status_t vec_mul(const vector_t *vec1, const vector_t *vec2, vector_t *result, const unsigned int shift_amount);
 
+/**
+ * @brief Fused element-wise multiply-add, @p result = @p vec1 * @p vec2 + @p vec3.
+ *
+ * Equivalent to ::vec_mul() followed by ::vec_add(), but done in a single pass over memory with no
+ * intermediate vector. For integer types the product is shifted and truncated exactly as in ::vec_mul()
+ * and the addition saturates as in ::vec_add(). For FLOAT32 the shift is ignored and the product is not
+ * rounded before the addition.
+ *
+ * - For integer types: @p result[i] = sat(((@p vec1[i] * @p vec2[i]) >> @p shift_amount) + @p vec3[i]).
+ * - For FLOAT32: @p result[i] = @p vec1[i] * @p vec2[i] + @p vec3[i].
+ *
+ * @param vec1          Left factor.
+ * @param vec2          Right factor.
+ * @param vec3          Addend.
+ * @param result        Output vector; may alias any input.
+ * @param shift_amount  Number of bits to shift the product (0..7, 0..15 or 0..31 by width; ignored for FLOAT32).
+ *
+ * @retval VECTOR_SUCCESS           Operation completed.
+ * @retval VECTOR_INVALID_ARGUMENT  @p shift_amount is out of range for the dtype.
+ * @retval VECTOR_SIZE_MISMATCH     Sizes differ.
+ * @retval VECTOR_TYPE_MISMATCH     Dtypes differ.
+ *
+ * @note It is recommended to call ::vector_ok() on all vectors before performing arithmetic operations.
+ * @pre All vectors must have identical size and dtype. Data must be 16-byte aligned.
+ */
+vector_status_t vec_fma(const vector_t *vec1, const vector_t *vec2, const vector_t *vec3, vector_t *result, const unsigned int shift_amount);
+
 /**
  * @brief Add a scalar to each element (integer types only).
  *
@@ -142,11 +169,26 @@ vector_status_t vec_add_scalar_f32(const vector_t *vec1, const float value, vect
  *                                       use ::vec_sum_f32() instead.
  *
  * @note For INT8/INT16/INT32, SIMD acceleration is used; accumulation is in 32 bits.
- * @note Large sums may overflow 32-bit accumulator.
+ * @note Large sums may overflow 32-bit accumulator; use ::vec_sum_i64() on long vectors.
  * @note It is recommended to call ::vector_ok() before reductions.
  */
 vector_status_t vec_sum(const vector_t *vec1, int32_t *result);
 
+/**
+ * @brief Sum-reduce all elements into a 64-bit accumulator.
+ *
+ * Computes the sum S = Σ @p vec1[i] exactly, for vectors of any length. INT8/INT16 accumulate in the 40-bit
+ * ACCX as ::vec_sum() does, flushed to 64 bits often enough that it cannot overflow; INT32 sums the 16-bit
+ * halves of each element through ACCX. The cost over ::vec_sum() is the extraction of each 64-bit partial.
+ *
+ * @param vec1    Input vector, INT8, INT16 or INT32.
+ * @param result  Pointer to 64-bit accumulator to receive the sum.
+ *
+ * @retval VECTOR_SUCCESS 
+ * @retval VECTOR_UNSUPPORTED_OPERATION  FLOAT32 and unsigned dtypes.
+ */
+vector_status_t vec_sum_i64(const vector_t *vec1, int64_t *result);
+
 /**
  * @brief Sum-reduce all elements into a 32-bit accumulator. For use with 32 bit float type.
  *
@@ -165,6 +207,24 @@ vector_status_t vec_sum(const vector_t *vec1, int32_t *result);
  */
 vector_status_t vec_sum_f32(const vector_t *vec1, float *result);
 
+/**
+ * @brief Sum-reduce all elements into an unsigned 32-bit accumulator. For use with unsigned types.
+ *
+ * Computes the sum S = Σ @p vec1[i] and writes it to @p result.
+ *
+ * @param vec1    Input vector.
+ * @param result  Pointer to unsigned 32-bit accumulator to receive the sum.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Returned when @p vec1 has a signed or float type;
+ *                                       use ::vec_sum() or ::vec_sum_f32() instead.
+ *
+ * @note For UINT8/UINT16, SIMD acceleration is used; accumulation is in 32 bits.
+ * @note Sums wrap modulo 2^32.
+ * @note It is recommended to call ::vector_ok() before reductions.
+ */
+vector_status_t vec_sum_unsigned(const vector_t *vec1, uint32_t *result);
+
 /**
  * @brief Multiply by a scalar with post-shift (fixed-point style). 
  * FLOAT32 is not supported by this function-use ::vec_mul_scalar_f32()
@@ -214,7 +274,7 @@ vector_status_t vec_mul_scalar_f32(const vector_t *vec1, const float value, vect
  * @brief Dot product into a 32-bit accumulator.
  *
  * Computes *result = Σ (@p vec1[i] * @p vec2[i]).
- * INT8/INT16 are SIMD-accelerated; INT32 is scalar.
+ * All dtypes are SIMD-accelerated; INT32 is built from 16-bit partial products, as PIE has no 32-bit multiply.
  *
  * @param vec1    Left operand.
  * @param vec2    Right operand.
@@ -226,11 +286,30 @@ vector_status_t vec_mul_scalar_f32(const vector_t *vec1, const float value, vect
  * @retval VECTOR_SIZE_MISMATCH
  * @retval VECTOR_TYPE_MISMATCH 
  *
- * @note Accumulation is in 32 bits; behavior undefined on overflow.
+ * @note Accumulation is in 32 bits; the result is the sum modulo 2^32. Use ::vec_dotp_i64() on long vectors.
  * @note Recommend ::vector_ok() on all vectors before the operation.
  */
 vector_status_t vec_dotp(const vector_t *vec1, const vector_t *vec2, int32_t *result);
 
+/**
+ * @brief Dot product into a 64-bit accumulator.
+ *
+ * Computes *result = Σ (@p vec1[i] * @p vec2[i]) as ::vec_dotp(), without chunking the vectors by hand.
+ * INT8/INT16 accumulate in the 40-bit ACCX, which is added to the 64-bit sum often enough that it cannot
+ * overflow, so the result is exact for any vector that fits in memory. INT32 products are up to 62 bits and
+ * are accumulated in 64 bits with scalar multiplies; the result is exact while the sum fits in an int64_t.
+ *
+ * @param vec1    Left operand.
+ * @param vec2    Right operand.
+ * @param result  Pointer to 64-bit accumulator to receive the dot product.
+ *
+ * @retval VECTOR_SUCCESS 
+ * @retval VECTOR_UNSUPPORTED_OPERATION  FLOAT32 and unsigned dtypes.
+ * @retval VECTOR_SIZE_MISMATCH
+ * @retval VECTOR_TYPE_MISMATCH 
+ */
+vector_status_t vec_dotp_i64(const vector_t *vec1, const vector_t *vec2, int64_t *result);
+
 /**
  * @brief Dot product of two vectors into a 32-bit float accumulator.
  * For use with float type.
@@ -384,10 +463,27 @@ vector_status_t vec_neg(const vector_t *vec1, vector_t* result);
  * @retval VECTOR_UNSUPPORTED_OPERATION Returned when dtype is unsupported.
  *                                       For DTYPE_FLOAT32, use ::vec_mac_f32() instead
  *
- * @note Accumulation is in 32 bits; behavior undefined on overflow.
+ * @note Accumulation is in 32 bits; behavior undefined on overflow. Use ::vec_mac_i64() on long vectors.
  * @note Recommend ::vector_ok() before arithmetic operations.
  */
 vector_status_t vec_mac(const vector_t *vec1, int32_t* accumulator, const int multiplier);
+
+/**
+ * @brief Multiply-accumulate into a 64-bit accumulator.
+ *
+ * Computes *@p accumulator += Σ (@p vec1[i] * @p multiplier) as ::vec_mac(), computed as
+ * @p multiplier * ::vec_sum_i64(@p vec1) so the whole reduction runs in ACCX with one multiply at the end.
+ * Exact for INT8/INT16; for INT32, exact while the result fits in an int64_t, wrapping modulo 2^64 otherwise.
+ *
+ * @param vec1         Input vector (integer dtypes).
+ * @param accumulator  In/out accumulator (64-bit).
+ * @param multiplier   Integer multiplier, in the range of the dtype as for ::vec_mac().
+ *
+ * @retval VECTOR_SUCCESS 
+ * @retval VECTOR_INVALID_ARGUMENT      @p accumulator is NULL or @p multiplier is out of range.
+ * @retval VECTOR_UNSUPPORTED_OPERATION FLOAT32 and unsigned dtypes.
+ */
+vector_status_t vec_mac_i64(const vector_t *vec1, int64_t* accumulator, const int multiplier);
  
 /**
  * @brief Multiply-accumulate into a 32-bit float accumulator.
@@ -491,21 +587,73 @@ vector_status_t vec_copy(vector_t *vec1, vector_t *result);
  * @brief Creates a copy-converts a vector from one dtype to another.
  *
  * Sets all elements of @p result to @p vec1. 
- * Currently only supports Widening conversions from INT8 -> INT16/INT32 and INT16 -> INT32.
- * Narrowing conversions and float/integer conversions are not supported and currently return VECTOR_NOT_IMPLEMENTED.
- * Implementation of additional conversions is planned for future releases.
+ * Supports widening conversions from INT8 -> INT16/INT32 and INT16 -> INT32, and saturating narrowing
+ * conversions from INT32 -> INT16/INT8 and INT16 -> INT8 (out-of-range elements clamp to the target range).
+ * INT8/INT16 <-> FLOAT32 convert by value, as ::vec_quantize and ::vec_dequantize with scale 1 and zero point 0.
+ * INT32 <-> FLOAT32 currently returns VECTOR_NOT_IMPLEMENTED.
  *
  * @param src   Vector to copy.
  * @param dst   Target vector.
  *
  * @retval VECTOR_SUCCESS 
+ * @retval VECTOR_INVALID_ARGUMENT Same dtype.
  * @retval VECTOR_SIZE_MISMATCH
- * @retval VECTOR_TYPE_MISMATCH 
+ * @retval VECTOR_NOT_IMPLEMENTED INT32 <-> FLOAT32.
  *
  * @note Recommend ::vector_ok() before mutating a vector.
  */ 
 vector_status_t vec_convert(const vector_t *src, vector_t *dst);
 
+/**
+ * @brief Narrowing conversion with a rounding right shift, as when requantizing int32 accumulators.
+ *
+ * Performs @p dst[i] = saturate((@p src[i] + 2^(shift_amount - 1)) >> @p shift_amount), rounding half up,
+ * in one pass; the rounding add cannot overflow. A shift of 0 is ::vec_convert.
+ *
+ * @param src           Vector to convert.
+ * @param dst           Target vector, same size.
+ * @param shift_amount  Right shift, up to 31 from INT32 and 15 from INT16. Must be 0 for widening conversions.
+ *
+ * @retval VECTOR_SUCCESS 
+ * @retval VECTOR_INVALID_ARGUMENT Same dtype, or @p shift_amount out of range.
+ * @retval VECTOR_SIZE_MISMATCH
+ * @retval VECTOR_NOT_IMPLEMENTED INT32 <-> FLOAT32.
+ */ 
+vector_status_t vec_convert_shift(const vector_t *src, vector_t *dst, const unsigned int shift_amount);
+
+/**
+ * @brief Quantizes FLOAT32 to INT8 or INT16 with an affine scale and zero point.
+ *
+ * Performs @p dst[i] = saturate(round(@p src[i] * (1 / @p scale) + @p zero_point)) in one pass over the data;
+ * the reciprocal is taken once per call, so results can differ from a true divide by one step at exact ties.
+ * Rounding is to nearest, ties to even. NaN maps to the minimum of the target type.
+ *
+ * @param src         FLOAT32 vector.
+ * @param dst         INT8 or INT16 vector, same size.
+ * @param scale       Step size of one integer unit; positive, finite, and with a finite reciprocal.
+ * @param zero_point  Integer that 0.0 maps to, within the range of @p dst.
+ *
+ * @retval VECTOR_SUCCESS 
+ * @retval VECTOR_INVALID_ARGUMENT       @p scale or @p zero_point out of range.
+ * @retval VECTOR_SIZE_MISMATCH
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Other dtypes.
+ */ 
+vector_status_t vec_quantize(const vector_t *src, vector_t *dst, const float scale, const int zero_point);
+
+/**
+ * @brief Dequantizes INT8 or INT16 to FLOAT32, the inverse of ::vec_quantize.
+ *
+ * Performs @p dst[i] = (@p src[i] - @p zero_point) * @p scale in one pass; the subtraction is exact.
+ *
+ * @param src         INT8 or INT16 vector.
+ * @param dst         FLOAT32 vector, same size.
+ * @param scale       As ::vec_quantize.
+ * @param zero_point  As ::vec_quantize, within the range of @p src.
+ *
+ * @retval As ::vec_quantize.
+ */ 
+vector_status_t vec_dequantize(const vector_t *src, vector_t *dst, const float scale, const int zero_point);
+
 
 #ifdef __cplusplus
 }
@@ -6,6 +6,13 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+
+/**
+ * FLOAT32 comparisons produce a mask vector of the same dtype whose true elements are the bit
+ * pattern 0xFFFFFFFF (a NaN as a float) and false elements +0.0, so masks combine with the raw-bit
+ * FLOAT32 ::vec_and, ::vec_or and ::vec_not. They follow IEEE 754: where either element is NaN,
+ * gt, lt, ge, le and eq are false and ne is true, and +0 equals -0.
+ */
  
 /**
  * @brief Element-wise greater-than comparison.
@@ -20,7 +27,6 @@ extern "C" {
  * @retval VECTOR_SUCCESS  
  * @retval VECTOR_SIZE_MISMATCH
  * @retval VECTOR_TYPE_MISMATCH 
- * @retval VECTOR_NOT_IMPLEMENTED Float type currently not supported.
  *
  * @note Recommend ::vector_ok() before comparisons.
  */
@@ -39,7 +45,6 @@ vector_status_t vec_gt(const vector_t *vec1, const vector_t *vec2, vector_t *res
  * @retval VECTOR_SUCCESS  
  * @retval VECTOR_SIZE_MISMATCH
  * @retval VECTOR_TYPE_MISMATCH 
- * @retval VECTOR_NOT_IMPLEMENTED Float type currently not supported.
  * 
  * @note Recommend ::vector_ok() before comparisons.
  */
@@ -58,23 +63,76 @@ vector_status_t vec_lt(const vector_t *vec1, const vector_t *vec2, vector_t *res
  * @retval VECTOR_SUCCESS  
  * @retval VECTOR_SIZE_MISMATCH
  * @retval VECTOR_TYPE_MISMATCH 
- * @retval VECTOR_NOT_IMPLEMENTED Float type currently not supported.
  * 
  * @note Recommend ::vector_ok() before comparisons.
  */
 vector_status_t vec_eq(const vector_t *vec1, const vector_t *vec2, vector_t *result);
 
+/**
+ * @brief Element-wise greater-than-or-equal comparison.
+ *
+ * Produces an mask vector comparing @p vec1[i] >= @p vec2[i].
+ * Each result element is 0 for false, -1 for true.
+ *
+ * @param vec1    Left operand.
+ * @param vec2    Right operand.
+ * @param result  Output mask vector.
+ *
+ * @retval VECTOR_SUCCESS  
+ * @retval VECTOR_SIZE_MISMATCH
+ * @retval VECTOR_TYPE_MISMATCH 
+ * 
+ * @note Integer dtypes compute the complement of ::vec_lt, a second pass over @p result.
+ */
+vector_status_t vec_ge(const vector_t *vec1, const vector_t *vec2, vector_t *result);
+
+/**
+ * @brief Element-wise less-than-or-equal comparison.
+ *
+ * Produces an mask vector comparing @p vec1[i] <= @p vec2[i].
+ * Each result element is 0 for false, -1 for true.
+ *
+ * @param vec1    Left operand.
+ * @param vec2    Right operand.
+ * @param result  Output mask vector.
+ *
+ * @retval VECTOR_SUCCESS  
+ * @retval VECTOR_SIZE_MISMATCH
+ * @retval VECTOR_TYPE_MISMATCH 
+ * 
+ * @note Integer dtypes compute the complement of ::vec_gt, a second pass over @p result.
+ */
+vector_status_t vec_le(const vector_t *vec1, const vector_t *vec2, vector_t *result);
+
+/**
+ * @brief Element-wise inequality comparison.
+ *
+ * Produces an mask vector comparing @p vec1[i] != @p vec2[i].
+ * Each result element is 0 for false, -1 for true.
+ *
+ * @param vec1    Left operand.
+ * @param vec2    Right operand.
+ * @param result  Output mask vector.
+ *
+ * @retval VECTOR_SUCCESS  
+ * @retval VECTOR_SIZE_MISMATCH
+ * @retval VECTOR_TYPE_MISMATCH 
+ * 
+ * @note Integer dtypes compute the complement of ::vec_eq, a second pass over @p result.
+ */
+vector_status_t vec_ne(const vector_t *vec1, const vector_t *vec2, vector_t *result);
+
 /**
  * @brief Element-wise maximum of two vectors.
  *
  * Computes @p result[i] = max(@p vec1[i], @p vec2[i]). 
+ * For FLOAT32 a NaN in either operand gives NaN, and equal elements (such as +0 and -0) give @p vec1[i].
  *
  * @param vec1, vec2, result  Operands and output; @p result may alias inputs.
  *
  * @retval VECTOR_SUCCESS
  * @retval VECTOR_SIZE_MISMATCH
  * @retval VECTOR_TYPE_MISMATCH  
- * @retval VECTOR_NOT_IMPLEMENTED Float type currently not supported.
  *  
  * @note Recommend ::vector_ok() before arithmetic operations.
  */
@@ -84,13 +142,13 @@ vector_status_t vec_max(const vector_t *vec1, const vector_t *vec2, vector_t *re
  * @brief Element-wise minimum of two vectors.
  *
  * Computes @p result[i] = min(@p vec1[i], @p vec2[i]). 
+ * For FLOAT32 a NaN in either operand gives NaN, and equal elements (such as +0 and -0) give @p vec1[i].
  *
  * @param vec1, vec2, result  Operands and output; @p result may alias inputs.
  *
  * @retval VECTOR_SUCCESS
  * @retval VECTOR_SIZE_MISMATCH
  * @retval VECTOR_TYPE_MISMATCH  
- * @retval VECTOR_NOT_IMPLEMENTED Float type currently not supported.
  *
  * @note Recommend ::vector_ok() before arithmetic operations.
  */
@@ -0,0 +1,160 @@
+#ifndef VECTOR_DISPATCH_H
+#define VECTOR_DISPATCH_H
+
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Table-driven op x dtype dispatch.
+ *
+ * The element-wise vec_* wrappers resolve their kernel from a constant op x dtype table rather
+ * than switching on the dtype. For hot loops over same-shaped vectors, a prepared op resolves
+ * and validates once with vec_prepare_binary()/vec_prepare_unary(); each vec_run_*() call is
+ * then a single indirect call with no size, type or argument checks.
+ */
+
+typedef enum {
+    VECTOR_OP_ADD,          // vec_add
+    VECTOR_OP_SUB,          // vec_sub
+    VECTOR_OP_MUL,          // vec_mul, uses shift_amount
+    VECTOR_OP_AND,          // vec_and
+    VECTOR_OP_OR,           // vec_or
+    VECTOR_OP_XOR,          // vec_xor
+    VECTOR_OP_MAX,          // vec_max
+    VECTOR_OP_MIN,          // vec_min
+    VECTOR_OP_GT,           // vec_gt
+    VECTOR_OP_LT,           // vec_lt
+    VECTOR_OP_EQ,           // vec_eq
+    VECTOR_OP_GE,           // vec_ge
+    VECTOR_OP_LE,           // vec_le
+    VECTOR_OP_NE,           // vec_ne
+    VECTOR_BINARY_OP_COUNT
+} vector_binary_op_t;
+
+typedef enum {
+    VECTOR_OP_ABS,          // vec_abs
+    VECTOR_OP_NEG,          // vec_neg
+    VECTOR_OP_NOT,          // vec_not
+    VECTOR_OP_COPY,         // vec_copy
+    VECTOR_UNARY_OP_COUNT
+} vector_unary_op_t;
+
+// Number of dtypes covered by the dispatch tables
+#define VECTOR_DISPATCH_DTYPES  (DTYPE_UINT32 + 1)
+
+/**
+ * @brief Type-erased element-wise kernels stored in the dispatch tables.
+ *
+ * Each entry forwards to the matching simd_* kernel. @p shift_amount is ignored by every
+ * binary op except ::VECTOR_OP_MUL. Returns 0 on success, as the simd_* kernels do.
+ */
+typedef int (*vector_binary_kernel_t)(const void *a, const void *b, void *result, unsigned int shift_amount, size_t size);
+typedef int (*vector_unary_kernel_t)(const void *a, void *result, size_t size);
+
+/**
+ * @brief A binary op resolved for one dtype, size and shift.
+ *
+ * Filled in by ::vec_prepare_binary(). Reusable for any vectors with the dtype and size it was
+ * prepared for.
+ */
+typedef struct {
+    vector_binary_kernel_t kernel;  // Resolved kernel
+    dtype type;                     // Dtype the op was prepared for
+    size_t size;                    // Number of elements processed per run
+    unsigned int shift_amount;      // Post-shift for VECTOR_OP_MUL, 0 otherwise
+} vector_binary_plan_t;
+
+/**
+ * @brief A unary op resolved for one dtype and size. Filled in by ::vec_prepare_unary().
+ */
+typedef struct {
+    vector_unary_kernel_t kernel;   // Resolved kernel
+    dtype type;                     // Dtype the op was prepared for
+    size_t size;                    // Number of elements processed per run
+} vector_unary_plan_t;
+
+/**
+ * @brief Look up the kernel for @p op on @p type.
+ *
+ * @param op    Binary op.
+ * @param type  Element dtype.
+ * @return The kernel, or NULL if @p op or @p type is out of range or the combination is not implemented.
+ */
+vector_binary_kernel_t vec_binary_kernel(vector_binary_op_t op, dtype type);
+
+/**
+ * @brief Look up the kernel for @p op on @p type.
+ *
+ * @param op    Unary op.
+ * @param type  Element dtype.
+ * @return The kernel, or NULL if @p op or @p type is out of range or the combination is not implemented.
+ */
+vector_unary_kernel_t vec_unary_kernel(vector_unary_op_t op, dtype type);
+
+/**
+ * @brief Resolve and validate a binary op once for repeated use.
+ *
+ * Performs the checks the matching vec_* wrapper performs on every call.
+ *
+ * @param plan          Plan to fill in.
+ * @param op            Binary op.
+ * @param vec1          Left operand the plan will be run with (or one of the same dtype and size).
+ * @param vec2          Right operand.
+ * @param result        Output vector.
+ * @param shift_amount  Post-shift for ::VECTOR_OP_MUL; must be 0 for every other op.
+ *
+ * @retval VECTOR_SUCCESS           @p plan is ready for ::vec_run_binary().
+ * @retval VECTOR_NULL              A pointer argument is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p op is out of range or @p shift_amount is too large for the dtype.
+ * @retval VECTOR_SIZE_MISMATCH     Sizes differ.
+ * @retval VECTOR_TYPE_MISMATCH     Dtypes differ.
+ * @retval VECTOR_NOT_IMPLEMENTED   No kernel for this op and dtype.
+ * @retval VECTOR_ERROR             Invalid dtype.
+ */
+vector_status_t vec_prepare_binary(vector_binary_plan_t *plan, vector_binary_op_t op, const vector_t *vec1,
+                                   const vector_t *vec2, const vector_t *result, const unsigned int shift_amount);
+
+/**
+ * @brief Resolve and validate a unary op once for repeated use.
+ *
+ * @param plan    Plan to fill in.
+ * @param op      Unary op.
+ * @param vec1    Input the plan will be run with (or one of the same dtype and size).
+ * @param result  Output vector.
+ *
+ * @retval VECTOR_SUCCESS           @p plan is ready for ::vec_run_unary().
+ * @retval VECTOR_NULL              A pointer argument is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p op is out of range.
+ * @retval VECTOR_SIZE_MISMATCH     Sizes differ.
+ * @retval VECTOR_TYPE_MISMATCH     Dtypes differ.
+ * @retval VECTOR_NOT_IMPLEMENTED   No kernel for this op and dtype.
+ * @retval VECTOR_ERROR             Invalid dtype.
+ */
+vector_status_t vec_prepare_unary(vector_unary_plan_t *plan, vector_unary_op_t op, const vector_t *vec1, const vector_t *result);
+
+/**
+ * @brief Run a prepared binary op.
+ *
+ * @pre @p vec1, @p vec2 and @p result have the dtype and size @p plan was prepared for, and 16-byte aligned data. Not checked.
+ */
+static inline vector_status_t vec_run_binary(const vector_binary_plan_t *plan, const vector_t *vec1, const vector_t *vec2, vector_t *result) {
+    return (vector_status_t)plan->kernel(vec1->data, vec2->data, result->data, plan->shift_amount, plan->size);
+}
+
+/**
+ * @brief Run a prepared unary op.
+ *
+ * @pre @p vec1 and @p result have the dtype and size @p plan was prepared for, and 16-byte aligned data. Not checked.
+ */
+static inline vector_status_t vec_run_unary(const vector_unary_plan_t *plan, const vector_t *vec1, vector_t *result) {
+    return (vector_status_t)plan->kernel(vec1->data, result->data, plan->size);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef VECTOR_EXPR_H
+#define VECTOR_EXPR_H
+
+#include "vector.h"
+#include "vector_dispatch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Deferred, fused execution of element-wise chains.
+ *
+ * Calling vec_* functions one after another walks every buffer once per op and needs a full-size
+ * intermediate vector per step. A vector_expr_t instead records the chain as a small graph of
+ * nodes and runs it in one blocked pass: the vectors are processed VECTOR_EXPR_TILE elements at a
+ * time, and every intermediate result lives only in a tile-sized scratch buffer in internal RAM.
+ * Each vector_t input is read once and the output (or the reduction) written once, whatever the
+ * length of the chain. The same simd_* kernels as the vec_* wrappers run on each tile.
+ *
+ * Nodes are referred to by the int handles the builder functions return. Builders never fail
+ * loudly: the first error is latched in vector_expr_t::status, later builders return -1, and the
+ * evaluation functions return the latched status. A chain can therefore be built without checking
+ * each step:
+ *
+ *     vector_expr_t expr;
+ *     vec_expr_init(&expr);
+ *     int x = vec_expr_input(&expr, accelerometer_x_data);
+ *     int centered = vec_expr_add_scalar(&expr, x, -average_x);
+ *     vec_expr_dotp(&expr, centered, centered, &sd_x);         // No standard_dev_x vector needed
+ */
+
+#define VECTOR_EXPR_MAX_NODES   16      // Maximum number of nodes (inputs included) in one expression
+#define VECTOR_EXPR_TILE        256     // Elements per tile; a multiple of 16 so tiles stay 16-byte aligned
+
+typedef enum {
+    VECTOR_EXPR_INPUT,                  // A vector_t operand
+    VECTOR_EXPR_BINARY,                 // vector_binary_op_t of two nodes
+    VECTOR_EXPR_UNARY,                  // vector_unary_op_t of one node
+    VECTOR_EXPR_ADD_SCALAR,             // vec_add_scalar / vec_add_scalar_f32
+    VECTOR_EXPR_MUL_SCALAR,             // vec_mul_scalar / vec_mul_scalar_f32
+} vector_expr_kind_t;
+
+typedef struct {
+    vector_expr_kind_t kind;
+    int a;                              // First operand node, -1 for inputs
+    int b;                              // Second operand node of binary nodes, -1 otherwise
+    union {
+        const vector_t *input;          // VECTOR_EXPR_INPUT
+        vector_binary_kernel_t binary;  // VECTOR_EXPR_BINARY
+        vector_unary_kernel_t unary;    // VECTOR_EXPR_UNARY
+    } op;
+    union {
+        int32_t i;                      // Integer scalar, already range-checked for the dtype
+        float f;                        // FLOAT32 scalar
+    } scalar;
+    unsigned int shift_amount;          // Post-shift of VECTOR_OP_MUL and integer VECTOR_EXPR_MUL_SCALAR
+} vector_expr_node_t;
+
+/**
+ * @brief A recorded chain of element-wise ops over same-shaped vectors.
+ *
+ * All nodes share the dtype and size of the first input. Plain data, so it may live on the stack;
+ * it holds no allocations between calls.
+ */
+typedef struct {
+    vector_expr_node_t nodes[VECTOR_EXPR_MAX_NODES];
+    size_t count;                       // Number of nodes recorded
+    dtype type;                         // Dtype of every node, set by the first input
+    size_t size;                        // Element count of every node, set by the first input
+    vector_status_t status;             // First error raised while building, VECTOR_SUCCESS otherwise
+} vector_expr_t;
+
+/**
+ * @brief Reset @p expr to an empty expression.
+ *
+ * @param expr  Expression to initialize.
+ */
+void vec_expr_init(vector_expr_t *expr);
+
+/**
+ * @brief Add a vector operand.
+ *
+ * The vector is only referenced; it must stay valid until the expression is evaluated, and its
+ * contents are read at evaluation time.
+ *
+ * @param expr  Expression.
+ * @param vec   Input vector, 16-byte aligned.
+ * @return Node handle, or -1 on error (latched in @p expr->status: VECTOR_NULL, VECTOR_TYPE_MISMATCH,
+ *         VECTOR_SIZE_MISMATCH, VECTOR_UNALIGNED_DATA, VECTOR_INVALID_ARGUMENT when the node limit is reached,
+ *         VECTOR_ERROR for an invalid dtype).
+ */
+int vec_expr_input(vector_expr_t *expr, const vector_t *vec);
+
+/**
+ * @brief Add @p a op @p b, as the matching vec_* wrapper computes it.
+ *
+ * @param expr          Expression.
+ * @param op            Binary op.
+ * @param a             Left operand node.
+ * @param b             Right operand node.
+ * @param shift_amount  Post-shift for ::VECTOR_OP_MUL; must be 0 for every other op.
+ * @return Node handle, or -1 on error (latched in @p expr->status, with the codes of ::vec_prepare_binary()).
+ */
+int vec_expr_binary(vector_expr_t *expr, vector_binary_op_t op, int a, int b, unsigned int shift_amount);
+
+/**
+ * @brief Add op @p a, as the matching vec_* wrapper computes it.
+ *
+ * @param expr  Expression.
+ * @param op    Unary op.
+ * @param a     Operand node.
+ * @return Node handle, or -1 on error (latched in @p expr->status, with the codes of ::vec_prepare_unary()).
+ */
+int vec_expr_unary(vector_expr_t *expr, vector_unary_op_t op, int a);
+
+/**
+ * @brief Add @p a + @p value, as ::vec_add_scalar() (signed integer types only).
+ *
+ * @return Node handle, or -1 on error (latched in @p expr->status: VECTOR_INVALID_ARGUMENT for a bad node or a
+ *         @p value out of range for the dtype, VECTOR_UNSUPPORTED_OPERATION for FLOAT32 and unsigned types).
+ */
+int vec_expr_add_scalar(vector_expr_t *expr, int a, int value);
+
+/**
+ * @brief Add @p a + @p value, as ::vec_add_scalar_f32() (FLOAT32 only).
+ *
+ * @return Node handle, or -1 on error (latched in @p expr->status).
+ */
+int vec_expr_add_scalar_f32(vector_expr_t *expr, int a, float value);
+
+/**
+ * @brief Add (@p a * @p value) >> @p shift_amount, as ::vec_mul_scalar() (signed integer types only).
+ *
+ * @return Node handle, or -1 on error (latched in @p expr->status: VECTOR_INVALID_ARGUMENT for a bad node, a
+ *         @p value out of range or a @p shift_amount too large for the dtype, VECTOR_UNSUPPORTED_OPERATION for
+ *         FLOAT32 and unsigned types).
+ */
+int vec_expr_mul_scalar(vector_expr_t *expr, int a, int value, unsigned int shift_amount);
+
+/**
+ * @brief Add @p a * @p value, as ::vec_mul_scalar_f32() (FLOAT32 only).
+ *
+ * @return Node handle, or -1 on error (latched in @p expr->status).
+ */
+int vec_expr_mul_scalar_f32(vector_expr_t *expr, int a, float value);
+
+/**
+ * @brief Evaluate node @p node into @p result in a single blocked pass.
+ *
+ * Only the nodes @p node depends on are computed. @p result may be one of the input vectors; each
+ * tile of it is written after every read of that tile.
+ *
+ * @param expr    Expression.
+ * @param node    Node to materialize.
+ * @param result  Output vector with the expression's dtype and size.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p expr or @p result is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p node is not a node of @p expr.
+ * @retval VECTOR_SIZE_MISMATCH     @p result has a different size.
+ * @retval VECTOR_TYPE_MISMATCH     @p result has a different dtype.
+ * @retval VECTOR_UNALIGNED_DATA    @p result data is not 16-byte aligned.
+ * @retval VECTOR_ERROR             Tile scratch allocation failed.
+ * @retval other                    The status latched while building @p expr.
+ */
+vector_status_t vec_expr_eval(vector_expr_t *expr, int node, vector_t *result);
+
+/**
+ * @brief Sum-reduce node @p node without materializing it, as ::vec_sum().
+ *
+ * Tiles are summed with the simd_sum_* kernel and combined in a wrapping 32-bit accumulator; INT32
+ * tiles instead carry the kernel's four saturating lanes from one tile to the next. The result
+ * equals ::vec_sum() on the materialized node, overflow included.
+ *
+ * @retval VECTOR_UNSUPPORTED_OPERATION  FLOAT32 or unsigned dtype; use ::vec_expr_sum_f32() for FLOAT32.
+ * @retval others                        As ::vec_expr_eval().
+ */
+vector_status_t vec_expr_sum(vector_expr_t *expr, int node, int32_t *result);
+
+/**
+ * @brief Sum-reduce node @p node without materializing it, as ::vec_sum_f32().
+ *
+ * @note Tiles are accumulated in order, so rounding may differ slightly from ::vec_sum_f32().
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Integer dtype; use ::vec_expr_sum().
+ * @retval others                        As ::vec_expr_eval().
+ */
+vector_status_t vec_expr_sum_f32(vector_expr_t *expr, int node, float *result);
+
+/**
+ * @brief Dot product of nodes @p a and @p b without materializing them, as ::vec_dotp().
+ *
+ * @p a and @p b may be the same node (sum of squares).
+ *
+ * @retval VECTOR_UNSUPPORTED_OPERATION  FLOAT32 or unsigned dtype; use ::vec_expr_dotp_f32() for FLOAT32.
+ * @retval others                        As ::vec_expr_eval().
+ */
+vector_status_t vec_expr_dotp(vector_expr_t *expr, int a, int b, int32_t *result);
+
+/**
+ * @brief Dot product of nodes @p a and @p b without materializing them, as ::vec_dotp_f32().
+ *
+ * @note Tiles are accumulated in order, so rounding may differ slightly from ::vec_dotp_f32().
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Integer dtype; use ::vec_expr_dotp().
+ * @retval others                        As ::vec_expr_eval().
+ */
+vector_status_t vec_expr_dotp_f32(vector_expr_t *expr, int a, int b, float *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
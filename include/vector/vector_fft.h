@@ -0,0 +1,102 @@
+#ifndef VECTOR_FFT_H
+#define VECTOR_FFT_H
+
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * In-place FFTs on vector_t.
+ *
+ * A complex signal of n samples is a vector of 2 * n elements, real and imaginary parts
+ * interleaved; n must be a power of two up to ::VECTOR_FFT_MAX_SIZE. INT16 (Q15) and FLOAT32 are
+ * supported:
+ *
+ *     int exponent;
+ *     vec_fft(spectrum, &exponent);                    // INT16: true spectrum = spectrum * 2^exponent
+ *
+ * The transforms are radix-2 decimation in time. Each size has its own twiddle table, laid out
+ * stage by stage so every stage reads its twiddles contiguously; tables are built on first use and
+ * cached until ::vector_fft_deinit(). Building allocates, so real-time code should call
+ * ::vector_fft_init() for its sizes up front. The cache is not locked: build tables from one task
+ * before sharing a size between tasks.
+ *
+ * INT16 uses block floating point. Before each stage the block's peak, tracked by the previous
+ * stage's kernel, decides whether the whole block is shifted right by 1 or 2 bits so the stage
+ * cannot overflow; the shifts are returned as a common exponent. Butterflies use ee.cmul.s16 for
+ * the twiddle products and saturating adds, and the first two stages, whose twiddles are 1 and -j,
+ * use no multiplies at all.
+ */
+
+#define VECTOR_FFT_MAX_LOG2     14                      // Largest transform: 2^14 complex samples
+#define VECTOR_FFT_MAX_SIZE     (1u << VECTOR_FFT_MAX_LOG2)
+
+/**
+ * @brief Build and cache the twiddle table for @p n point transforms of @p type.
+ *
+ * Also builds the n / 2 table that ::vec_rfft of n real samples uses. Already cached sizes are kept.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_INVALID_ARGUMENT       @p n is not a power of two between 2 and ::VECTOR_FFT_MAX_SIZE.
+ * @retval VECTOR_UNSUPPORTED_OPERATION  @p type is not INT16 or FLOAT32.
+ * @retval VECTOR_ERROR                  Allocation failed.
+ */
+vector_status_t vector_fft_init(size_t n, dtype type);
+
+/**
+ * @brief Free every cached twiddle table.
+ *
+ * @pre No transform runs concurrently.
+ */
+void vector_fft_deinit(void);
+
+/**
+ * @brief In-place forward complex FFT, X[k] = sum over t of x[t] * e^(-2 pi i k t / n).
+ *
+ * @param data      2 * n elements, complex interleaved, 16-byte aligned. Replaced by the spectrum in natural order.
+ * @param exponent  INT16: receives the block exponent e, the spectrum being @p data * 2^e. Ignored (may be NULL) for FLOAT32.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL                   @p data or its buffer is NULL, or @p exponent is NULL for INT16.
+ * @retval VECTOR_INVALID_ARGUMENT       n is not a power of two between 2 and ::VECTOR_FFT_MAX_SIZE.
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Other dtypes.
+ * @retval VECTOR_UNALIGNED_DATA         @p data is not 16-byte aligned.
+ * @retval VECTOR_ERROR                  The twiddle table could not be allocated.
+ */
+vector_status_t vec_fft(vector_t *data, int *exponent);
+
+/**
+ * @brief In-place inverse complex FFT, x[t] = (1 / n) * sum over k of X[k] * e^(2 pi i k t / n).
+ *
+ * Computed as the conjugate of the forward transform of the conjugate. For INT16 the 1 / n is folded into
+ * the exponent, which may be negative: the signal is @p data * 2^e.
+ *
+ * @param data      As ::vec_fft.
+ * @param exponent  As ::vec_fft.
+ *
+ * @retval As ::vec_fft.
+ */
+vector_status_t vec_ifft(vector_t *data, int *exponent);
+
+/**
+ * @brief FFT of n real samples, computed with an n / 2 point complex FFT and a split pass.
+ *
+ * @param input     n real samples, n a power of two between 4 and ::VECTOR_FFT_MAX_SIZE.
+ * @param output    n + 2 elements, 16-byte aligned: bins 0 to n / 2, complex interleaved (the others are
+ *                  their conjugates). May share its buffer with @p input.
+ * @param exponent  As ::vec_fft.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_SIZE_MISMATCH  @p output is not n + 2 elements.
+ * @retval VECTOR_TYPE_MISMATCH  Dtypes differ.
+ * @retval others                As ::vec_fft.
+ */
+vector_status_t vec_rfft(const vector_t *input, vector_t *output, int *exponent);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,209 @@
+#ifndef VECTOR_FILTER_H
+#define VECTOR_FILTER_H
+
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Streaming FIR and biquad IIR filtering, and correlation.
+ *
+ * ::vec_fir filters one block of an unbounded signal. The filter state keeps the last taps - 1
+ * input samples (the delay line), so consecutive blocks of any size produce the same output as one
+ * call over the whole signal:
+ *
+ *     vector_fir_state_t fir;
+ *     vector_fir_init(&fir, taps->size, DTYPE_INT16);
+ *     while (next_dma_block(&block)) {
+ *         vec_fir(&block, taps, &fir, &block);                 // In place
+ *     }
+ *     vector_fir_deinit(&fir);
+ *
+ * The kernels compute every output of a block in one call. The taps are stored reversed and
+ * zero-padded at the front to a whole number of 16-byte blocks, and each output is accumulated
+ * block by block over the window; INT16 accumulates with ee.vmulas.s16.accx in the 40-bit ACCX,
+ * FLOAT32 with four madd.s accumulators. Input is staged into the delay line VECTOR_FIR_TILE
+ * samples at a time.
+ *
+ * ::vec_biquad_cascade runs a cascade of second-order IIR sections over interleaved multi-channel
+ * data; see ::vector_biquad_state_t.
+ *
+ * ::vec_xcorr and ::vec_autocorr compute every lag up to max_lag in one call. The kernels block
+ * the lags so each input sample loaded feeds several lag accumulators: INT16 keeps 8 lags in the
+ * QACC lanes, FLOAT32 4 lags in FPU registers. INT8 is widened to INT16 on the way in.
+ */
+
+#define VECTOR_FIR_TILE             256     // Input samples staged into the delay line per kernel call
+#define VECTOR_FIR_MAX_TAPS_I16     512     // Keeps the INT16 40-bit accumulator from overflowing
+#define VECTOR_BIQUAD_TILE          64      // Frames staged per kernel call when channels are gathered
+
+/**
+ * @brief FIR filter state: the prepared taps and the delay line. Initialise with ::vector_fir_init().
+ */
+typedef struct {
+    dtype type;                             // INT16 (Q15) or FLOAT32
+    size_t ntaps;                           // Filter length, as passed to vector_fir_init()
+    size_t padded;                          // ntaps rounded up to a whole 16-byte block of taps
+    void *taps;                             // padded taps, reversed and zero-padded at the front; 16-byte aligned
+    void *work;                             // padded - 1 history samples, then one input tile and 16 bytes of read slack
+} vector_fir_state_t;
+
+/**
+ * @brief Allocate the state for a filter of @p ntaps taps, with a zeroed delay line.
+ *
+ * @param state  State to initialise.
+ * @param ntaps  Number of taps; at most ::VECTOR_FIR_MAX_TAPS_I16 for INT16.
+ * @param type   DTYPE_INT16 (Q15 taps and samples) or DTYPE_FLOAT32.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL                   @p state is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT       @p ntaps is 0 or too large.
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Other dtypes.
+ * @retval VECTOR_ERROR                  Allocation failed.
+ */
+vector_status_t vector_fir_init(vector_fir_state_t *state, size_t ntaps, dtype type);
+
+/**
+ * @brief Free the buffers of @p state.
+ */
+void vector_fir_deinit(vector_fir_state_t *state);
+
+/**
+ * @brief Zero the delay line, as at the start of a new signal.
+ */
+void vector_fir_reset(vector_fir_state_t *state);
+
+/**
+ * @brief Filter the next block of the signal.
+ *
+ * Performs @p output[n] = sum over k of @p taps[k] * x[n - k], where x is the signal so far and
+ * samples before its start are zero.
+ *
+ * For INT16 the taps and samples are Q15: the Q30 sum is rounded to Q15 and saturated.
+ *
+ * @param input   Next block, any size.
+ * @param taps    Filter coefficients in natural order, dtype and size as given to ::vector_fir_init().
+ *                They are read on every call, so they may be changed between blocks.
+ * @param state   Filter state carried from the previous block.
+ * @param output  Filtered block, same dtype and size as @p input; may alias @p input.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument or its data is NULL.
+ * @retval VECTOR_SIZE_MISMATCH     @p input and @p output differ in size, or @p taps does not match the state.
+ * @retval VECTOR_TYPE_MISMATCH     Dtypes differ from the state's.
+ * @retval VECTOR_UNALIGNED_DATA    A vector is not aligned to its element size.
+ *
+ * @note Input and output need not be 16-byte aligned; the kernels only read the internal buffers.
+ */
+vector_status_t vec_fir(const vector_t *input, const vector_t *taps, vector_fir_state_t *state, vector_t *output);
+
+/**
+ * @brief Biquad cascade state: the prepared coefficients and the delay line of every stage and channel.
+ *
+ * Each channel is a serial recursion, so the kernels fill their lanes with channels instead: INT16
+ * runs 8 channels per ee.vmulas.s16.qacc (16-bit samples, 40-bit accumulators), FLOAT32 runs 4
+ * channels per pass over a stage's coefficients. Channels are processed in groups of that many
+ * lanes; a partial group is zero-padded, so channel counts that are a multiple of the lane count
+ * waste nothing. With exactly one group and 16-byte aligned data the interleaved block is filtered
+ * in place without staging.
+ *
+ * Initialise with ::vector_biquad_init().
+ */
+typedef struct {
+    dtype type;                             // INT16 (Q15 samples, Q14 coefficients) or FLOAT32
+    size_t stages;                          // Second-order sections in the cascade
+    size_t channels;                        // Interleaved channels
+    size_t lanes;                           // Channels per kernel group: 8 for INT16, 4 for FLOAT32
+    void *coeffs;                           // Per stage b0, b1, b2, -a1, -a2, broadcast to the lanes for INT16; 16-byte aligned
+    void *delay;                            // Per group and stage x1, x2, y1, y2 for each lane; 16-byte aligned
+    void *work;                             // VECTOR_BIQUAD_TILE frames of one group, for staging
+} vector_biquad_state_t;
+
+/**
+ * @brief Allocate the state of a @p stages section cascade over @p channels channels, with a zeroed delay line.
+ *
+ * @param state     State to initialise.
+ * @param stages    Number of second-order sections.
+ * @param channels  Number of interleaved channels, each filtered independently with the same coefficients.
+ * @param type      DTYPE_INT16 or DTYPE_FLOAT32.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL                   @p state is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT       @p stages or @p channels is 0.
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Other dtypes.
+ * @retval VECTOR_ERROR                  Allocation failed.
+ */
+vector_status_t vector_biquad_init(vector_biquad_state_t *state, size_t stages, size_t channels, dtype type);
+
+/**
+ * @brief Free the buffers of @p state.
+ */
+void vector_biquad_deinit(vector_biquad_state_t *state);
+
+/**
+ * @brief Zero the delay line of every stage and channel.
+ */
+void vector_biquad_reset(vector_biquad_state_t *state);
+
+/**
+ * @brief Filter the next block of every channel through the cascade.
+ *
+ * Each stage computes the direct form I difference equation
+ *
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] - a1 * y[n-1] - a2 * y[n-2]
+ *
+ * and feeds the next stage. For INT16 the samples are Q15 and the coefficients Q14, so they span
+ * [-2, 2) as a1 usually needs; each stage's sum is kept at full precision, shifted right by 14
+ * (truncating) and saturated to Q15. An a1 or a2 of exactly -2.0 (-32768) saturates to just below 2.0
+ * once negated.
+ *
+ * @param input   Next block, @p channels interleaved; the size must be a multiple of the channel count.
+ * @param coeffs  5 * stages coefficients, b0, b1, b2, a1, a2 per stage (a0 normalised to 1), same dtype as the
+ *                state. They are read on every call, so they may be changed between blocks.
+ * @param state   Cascade state carried from the previous block.
+ * @param output  Filtered block, same dtype and size as @p input; may alias @p input.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument or its data is NULL.
+ * @retval VECTOR_SIZE_MISMATCH     Sizes differ, @p coeffs does not match the stage count, or the size is not whole frames.
+ * @retval VECTOR_TYPE_MISMATCH     Dtypes differ from the state's.
+ * @retval VECTOR_UNALIGNED_DATA    A vector is not aligned to its element size.
+ */
+vector_status_t vec_biquad_cascade(const vector_t *input, const vector_t *coeffs, vector_biquad_state_t *state, vector_t *output);
+
+/**
+ * @brief Cross-correlation at lags 0 to @p max_lag.
+ *
+ * Performs @p result[l] = sum over n < size - l of @p vec1[n] * @p vec2[n + l]. For negative lags, swap the inputs.
+ *
+ * @param vec1     First sequence, INT8, INT16 or FLOAT32.
+ * @param vec2     Second sequence, same dtype and size as @p vec1.
+ * @param max_lag  Largest lag, less than the sequence size.
+ * @param result   max_lag + 1 elements: INT32 for integer inputs, FLOAT32 for FLOAT32.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL                   A pointer argument or its data is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT       @p max_lag is not less than the sequence size.
+ * @retval VECTOR_SIZE_MISMATCH          The sequences differ in size, or @p result is not max_lag + 1 elements.
+ * @retval VECTOR_TYPE_MISMATCH          The sequences differ in dtype, or @p result has the wrong dtype.
+ * @retval VECTOR_UNSUPPORTED_OPERATION  Other dtypes.
+ * @retval VECTOR_UNALIGNED_DATA         A vector is not aligned to its element size.
+ * @retval VECTOR_ERROR                  The staging buffer could not be allocated.
+ *
+ * @note Integer results keep the low 32 bits of each sum, as ::vec_dotp.
+ * @note The inputs are staged into a zero-padded scratch buffer, allocated per call.
+ */
+vector_status_t vec_xcorr(const vector_t *vec1, const vector_t *vec2, size_t max_lag, vector_t *result);
+
+/**
+ * @brief Autocorrelation at lags 0 to @p max_lag, ::vec_xcorr of @p vec1 with itself.
+ */
+vector_status_t vec_autocorr(const vector_t *vec1, size_t max_lag, vector_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef VECTOR_PARALLEL_H
+#define VECTOR_PARALLEL_H
+
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Optional dual-core execution of large vector ops.
+ *
+ * By default every vec_* call runs on the calling core. After ::vector_parallel_init(), the
+ * table-dispatched element-wise ops (vec_add, vec_sub, vec_mul, the bitwise and compare ops,
+ * vec_abs, vec_neg, vec_not, vec_copy) and the reductions (vec_sum, vec_sum_f32,
+ * vec_sum_unsigned, vec_dotp, vec_dotp_f32) on vectors of at least min_size elements are split
+ * in two at a 16-byte boundary. A persistent worker task pinned to the other core runs the second
+ * half while the caller runs the first; reductions then add the two partial results (integers
+ * modulo 2^32, as the unaligned path combines its pieces). INT32 vec_sum is the exception: its
+ * four accumulator lanes saturate, so it always runs whole on the calling core.
+ *
+ * Only one split op is in flight at a time. A call that finds the worker busy (another task is
+ * already using it) simply runs on its own core, so the mode is safe to use from several tasks.
+ *
+ * On the host the worker is a pthread, so the scaling and the break-even size can be measured
+ * with the same API; see vector_bench_parallel in test/.
+ */
+
+#define VECTOR_PARALLEL_MIN_SIZE    4096    // Default split threshold in elements; set per workload after measuring
+
+/**
+ * @brief Start the worker and enable parallel mode for vectors of at least @p min_size elements.
+ *
+ * Calling it again while the worker runs only changes the threshold.
+ *
+ * @param min_size  Split threshold in elements; 0 selects ::VECTOR_PARALLEL_MIN_SIZE.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_ERROR     The worker task or its synchronisation objects could not be created.
+ */
+vector_status_t vector_parallel_init(size_t min_size);
+
+/**
+ * @brief Change the split threshold without stopping the worker.
+ *
+ * @param min_size  Split threshold in elements; 0 keeps the worker but runs every call on the calling core.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_ERROR     ::vector_parallel_init() has not been called.
+ */
+vector_status_t vector_parallel_set_min_size(size_t min_size);
+
+/**
+ * @brief Disable parallel mode and stop the worker.
+ *
+ * @pre No vec_* call and no ::vector_parallel_init() runs concurrently on another task.
+ */
+void vector_parallel_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef VECTOR_PINGPONG_H
+#define VECTOR_PINGPONG_H
+
+#include "vector.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Double-buffered ingest stage: one vector is filled by a producer while the other is processed.
+ *
+ * The stage owns two equally sized vectors. The producer (an I2S/ADC read loop or DMA callback on
+ * target, a thread or file reader on the host) writes into ::vector_pingpong_fill_buffer() and
+ * publishes it with ::vector_pingpong_commit(), which hands it to the consumer and moves the
+ * producer to the other vector. The consumer takes a published vector with
+ * ::vector_pingpong_acquire(), runs its vec_* chain on it in place and gives it back with
+ * ::vector_pingpong_release(). Vectors change hands by pointer only; no data is ever copied.
+ *
+ *     vector_pingpong_t stage;
+ *     vector_pingpong_init(&stage, 512, DTYPE_INT16, VECTOR_PLACEMENT_DMA);
+ *     vector_pingpong_start_producer(&stage, read_i2s_block, i2s_handle);
+ *     for (;;) {
+ *         vector_pingpong_process(&stage, filter_and_detect, &detector);   // No-op until a block is ready
+ *     }
+ *
+ * Ownership is tracked with one atomic state word per vector, so commit, acquire and release are
+ * lock-free and commit may be called from an ISR. There must be one producer and one consumer, and
+ * the consumer holds at most one vector at a time. If the consumer falls behind, the producer keeps
+ * going and the oldest unprocessed block is overwritten; ::vector_pingpong_t::overruns counts them.
+ */
+
+typedef enum {
+    VECTOR_PINGPONG_FREE,                   // Waiting for the producer
+    VECTOR_PINGPONG_FILLING,                // Owned by the producer
+    VECTOR_PINGPONG_READY,                  // Published, waiting for the consumer
+    VECTOR_PINGPONG_PROCESSING              // Owned by the consumer
+} vector_pingpong_state_t;
+
+/**
+ * @brief Fills @p buffer with the next block. Returning anything but VECTOR_SUCCESS stops the producer task.
+ */
+typedef vector_status_t (*vector_pingpong_producer_t)(vector_t *buffer, void *ctx);
+
+/**
+ * @brief Processes one block in place.
+ */
+typedef vector_status_t (*vector_pingpong_consumer_t)(vector_t *buffer, void *ctx);
+
+typedef struct {
+    vector_t *buffers[2];                   // The two blocks, allocated by vector_pingpong_init()
+    volatile uint32_t state[2];             // vector_pingpong_state_t of each block, changed atomically
+    volatile uint32_t seq[2];               // Commit number of each block, so the older of two ready blocks goes first
+    uint32_t fill;                          // Index of the block the producer owns; producer only
+    volatile uint32_t commits;              // Blocks published
+    volatile uint32_t overruns;             // Published blocks overwritten before the consumer took them
+    volatile uint32_t processed;            // Blocks released by the consumer
+    void *producer;                         // Producer task state, NULL unless started
+} vector_pingpong_t;
+
+/**
+ * @brief Allocate both blocks and hand the first to the producer.
+ *
+ * @param pp         Stage to initialise.
+ * @param size       Elements per block.
+ * @param type       Element dtype.
+ * @param placement  vector_placement_t flags for the blocks, e.g. VECTOR_PLACEMENT_DMA when a DMA engine writes them.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p pp is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p size is 0.
+ * @retval VECTOR_ERROR             Allocation failed, or @p type or @p placement is invalid.
+ */
+vector_status_t vector_pingpong_init(vector_pingpong_t *pp, size_t size, dtype type, uint32_t placement);
+
+/**
+ * @brief Stop the producer task if running and free both blocks.
+ */
+void vector_pingpong_deinit(vector_pingpong_t *pp);
+
+/**
+ * @brief Producer: the block to write next. Stays the same until ::vector_pingpong_commit().
+ */
+vector_t *vector_pingpong_fill_buffer(vector_pingpong_t *pp);
+
+/**
+ * @brief Producer: publish the filled block and move on to the other one.
+ *
+ * Never blocks. If the consumer has not taken the previous block yet, that block is overwritten next;
+ * if the consumer is still processing it, the block just published is reclaimed and overwritten instead.
+ * Either way ::vector_pingpong_t::overruns is incremented.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL  @p pp is NULL.
+ */
+vector_status_t vector_pingpong_commit(vector_pingpong_t *pp);
+
+/**
+ * @brief Consumer: take the oldest published block.
+ *
+ * @return The block, now owned by the consumer, or NULL if none is ready or the consumer already holds one.
+ */
+vector_t *vector_pingpong_acquire(vector_pingpong_t *pp);
+
+/**
+ * @brief Consumer: give a block taken with ::vector_pingpong_acquire() back to the producer.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p buffer is not a block of @p pp held by the consumer.
+ */
+vector_status_t vector_pingpong_release(vector_pingpong_t *pp, vector_t *buffer);
+
+/**
+ * @brief Consumer: if a block is ready, run @p fn on it and release it.
+ *
+ * @retval VECTOR_SUCCESS   A block was processed, or none was ready (see ::vector_pingpong_t::processed).
+ * @retval VECTOR_NULL      A pointer argument is NULL.
+ * @retval others           The status returned by @p fn; the block is released either way.
+ */
+vector_status_t vector_pingpong_process(vector_pingpong_t *pp, vector_pingpong_consumer_t fn, void *ctx);
+
+/**
+ * @brief Run @p fn in a loop on a producer task (FreeRTOS on target, a pthread on the host),
+ *        committing each block it fills, until @p fn fails or ::vector_pingpong_stop_producer().
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  A producer task is already running.
+ * @retval VECTOR_ERROR             The task could not be created.
+ */
+vector_status_t vector_pingpong_start_producer(vector_pingpong_t *pp, vector_pingpong_producer_t fn, void *ctx);
+
+/**
+ * @brief Stop the producer task and wait for it to exit. Its partially filled block is not published.
+ */
+void vector_pingpong_stop_producer(vector_pingpong_t *pp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
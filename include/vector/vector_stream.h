@@ -0,0 +1,111 @@
+#ifndef VECTOR_STREAM_H
+#define VECTOR_STREAM_H
+
+#include "vector.h"
+#include <stdalign.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Streaming reductions over inputs delivered in chunks.
+ *
+ * vec_sum, vec_dotp and friends need the whole input in one vector_t. A vector_stream_t instead
+ * carries the running sum, dot product and min/max of an unbounded stream, so audio or vibration
+ * data can be reduced block by block as DMA delivers it:
+ *
+ *     vector_stream_t stream;
+ *     vector_stream_begin(&stream, DTYPE_INT16, VECTOR_STREAM_SUM | VECTOR_STREAM_MINMAX);
+ *     while (next_dma_block(&block)) {
+ *         vector_stream_update(&stream, &block, NULL);         // Any size, any element-aligned address
+ *     }
+ *     vector_stream_finish(&stream);                           // stream.sum, stream.min, stream.max
+ *
+ * Chunks may have any length. Elements that do not fill a 16-byte block are held back in the
+ * stream and completed by the next chunk, so the kernels only ever see whole blocks and the scalar
+ * tail runs once per stream, at ::vector_stream_finish(). Signed chunks are reduced with
+ * vec_sum_i64 / vec_dotp_i64. Unsigned chunks are summed with vec_sum_unsigned in slices too short
+ * to wrap (UINT8 / UINT16) or widened element by element (UINT32), so integer chunks of any size
+ * are exact. Partials are accumulated in 64 bits (integers) or double (FLOAT32). Min and max are
+ * kept per lane in VECTOR_STREAM_LANES bytes with the vec_min / vec_max kernels and folded at the end.
+ */
+
+#define VECTOR_STREAM_SUM       (1u << 0)   // Accumulate the sum of the first input
+#define VECTOR_STREAM_DOTP      (1u << 1)   // Accumulate the dot product of both inputs
+#define VECTOR_STREAM_MINMAX    (1u << 2)   // Track the minimum and maximum of the first input
+
+#define VECTOR_STREAM_LANES     256         // Bytes of per-lane min/max state; a multiple of 16
+
+/**
+ * @brief State of a streaming reduction. Read the results after ::vector_stream_finish().
+ *
+ * Must be 16-byte aligned, which the compiler guarantees for static and automatic storage.
+ */
+typedef struct {
+    dtype type;                             // Dtype of every chunk
+    uint32_t stats;                         // VECTOR_STREAM_* flags being accumulated
+    uint64_t count;                         // Elements consumed, including those still held back
+    int64_t sum;                            // Integer dtypes
+    int64_t dotp;                           // Signed integer dtypes
+    double sum_f32;                         // FLOAT32
+    double dotp_f32;                        // FLOAT32
+    int64_t min;                            // Integer dtypes, valid if count > 0
+    int64_t max;
+    float min_f32;                          // FLOAT32, valid if count > 0; NaN if any sample was NaN
+    float max_f32;
+    size_t carry;                           // Elements held back in carry_a / carry_b, less than one block
+    alignas(16) uint8_t carry_a[16];
+    alignas(16) uint8_t carry_b[16];
+    alignas(16) uint8_t lane_min[VECTOR_STREAM_LANES];
+    alignas(16) uint8_t lane_max[VECTOR_STREAM_LANES];
+} vector_stream_t;
+
+/**
+ * @brief Start a streaming reduction.
+ *
+ * @param stream  State to initialise.
+ * @param type    Dtype of the chunks.
+ * @param stats   Non-empty combination of VECTOR_STREAM_SUM, VECTOR_STREAM_DOTP and VECTOR_STREAM_MINMAX.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL                   @p stream is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT       @p stats is empty or has unknown flags.
+ * @retval VECTOR_TYPE_MISMATCH          Invalid dtype.
+ * @retval VECTOR_UNALIGNED_DATA         @p stream is not 16-byte aligned.
+ * @retval VECTOR_UNSUPPORTED_OPERATION  VECTOR_STREAM_DOTP on an unsigned dtype, as vec_dotp.
+ * @retval VECTOR_NOT_IMPLEMENTED        VECTOR_STREAM_MINMAX on a dtype without vec_min / vec_max kernels.
+ */
+vector_status_t vector_stream_begin(vector_stream_t *stream, dtype type, uint32_t stats);
+
+/**
+ * @brief Feed the next chunk.
+ *
+ * @param stream  Started stream.
+ * @param a       Next chunk, any size and any element-aligned address.
+ * @param b       Matching chunk of the second input for VECTOR_STREAM_DOTP, same size as @p a;
+ *                ignored (may be NULL) otherwise. Pass @p a again for the energy of @p a.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A required pointer is NULL.
+ * @retval VECTOR_SIZE_MISMATCH     @p a and @p b differ in size.
+ * @retval VECTOR_TYPE_MISMATCH     A chunk's dtype differs from the stream's.
+ * @retval VECTOR_UNALIGNED_DATA    A chunk is not aligned to its element size.
+ */
+vector_status_t vector_stream_update(vector_stream_t *stream, const vector_t *a, const vector_t *b);
+
+/**
+ * @brief Reduce the held-back elements and fold the min/max lanes into the result fields.
+ *
+ * The stream can be fed again afterwards; call this again to refresh the results.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL      @p stream is NULL.
+ */
+vector_status_t vector_stream_finish(vector_stream_t *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
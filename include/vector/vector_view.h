@@ -0,0 +1,167 @@
+#ifndef VECTOR_VIEW_H
+#define VECTOR_VIEW_H
+
+#include "vector.h"
+#include "vector_dispatch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Strided, zero-copy views into a vector_t.
+ *
+ * A vector_view_t selects every stride-th element of a vector, starting at an offset, so a sub-range
+ * or one channel of interleaved data (stereo L/R, accelerometer x/y/z) can be processed in place:
+ *
+ *     vector_view_t axes[3];
+ *     vector_view_deinterleave(xyz_samples, 3, axes);          // Packed [x y z x y z ...]
+ *     vec_view_sum(&axes[0], &sum_x);
+ *     vec_view_binary(VECTOR_OP_SUB, &axes[1], &offsets_y, &axes[1], 0);
+ *
+ * Views with stride 1 run on the SIMD kernels directly (through the unaligned path if the offset
+ * breaks 16-byte alignment). Other strides move VECTOR_VIEW_TILE elements at a time between the view
+ * and an aligned scratch tile around the same kernels, with unrolled loops for strides 2, 3 and 4.
+ */
+
+#define VECTOR_VIEW_TILE        256     // Elements per scratch tile of strided views; a multiple of 16
+
+/**
+ * @brief A strided selection of elements of a vector buffer. Never owns its data.
+ */
+typedef struct {
+    void *data;                         // First element, aligned to the element size
+    dtype type;                         // Data type of the elements
+    size_t size;                        // Number of elements in the view
+    size_t stride;                      // Elements between neighbours in the view, at least 1
+} vector_view_t;
+
+/**
+ * @brief View @p length elements of @p vec, @p stride apart, starting at element @p offset.
+ *
+ * @param vec     Vector to view; must outlive the view.
+ * @param offset  Index of the first element.
+ * @param length  Number of elements in the view, at least 1.
+ * @param stride  Elements between neighbours, at least 1.
+ * @param out     View to fill in.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument or @p vec->data is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p length or @p stride is 0, or the view runs past the end of @p vec.
+ * @retval VECTOR_TYPE_MISMATCH     Invalid dtype.
+ */
+vector_status_t vector_view(const vector_t *vec, size_t offset, size_t length, size_t stride, vector_view_t *out);
+
+/**
+ * @brief Split interleaved data into one view per channel.
+ *
+ * @param vec       Interleaved vector, size a multiple of @p channels.
+ * @param channels  Number of interleaved channels, at least 1.
+ * @param views     Array of @p channels views; views[c] selects elements c, c + channels, ...
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument or @p vec->data is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p channels is 0.
+ * @retval VECTOR_SIZE_MISMATCH     @p vec->size is not a non-zero multiple of @p channels.
+ * @retval VECTOR_TYPE_MISMATCH     Invalid dtype.
+ */
+vector_status_t vector_view_deinterleave(const vector_t *vec, size_t channels, vector_view_t *views);
+
+/**
+ * @brief Express a stride-1 view as a vector_t, for use with any vec_* function that accepts unaligned data.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              @p view or @p out is NULL.
+ * @retval VECTOR_INVALID_ARGUMENT  @p view->stride is not 1.
+ */
+vector_status_t vector_view_as_vector(const vector_view_t *view, vector_t *out);
+
+/**
+ * @brief Copy a view into a dense vector.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL              A pointer argument is NULL.
+ * @retval VECTOR_SIZE_MISMATCH     Sizes differ.
+ * @retval VECTOR_TYPE_MISMATCH     Dtypes differ.
+ */
+vector_status_t vec_view_gather(const vector_view_t *view, vector_t *dense);
+
+/**
+ * @brief Copy a dense vector into the elements of a view, e.g. to re-interleave a processed channel.
+ *
+ * @retval As ::vec_view_gather().
+ */
+vector_status_t vec_view_scatter(const vector_t *dense, const vector_view_t *view);
+
+/**
+ * @brief Element-wise binary op on views, as the matching vec_* wrapper computes it.
+ *
+ * @p result may be the same view as an operand. Distinct views must not overlap partially.
+ *
+ * @param op            Binary op.
+ * @param a             Left operand.
+ * @param b             Right operand.
+ * @param result        Output view.
+ * @param shift_amount  Post-shift for ::VECTOR_OP_MUL; must be 0 for every other op.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_ERROR     Tile scratch allocation failed.
+ * @retval others           As ::vec_prepare_binary().
+ */
+vector_status_t vec_view_binary(vector_binary_op_t op, const vector_view_t *a, const vector_view_t *b,
+                                const vector_view_t *result, unsigned int shift_amount);
+
+/**
+ * @brief Element-wise unary op on views, as the matching vec_* wrapper computes it.
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_ERROR     Tile scratch allocation failed.
+ * @retval others           As ::vec_prepare_unary().
+ */
+vector_status_t vec_view_unary(vector_unary_op_t op, const vector_view_t *a, const vector_view_t *result);
+
+/**
+ * @brief Sum of a view's elements, as ::vec_sum().
+ *
+ * @retval VECTOR_SUCCESS
+ * @retval VECTOR_NULL      A pointer argument is NULL.
+ * @retval VECTOR_ERROR     Tile scratch allocation failed.
+ * @retval others           As ::vec_sum().
+ */
+vector_status_t vec_view_sum(const vector_view_t *view, int32_t *result);
+
+/**
+ * @brief Sum of a view's elements, as ::vec_sum_f32().
+ *
+ * @retval As ::vec_view_sum(), with the codes of ::vec_sum_f32().
+ */
+vector_status_t vec_view_sum_f32(const vector_view_t *view, float *result);
+
+/**
+ * @brief Sum of a view's elements, as ::vec_sum_unsigned().
+ *
+ * @retval As ::vec_view_sum(), with the codes of ::vec_sum_unsigned().
+ */
+vector_status_t vec_view_sum_unsigned(const vector_view_t *view, uint32_t *result);
+
+/**
+ * @brief Dot product of two views of the same size, as ::vec_dotp().
+ *
+ * @retval VECTOR_SIZE_MISMATCH  Sizes differ.
+ * @retval VECTOR_TYPE_MISMATCH  Dtypes differ.
+ * @retval others                As ::vec_view_sum(), with the codes of ::vec_dotp().
+ */
+vector_status_t vec_view_dotp(const vector_view_t *a, const vector_view_t *b, int32_t *result);
+
+/**
+ * @brief Dot product of two views of the same size, as ::vec_dotp_f32().
+ *
+ * @retval As ::vec_view_dotp(), with the codes of ::vec_dotp_f32().
+ */
+vector_status_t vec_view_dotp_f32(const vector_view_t *a, const vector_view_t *b, float *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+#include "matrix.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+
+static bool dtype_valid(dtype type) {
+    return type >= DTYPE_INT8 && type <= DTYPE_UINT32;
+}
+
+matrix_t *matrix_create(size_t rows, size_t cols, dtype type) {
+    if (!dtype_valid(type)) { return NULL;}
+    if (rows == 0 || cols == 0) { return NULL;}
+
+    matrix_t *mat = malloc(sizeof(matrix_t));
+    if (!mat) { return NULL;}
+
+    size_t stride = matrix_min_stride(cols, type);
+    size_t bytes = rows * stride * sizeof_dtype(type);
+    mat->data = heap_caps_aligned_alloc(16, bytes, MALLOC_CAP_DEFAULT);                    // Allocate aligned memory for the data array
+    if (!mat->data) {
+        free(mat);
+        return NULL;
+    }
+    memset(mat->data, 0, bytes);                                                            // Keeps row padding deterministic
+
+    mat->type = type;
+    mat->rows = rows;
+    mat->cols = cols;
+    mat->stride = stride;
+    mat->owns_data = true;                                                                  // Indicates that this matrix_t owns the data
+    return mat;
+}
+
+vector_status_t matrix_ok(const matrix_t *mat) {
+    if (!mat || !mat->data) { return VECTOR_NULL;}                                          // Matrix or data pointer is NULL
+    if (!dtype_valid(mat->type)) { return VECTOR_TYPE_MISMATCH;}                            // Invalid Type
+    if (mat->stride < mat->cols) { return VECTOR_SIZE_MISMATCH;}                            // Rows overlap
+    if ((uintptr_t)mat->data & 0xF) { return VECTOR_UNALIGNED_DATA;}                        // Data not 128-bit aligned
+    if ((mat->stride * sizeof_dtype(mat->type)) & 0xF) { return VECTOR_UNALIGNED_DATA;}     // Rows not 128-bit aligned
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t matrix_free_data(matrix_t *mat) {
+    if (mat && mat->owns_data) {
+        if (mat->data) {
+            heap_caps_free(mat->data);
+            mat->data = NULL;
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t matrix_destroy(matrix_t *mat) {
+    matrix_free_data(mat);
+    free(mat);
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t matrix_set(matrix_t *mat, void *data, size_t rows, size_t cols, size_t stride, dtype type, bool owns_data) {
+    if (!mat) { return VECTOR_NULL; }
+    if (!data) { return VECTOR_NULL; }
+    if (!dtype_valid(type)) { return VECTOR_TYPE_MISMATCH; }                                // Invalid Type
+    if (stride < cols) { return VECTOR_SIZE_MISMATCH; }
+    if ((uintptr_t)data & 0xF) { return VECTOR_UNALIGNED_DATA; }                            // Data not 128-bit aligned
+    if ((stride * sizeof_dtype(type)) & 0xF) { return VECTOR_UNALIGNED_DATA; }              // Rows not 128-bit aligned
+
+    mat->data = data;
+    mat->type = type;
+    mat->rows = rows;
+    mat->cols = cols;
+    mat->stride = stride;
+    mat->owns_data = owns_data;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t matrix_row(const matrix_t *mat, size_t row, vector_t *out) {
+    if (!mat || !out) { return VECTOR_NULL;}
+    if (row >= mat->rows) { return VECTOR_INVALID_ARGUMENT;}
+    out->data = (uint8_t*)mat->data + row * mat->stride * sizeof_dtype(mat->type);
+    out->type = mat->type;
+    out->size = mat->cols;
+    out->owns_data = false;                                                                 // View into the matrix buffer
+    return VECTOR_SUCCESS;
+}
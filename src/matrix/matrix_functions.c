@@ -0,0 +1,209 @@
+#include "matrix_functions.h"
+#include "simd_functions.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+/**
+ * Blocking parameters. GEMM_KC elements of a row form one dot-product segment; it is a multiple
+ * of 16 so every segment of an aligned row stays 16-byte aligned for the SIMD loads. GEMM_NR
+ * columns of B are packed per panel so mat_mul() reads B once, row by row, and GEMM_MR rows of A
+ * are swept across each panel. FLOAT32 outputs are computed 2 x 2 per simd_gemm_2x2_f32() call,
+ * which loads each A and B segment once for two outputs. The integer paths make one dot product
+ * per output: the PIE MACs reduce a whole row only into ACCX, so there is no second accumulator.
+ */
+#define GEMM_KC 256
+#define GEMM_MR 4
+#define GEMM_NR 8
+
+typedef int (*gemm_dot_i32_fn)(const void *a, const void *b, int32_t *result, size_t size);
+
+static int dotp_i8_thunk(const void *a, const void *b, int32_t *result, size_t size) {
+    return simd_dotp_i8((const int8_t*)a, (const int8_t*)b, result, size);
+}
+
+static int dotp_i16_thunk(const void *a, const void *b, int32_t *result, size_t size) {
+    return simd_dotp_i16((const int16_t*)a, (const int16_t*)b, result, size);
+}
+
+static inline const uint8_t *row_ptr(const matrix_t *mat, size_t row) {
+    return (const uint8_t*)mat->data + row * mat->stride * sizeof_dtype(mat->type);
+}
+
+static vector_status_t gemm_check(const matrix_t *a, const matrix_t *b, const matrix_t *result) {
+    if (a->type != b->type) { return VECTOR_TYPE_MISMATCH;}
+    switch (a->type) {
+        case DTYPE_INT8:
+        case DTYPE_INT16:
+            if (result->type != DTYPE_INT32) { return VECTOR_TYPE_MISMATCH;}
+            return VECTOR_SUCCESS;
+        case DTYPE_FLOAT32:
+            if (result->type != DTYPE_FLOAT32) { return VECTOR_TYPE_MISMATCH;}
+            return VECTOR_SUCCESS;
+        case DTYPE_INT32:
+        case DTYPE_UINT8:
+        case DTYPE_UINT16:
+        case DTYPE_UINT32:
+            return VECTOR_UNSUPPORTED_OPERATION;
+        default:
+            return VECTOR_ERROR;
+    }
+}
+
+/**
+ * C[:, col0 .. col0 + bt->rows) = A x bt^T for integer inputs. Partial dot products of each
+ * K block are added with 32-bit wrap-around, which gives the same result as one full-length dot.
+ */
+static void gemm_bt_i32(const matrix_t *a, const matrix_t *bt, matrix_t *c, size_t col0, gemm_dot_i32_fn dot) {
+    const size_t elem = sizeof_dtype(a->type);
+    const size_t k = a->cols;
+    for (size_t kb = 0; kb < k; kb += GEMM_KC) {
+        const size_t kc = (k - kb < GEMM_KC) ? k - kb : GEMM_KC;
+        for (size_t ib = 0; ib < a->rows; ib += GEMM_MR) {
+            const size_t ie = (ib + GEMM_MR < a->rows) ? ib + GEMM_MR : a->rows;
+            for (size_t j = 0; j < bt->rows; j++) {
+                const uint8_t *b_seg = row_ptr(bt, j) + kb * elem;
+                for (size_t i = ib; i < ie; i++) {
+                    int32_t *out = (int32_t*)row_ptr(c, i) + col0 + j;
+                    int32_t partial;
+                    dot(row_ptr(a, i) + kb * elem, b_seg, &partial, kc);
+                    *out = kb ? (int32_t)((uint32_t)*out + (uint32_t)partial) : partial;
+                }
+            }
+        }
+    }
+}
+
+// As gemm_bt_i32, with 2 x 2 blocks of outputs per kernel call; odd edge rows and columns fall back to dot products
+static void gemm_bt_f32(const matrix_t *a, const matrix_t *bt, matrix_t *c, size_t col0) {
+    const size_t k = a->cols;
+    for (size_t kb = 0; kb < k; kb += GEMM_KC) {
+        const size_t kc = (k - kb < GEMM_KC) ? k - kb : GEMM_KC;
+        for (size_t ib = 0; ib < a->rows; ib += GEMM_MR) {
+            const size_t ie = (ib + GEMM_MR < a->rows) ? ib + GEMM_MR : a->rows;
+            for (size_t j = 0; j < bt->rows; j += 2) {
+                const size_t nj = (j + 1 < bt->rows) ? 2 : 1;
+                const float *b0 = (const float*)row_ptr(bt, j) + kb;
+                const float *b1 = (nj == 2) ? b0 + bt->stride : b0;
+                for (size_t i = ib; i < ie; i += 2) {
+                    const size_t ni = (i + 1 < ie) ? 2 : 1;
+                    const float *a0 = (const float*)row_ptr(a, i) + kb;
+                    const float *a1 = (ni == 2) ? a0 + a->stride : a0;
+                    float partial[4];                                                       // a0.b0, a0.b1, a1.b0, a1.b1
+                    if (ni == 2 && nj == 2) {
+                        simd_gemm_2x2_f32(a0, a1, b0, b1, partial, kc);
+                    } else {
+                        simd_dotp_f32(a0, b0, &partial[0], kc);
+                        if (nj == 2) { simd_dotp_f32(a0, b1, &partial[1], kc);}
+                        if (ni == 2) { simd_dotp_f32(a1, b0, &partial[2], kc);}
+                    }
+                    for (size_t di = 0; di < ni; di++) {
+                        for (size_t dj = 0; dj < nj; dj++) {
+                            float *out = (float*)row_ptr(c, i + di) + col0 + j + dj;
+                            *out = kb ? *out + partial[2 * di + dj] : partial[2 * di + dj];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void gemm_bt(const matrix_t *a, const matrix_t *bt, matrix_t *c, size_t col0) {
+    switch (a->type) {
+        case DTYPE_INT8:    gemm_bt_i32(a, bt, c, col0, dotp_i8_thunk);     break;
+        case DTYPE_INT16:   gemm_bt_i32(a, bt, c, col0, dotp_i16_thunk);    break;
+        case DTYPE_FLOAT32: gemm_bt_f32(a, bt, c, col0);                    break;
+        default:            break;
+    }
+}
+
+// Copies columns [col0, col0 + panel->rows) of b into the rows of panel (a transpose)
+static void pack_panel(const matrix_t *b, size_t col0, matrix_t *panel) {
+    const size_t elem = sizeof_dtype(b->type);
+    for (size_t j = 0; j < panel->rows; j++) {
+        uint8_t *dst = (uint8_t*)row_ptr(panel, j);
+        for (size_t kk = 0; kk < b->rows; kk++) {
+            memcpy(dst + kk * elem, row_ptr(b, kk) + (col0 + j) * elem, elem);
+        }
+    }
+}
+
+vector_status_t mat_mul_bt(const matrix_t *a, const matrix_t *bt, matrix_t *result) {
+    if (a->cols != bt->cols) { return VECTOR_SIZE_MISMATCH;}
+    if (result->rows != a->rows || result->cols != bt->rows) { return VECTOR_SIZE_MISMATCH;}
+    vector_status_t status = gemm_check(a, bt, result);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    gemm_bt(a, bt, result, 0);
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t mat_mul(const matrix_t *a, const matrix_t *b, matrix_t *result) {
+    if (a->cols != b->rows) { return VECTOR_SIZE_MISMATCH;}
+    if (result->rows != a->rows || result->cols != b->cols) { return VECTOR_SIZE_MISMATCH;}
+    vector_status_t status = gemm_check(a, b, result);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    matrix_t panel = {
+        .data = NULL,
+        .type = b->type,
+        .rows = GEMM_NR,
+        .cols = b->rows,
+        .stride = matrix_min_stride(b->rows, b->type),
+        .owns_data = false
+    };
+    panel.data = heap_caps_aligned_alloc(16, GEMM_NR * panel.stride * sizeof_dtype(b->type), MALLOC_CAP_DEFAULT);
+    if (!panel.data) { return VECTOR_ERROR;}
+
+    for (size_t jb = 0; jb < b->cols; jb += GEMM_NR) {
+        panel.rows = (b->cols - jb < GEMM_NR) ? b->cols - jb : GEMM_NR;
+        pack_panel(b, jb, &panel);                                                          // b is read once, panel by panel
+        gemm_bt(a, &panel, result, jb);
+    }
+
+    heap_caps_free(panel.data);
+    return VECTOR_SUCCESS;
+}
+
+static vector_status_t gemv_check(const matrix_t *weights, const vector_t *input, const vector_t *result) {
+    if (input->size != weights->cols || result->size != weights->rows) { return VECTOR_SIZE_MISMATCH;}
+    if (weights->type != DTYPE_INT8) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (input->type != DTYPE_INT8) { return VECTOR_TYPE_MISMATCH;}
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vec_gemv(const matrix_t *weights, const vector_t *input, vector_t *result) {
+    vector_status_t status = gemv_check(weights, input, result);
+    if (status != VECTOR_SUCCESS) { return status;}
+    if (result->type != DTYPE_INT32) { return VECTOR_TYPE_MISMATCH;}
+
+    return simd_gemv_i8((const int8_t*)weights->data, (const int8_t*)input->data, (int32_t*)result->data,
+                        weights->rows, weights->cols, weights->stride);
+}
+
+vector_status_t vec_gemv_requant(const matrix_t *weights, const vector_t *input, const vector_t *bias, vector_t *result, unsigned int shift_amount) {
+    vector_status_t status = gemv_check(weights, input, result);
+    if (status != VECTOR_SUCCESS) { return status;}
+    if (bias && bias->size != weights->rows) { return VECTOR_SIZE_MISMATCH;}
+    if (bias && bias->type != DTYPE_INT32) { return VECTOR_TYPE_MISMATCH;}
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+
+    int32_t lo, hi;
+    switch (result->type) {
+        case DTYPE_INT8:    lo = INT8_MIN;  hi = INT8_MAX;  break;
+        case DTYPE_INT16:   lo = INT16_MIN; hi = INT16_MAX; break;
+        case DTYPE_INT32:   lo = INT32_MIN; hi = INT32_MAX; break;
+        default:            return VECTOR_TYPE_MISMATCH;
+    }
+
+    const simd_gemv_requant_t requant = {
+        .stride = weights->stride,
+        .bias   = bias ? (const int32_t*)bias->data : NULL,
+        .shift  = shift_amount,
+        .lo     = lo,
+        .hi     = hi,
+        .elem   = (uint32_t)sizeof_dtype(result->type),
+    };
+    return simd_gemv_requant_i8((const int8_t*)weights->data, (const int8_t*)input->data, result->data,
+                                weights->rows, weights->cols, &requant);
+}
@@ -0,0 +1,112 @@
+#include "tensor.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+
+static bool dtype_valid(dtype type) {
+    return type >= DTYPE_INT8 && type <= DTYPE_UINT32;
+}
+
+// Row-major strides for shape; unused axes get extent 1 and stride 0
+static void tensor_set_shape(tensor_t *tensor, size_t ndim, const size_t *shape) {
+    size_t stride = 1;
+    tensor->ndim = ndim;
+    for (size_t i = TENSOR_MAX_DIMS; i-- > 0;) {
+        if (i < ndim) {
+            tensor->shape[i] = shape[i];
+            tensor->strides[i] = stride;
+            stride *= shape[i];
+        } else {
+            tensor->shape[i] = 1;
+            tensor->strides[i] = 0;
+        }
+    }
+}
+
+tensor_t *tensor_create(size_t ndim, const size_t *shape, dtype type) {
+    if (!dtype_valid(type)) { return NULL;}
+    if (!shape || ndim == 0 || ndim > TENSOR_MAX_DIMS) { return NULL;}
+    for (size_t i = 0; i < ndim; i++) {
+        if (shape[i] == 0) { return NULL;}
+    }
+
+    tensor_t *tensor = malloc(sizeof(tensor_t));
+    if (!tensor) { return NULL;}
+
+    tensor_set_shape(tensor, ndim, shape);
+    size_t bytes = tensor_numel(tensor) * sizeof_dtype(type);
+    tensor->data = heap_caps_aligned_alloc(16, bytes, MALLOC_CAP_DEFAULT);                  // Allocate aligned memory for the data array
+    if (!tensor->data) {
+        free(tensor);
+        return NULL;
+    }
+    memset(tensor->data, 0, bytes);
+
+    tensor->type = type;
+    tensor->owns_data = true;                                                               // Indicates that this tensor_t owns the data
+    return tensor;
+}
+
+vector_status_t tensor_ok(const tensor_t *tensor) {
+    if (!tensor || !tensor->data) { return VECTOR_NULL;}                                    // Tensor or data pointer is NULL
+    if (!dtype_valid(tensor->type)) { return VECTOR_TYPE_MISMATCH;}                         // Invalid Type
+    if (tensor->ndim == 0 || tensor->ndim > TENSOR_MAX_DIMS) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < tensor->ndim; i++) {
+        if (tensor->shape[i] == 0) { return VECTOR_SIZE_MISMATCH;}                          // Empty axis
+    }
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t tensor_free_data(tensor_t *tensor) {
+    if (tensor && tensor->owns_data) {
+        if (tensor->data) {
+            heap_caps_free(tensor->data);
+            tensor->data = NULL;
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t tensor_destroy(tensor_t *tensor) {
+    tensor_free_data(tensor);
+    free(tensor);
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t tensor_from_vector(const vector_t *vec, size_t ndim, const size_t *shape, tensor_t *out) {
+    if (!vec || !shape || !out) { return VECTOR_NULL;}
+    if (ndim == 0 || ndim > TENSOR_MAX_DIMS) { return VECTOR_INVALID_ARGUMENT;}
+
+    tensor_t view;
+    tensor_set_shape(&view, ndim, shape);
+    if (tensor_numel(&view) != vec->size) { return VECTOR_SIZE_MISMATCH;}
+
+    view.data = vec->data;
+    view.type = vec->type;
+    view.owns_data = false;                                                                 // View into the vector buffer
+    *out = view;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t tensor_slice(const tensor_t *src, size_t axis, size_t start, size_t stop, size_t step, tensor_t *out) {
+    if (!src || !out) { return VECTOR_NULL;}
+    if (axis >= src->ndim || step == 0) { return VECTOR_INVALID_ARGUMENT;}
+    if (start >= stop || stop > src->shape[axis]) { return VECTOR_INVALID_ARGUMENT;}
+
+    tensor_t view = *src;
+    view.data = (uint8_t*)src->data + start * src->strides[axis] * sizeof_dtype(src->type);
+    view.shape[axis] = (stop - start + step - 1) / step;
+    view.strides[axis] = src->strides[axis] * step;
+    view.owns_data = false;                                                                 // View into the source buffer
+    *out = view;
+    return VECTOR_SUCCESS;
+}
+
+bool tensor_is_contiguous(const tensor_t *tensor) {
+    size_t expected = 1;
+    for (size_t i = tensor->ndim; i-- > 0;) {
+        if (tensor->shape[i] != 1 && tensor->strides[i] != expected) { return false;}     // Extent-1 axes never move the pointer
+        expected *= tensor->shape[i];
+    }
+    return true;
+}
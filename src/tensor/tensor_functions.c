@@ -0,0 +1,192 @@
+#include "tensor_functions.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+/**
+ * Elements per scratch chunk. A multiple of 16 so that, for every dtype, a chunk boundary inside
+ * an aligned run stays 16-byte aligned. Three chunks (a, b, result) bound the scratch at 3 KiB.
+ */
+#define TENSOR_CHUNK 256
+
+// One broadcast-resolved axis: extent plus the stride of each operand (0 where broadcast)
+typedef struct {
+    size_t shape;
+    size_t stride_a;
+    size_t stride_b;
+    size_t stride_r;
+} tensor_axis_t;
+
+typedef struct {
+    vector_binary_kernel_t kernel;
+    unsigned int shift_amount;
+    size_t elem;
+    uint8_t *scratch;               // TENSOR_CHUNK elements each for a, b and result; allocated on first use
+} tensor_run_t;
+
+static inline bool aligned16(const void *ptr) {
+    return ((uintptr_t)ptr & 0xF) == 0;
+}
+
+// Stride of operand axis matching result axis j, or SIZE_MISMATCH if it does not broadcast
+static vector_status_t broadcast_stride(const tensor_t *t, const tensor_t *result, size_t j, size_t *stride) {
+    size_t lead = result->ndim - t->ndim;
+    if (j < lead) { *stride = 0; return VECTOR_SUCCESS;}                                    // Missing leading axis
+    size_t axis = j - lead;
+    if (t->shape[axis] == result->shape[j]) { *stride = t->strides[axis]; return VECTOR_SUCCESS;}
+    if (t->shape[axis] == 1) { *stride = 0; return VECTOR_SUCCESS;}                         // Repeated along this axis
+    return VECTOR_SIZE_MISMATCH;
+}
+
+/**
+ * Resolves broadcasting into axes[] (outermost first), dropping extent-1 axes and merging each
+ * axis into its outer neighbour when that neighbour is contiguous with it in all three tensors.
+ * Returns the number of axes left, at least 1.
+ */
+static vector_status_t tensor_axes(const tensor_t *a, const tensor_t *b, const tensor_t *result, tensor_axis_t *axes, size_t *naxes) {
+    size_t n = 0;
+    for (size_t j = 0; j < result->ndim; j++) {
+        tensor_axis_t axis = { .shape = result->shape[j], .stride_r = result->strides[j] };
+        vector_status_t status = broadcast_stride(a, result, j, &axis.stride_a);
+        if (status != VECTOR_SUCCESS) { return status;}
+        status = broadcast_stride(b, result, j, &axis.stride_b);
+        if (status != VECTOR_SUCCESS) { return status;}
+        if (axis.shape == 1) { continue;}
+
+        if (n > 0) {
+            tensor_axis_t *outer = &axes[n - 1];
+            if (outer->stride_a == axis.stride_a * axis.shape &&
+                outer->stride_b == axis.stride_b * axis.shape &&
+                outer->stride_r == axis.stride_r * axis.shape) {
+                outer->shape *= axis.shape;                                                 // Outer axis steps over exactly one inner run
+                outer->stride_a = axis.stride_a;
+                outer->stride_b = axis.stride_b;
+                outer->stride_r = axis.stride_r;
+                continue;
+            }
+        }
+        axes[n++] = axis;
+    }
+    if (n == 0) {                                                                           // Single element
+        axes[n++] = (tensor_axis_t){ .shape = 1, .stride_a = 1, .stride_b = 1, .stride_r = 1 };
+    }
+    *naxes = n;
+    return VECTOR_SUCCESS;
+}
+
+// Copies count elements spaced stride apart into dst; stride 0 repeats one element
+static void gather(uint8_t *dst, const uint8_t *src, size_t stride, size_t count, size_t elem) {
+    for (size_t i = 0; i < count; i++) {
+        memcpy(dst + i * elem, src + i * stride * elem, elem);
+    }
+}
+
+static void scatter(uint8_t *dst, const uint8_t *src, size_t stride, size_t count, size_t elem) {
+    for (size_t i = 0; i < count; i++) {
+        memcpy(dst + i * stride * elem, src + i * elem, elem);
+    }
+}
+
+/**
+ * One innermost run of len elements. Dense, aligned runs go straight to the kernel; otherwise
+ * each operand that is not dense and aligned is staged through its scratch chunk.
+ */
+static vector_status_t tensor_run(tensor_run_t *run, const tensor_axis_t *axis, const uint8_t *pa, const uint8_t *pb, uint8_t *pr) {
+    const size_t elem = run->elem;
+    const size_t len = axis->shape;
+    const bool direct_a = axis->stride_a == 1 && aligned16(pa);
+    const bool direct_b = axis->stride_b == 1 && aligned16(pb);
+    const bool direct_r = axis->stride_r == 1 && aligned16(pr);
+
+    if (direct_a && direct_b && direct_r) {
+        return (vector_status_t)run->kernel(pa, pb, pr, run->shift_amount, len);
+    }
+
+    if (!run->scratch) {
+        run->scratch = heap_caps_aligned_alloc(16, 3 * TENSOR_CHUNK * elem, MALLOC_CAP_DEFAULT);
+        if (!run->scratch) { return VECTOR_ERROR;}
+    }
+    uint8_t *sa = run->scratch;
+    uint8_t *sb = sa + TENSOR_CHUNK * elem;
+    uint8_t *sr = sb + TENSOR_CHUNK * elem;
+
+    const size_t first = len < TENSOR_CHUNK ? len : TENSOR_CHUNK;
+    if (axis->stride_a == 0) { gather(sa, pa, 0, first, elem);}                            // Repeated operands are filled once per run
+    if (axis->stride_b == 0) { gather(sb, pb, 0, first, elem);}
+
+    for (size_t i = 0; i < len; i += TENSOR_CHUNK) {
+        const size_t count = (len - i < TENSOR_CHUNK) ? len - i : TENSOR_CHUNK;
+        const uint8_t *ca = direct_a ? pa + i * elem : sa;
+        const uint8_t *cb = direct_b ? pb + i * elem : sb;
+        uint8_t *cr = direct_r ? pr + i * elem : sr;
+        if (!direct_a && axis->stride_a) { gather(sa, pa + i * axis->stride_a * elem, axis->stride_a, count, elem);}
+        if (!direct_b && axis->stride_b) { gather(sb, pb + i * axis->stride_b * elem, axis->stride_b, count, elem);}
+
+        vector_status_t status = (vector_status_t)run->kernel(ca, cb, cr, run->shift_amount, count);
+        if (status != VECTOR_SUCCESS) { return status;}
+
+        if (!direct_r) { scatter(pr + i * axis->stride_r * elem, sr, axis->stride_r, count, elem);}
+    }
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t tensor_binary(vector_binary_op_t op, const tensor_t *a, const tensor_t *b, tensor_t *result, unsigned int shift_amount) {
+    if (!a || !b || !result) { return VECTOR_NULL;}
+    if (result->ndim == 0 || result->ndim > TENSOR_MAX_DIMS) { return VECTOR_INVALID_ARGUMENT;}
+    if (a->ndim > result->ndim || b->ndim > result->ndim) { return VECTOR_INVALID_ARGUMENT;}
+
+    // Validates op, dtypes and shift exactly as the vec_* wrappers do
+    vector_t tmpl_a = { .data = a->data, .type = a->type, .size = 1, .owns_data = false };
+    vector_t tmpl_b = { .data = b->data, .type = b->type, .size = 1, .owns_data = false };
+    vector_t tmpl_r = { .data = result->data, .type = result->type, .size = 1, .owns_data = false };
+    vector_binary_plan_t plan;
+    vector_status_t status = vec_prepare_binary(&plan, op, &tmpl_a, &tmpl_b, &tmpl_r, shift_amount);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    tensor_axis_t axes[TENSOR_MAX_DIMS];
+    size_t naxes;
+    status = tensor_axes(a, b, result, axes, &naxes);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    tensor_run_t run = {
+        .kernel = plan.kernel,
+        .shift_amount = plan.shift_amount,
+        .elem = sizeof_dtype(result->type),
+        .scratch = NULL
+    };
+    const tensor_axis_t *inner = &axes[naxes - 1];
+    size_t outer = 1;
+    for (size_t i = 0; i + 1 < naxes; i++) {
+        outer *= axes[i].shape;
+    }
+
+    for (size_t n = 0; n < outer && status == VECTOR_SUCCESS; n++) {
+        size_t off_a = 0, off_b = 0, off_r = 0;
+        size_t rem = n;
+        for (size_t i = naxes - 1; i-- > 0;) {                                              // Decompose n over the outer axes
+            size_t idx = rem % axes[i].shape;
+            rem /= axes[i].shape;
+            off_a += idx * axes[i].stride_a;
+            off_b += idx * axes[i].stride_b;
+            off_r += idx * axes[i].stride_r;
+        }
+        status = tensor_run(&run, inner,
+                            (const uint8_t*)a->data + off_a * run.elem,
+                            (const uint8_t*)b->data + off_b * run.elem,
+                            (uint8_t*)result->data + off_r * run.elem);
+    }
+
+    if (run.scratch) { heap_caps_free(run.scratch);}
+    return status;
+}
+
+vector_status_t tensor_add(const tensor_t *a, const tensor_t *b, tensor_t *result) {
+    return tensor_binary(VECTOR_OP_ADD, a, b, result, 0);
+}
+
+vector_status_t tensor_sub(const tensor_t *a, const tensor_t *b, tensor_t *result) {
+    return tensor_binary(VECTOR_OP_SUB, a, b, result, 0);
+}
+
+vector_status_t tensor_mul(const tensor_t *a, const tensor_t *b, tensor_t *result, unsigned int shift_amount) {
+    return tensor_binary(VECTOR_OP_MUL, a, b, result, shift_amount);
+}
@@ -0,0 +1,318 @@
+#include "simd_functions.h"
+#include "simd_portable.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * Portable float kernels. See the vector_f32 assembly sources for the PIE implementations these mirror.
+ *
+ * Reductions keep the same four partial accumulators and combine order as the assembly so that
+ * rounding matches; madd.s is a fused multiply-add and is modelled with fmaf().
+ */
+
+int simd_abs_f32(const float *a, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        uint32_t bits;
+        memcpy(&bits, &a[i], sizeof(bits));
+        bits &= 0x7FFFFFFFu;                                                            // Clears the sign bit, NaN payloads preserved
+        memcpy(&result[i], &bits, sizeof(bits));
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_add_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] + b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] - b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_add_scalar_f32(const float *a, const float *scalar_val, float *result, const size_t size) {
+    const float val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] + val;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_f32(const float *a, const float *b, float *result, const unsigned int shift_amount, const size_t size) {
+    (void)shift_amount;                                                                 // Ignored for FLOAT32
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] * b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_f32(const float *a, const float *b, const float *c, float *result, const unsigned int shift_amount, const size_t size) {
+    (void)shift_amount;                                                                 // Ignored for FLOAT32
+    for (size_t i = 0; i < size; i++) {
+        result[i] = fmaf(a[i], b[i], c[i]);                                             // madd.s
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_f32(const float *a, float *result, const size_t size) {
+    float lanes[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    size_t blocks = size >> 2;
+    for (size_t i = 0; i < blocks; i++) {
+        lanes[0] += a[4 * i + 0];
+        lanes[1] += a[4 * i + 1];
+        lanes[2] += a[4 * i + 2];
+        lanes[3] += a[4 * i + 3];
+    }
+
+    float acc = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (size_t i = blocks << 2; i < size; i++) {
+        acc += a[i];
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_scalar_f32(const float *a, const float *scalar_val, float *result, const size_t size) {
+    const float val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] * val;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_f32(const float *a, const float *b, float *result, const size_t size) {
+    float lanes[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    size_t blocks = size >> 2;
+    for (size_t i = 0; i < blocks; i++) {
+        lanes[0] = fmaf(a[4 * i + 3], b[4 * i + 3], lanes[0]);                          // f8..f11 accumulate lanes 3..0
+        lanes[1] = fmaf(a[4 * i + 2], b[4 * i + 2], lanes[1]);
+        lanes[2] = fmaf(a[4 * i + 1], b[4 * i + 1], lanes[2]);
+        lanes[3] = fmaf(a[4 * i + 0], b[4 * i + 0], lanes[3]);
+    }
+
+    float acc = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (size_t i = blocks << 2; i < size; i++) {
+        acc = fmaf(a[i], b[i], acc);
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_gemm_2x2_f32(const float *a0, const float *a1, const float *b0, const float *b1, float *result, const size_t size) {
+    float c00 = 0.0f, c01 = 0.0f, c10 = 0.0f, c11 = 0.0f;
+    for (size_t i = 0; i < size; i++) {                                                 // f12..f15, one sum per output in order of k
+        c00 = fmaf(a0[i], b0[i], c00);
+        c01 = fmaf(a0[i], b1[i], c01);
+        c10 = fmaf(a1[i], b0[i], c10);
+        c11 = fmaf(a1[i], b1[i], c11);
+    }
+    result[0] = c00;
+    result[1] = c01;
+    result[2] = c10;
+    result[3] = c11;
+    return VECTOR_SUCCESS;
+}
+
+int simd_ceil_f32(const float *a, float *result, const float *max_val, const size_t size) {
+    const float ceil = *max_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = ceil < a[i] ? ceil : a[i];                                          // olt.s/movt.s: NaN inputs pass through
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_floor_f32(const float *a, float *result, const float *min_val, const size_t size) {
+    const float floor = *min_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < floor ? floor : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_neg_f32(const float *a, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        uint32_t bits;
+        memcpy(&bits, &a[i], sizeof(bits));
+        bits ^= 0x80000000u;                                                            // Flips the sign bit
+        memcpy(&result[i], &bits, sizeof(bits));
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mac_f32(const float *a, float *accumulator, const float *multiplier, const size_t size) {
+    const float mul = *multiplier;
+    float lanes[4] = {*accumulator, 0.0f, 0.0f, 0.0f};
+    size_t blocks = size >> 2;
+    for (size_t i = 0; i < blocks; i++) {
+        lanes[0] = fmaf(a[4 * i + 3], mul, lanes[0]);                                   // f4, f7, f8, f9 accumulate lanes 3, 2, 0, 1
+        lanes[1] = fmaf(a[4 * i + 2], mul, lanes[1]);
+        lanes[2] = fmaf(a[4 * i + 0], mul, lanes[2]);
+        lanes[3] = fmaf(a[4 * i + 1], mul, lanes[3]);
+    }
+
+    float acc = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (size_t i = blocks << 2; i < size; i++) {
+        acc = fmaf(a[i], mul, acc);
+    }
+    *accumulator = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_fir_f32(const float *window, const float *taps, float *result, const size_t ntaps, const size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        const float *w = window + n;
+        float lanes[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for (size_t j = 0; j < ntaps; j += 4) {
+            lanes[0] = fmaf(w[j + 0], taps[j + 0], lanes[0]);                           // f8..f11 accumulate tap positions 0..3 modulo 4
+            lanes[1] = fmaf(w[j + 1], taps[j + 1], lanes[1]);
+            lanes[2] = fmaf(w[j + 2], taps[j + 2], lanes[2]);
+            lanes[3] = fmaf(w[j + 3], taps[j + 3], lanes[3]);
+        }
+        result[n] = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_biquad_f32(float *frames, const float *coeffs, float *delay, const size_t stages, const size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        float *x = frames + 4 * n;                                                      // One sample of 4 channels
+        for (size_t s = 0; s < stages; s++) {
+            const float *c = coeffs + 5 * s;                                            // b0, b1, b2, -a1, -a2
+            float *d = delay + 16 * s;                                                  // x1, x2, y1, y2 for 4 lanes
+            for (size_t l = 0; l < 4; l++) {
+                float y = x[l] * c[0];                                                  // mul.s, then the madd.s chain
+                y = fmaf(d[l], c[1], y);
+                y = fmaf(d[4 + l], c[2], y);
+                y = fmaf(d[8 + l], c[3], y);
+                y = fmaf(d[12 + l], c[4], y);
+                d[4 + l] = d[l];
+                d[l] = x[l];
+                d[12 + l] = d[8 + l];
+                d[8 + l] = y;
+                x[l] = y;
+            }
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fft_r2_f32(float *data, const float *twiddles, const size_t groups, const size_t half) {
+    for (size_t g = 0; g < groups; g++) {
+        float *a = data + 4 * half * g;
+        float *b = a + 2 * half;
+        for (size_t j = 0; j < half; j++) {
+            const float wr = twiddles[2 * j], wi = twiddles[2 * j + 1];
+            const float br = b[2 * j], bi = b[2 * j + 1];
+            const float tr = fmaf(-bi, wi, br * wr);                                    // mul.s, msub.s
+            const float ti = fmaf(bi, wr, br * wi);                                     // mul.s, madd.s
+            const float ar = a[2 * j], ai = a[2 * j + 1];
+            a[2 * j] = ar + tr;
+            a[2 * j + 1] = ai + ti;
+            b[2 * j] = ar - tr;
+            b[2 * j + 1] = ai - ti;
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xcorr_f32(const float *a, const float *b, float *result, const size_t size, const size_t lags) {
+    for (size_t l = 0; l < lags; l += 4) {
+        const size_t steps = (l < size) ? (size - l + 3) & ~(size_t)3 : 0;              // Whole unrolled steps over the zero padding
+        float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};                                        // f8..f11
+        for (size_t n = 0; n < steps; n++) {
+            for (size_t i = 0; i < 4; i++) {
+                acc[i] = fmaf(a[n], b[n + l + i], acc[i]);
+            }
+        }
+        memcpy(&result[l], acc, sizeof(acc));
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (a[i] < b[i] || isnan(b[i])) ? b[i] : a[i];                         // olt.s, un.s, orb: NaN in either propagates
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (b[i] < a[i] || isnan(b[i])) ? b[i] : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+// Comparison masks are the bit pattern 0xFFFFFFFF where the condition holds, 0 elsewhere
+static inline void store_mask_f32(float *result, bool condition) {
+    const uint32_t bits = condition ? 0xFFFFFFFFu : 0u;
+    memcpy(result, &bits, sizeof(bits));
+}
+
+int simd_compare_eq_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store_mask_f32(&result[i], a[i] == b[i]);                                       // oeq.s
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_ne_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store_mask_f32(&result[i], !(a[i] == b[i]));                                    // Complement of oeq.s, true for NaN
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store_mask_f32(&result[i], b[i] < a[i]);                                        // olt.s
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_ge_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store_mask_f32(&result[i], b[i] <= a[i]);                                       // ole.s
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store_mask_f32(&result[i], a[i] < b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_le_f32(const float *a, const float *b, float *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store_mask_f32(&result[i], a[i] <= b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+// y = zero_point + x / scale in madd.s, clamped in float (a NaN takes the lower bound) and rounded to nearest even by round.s
+static inline float quantize_f32(float x, float inv_scale, float zero_point, float lo, float hi) {
+    float y = fmaf(x, inv_scale, zero_point);
+    if (!(y >= lo)) { y = lo;}                                                          // ult.s
+    if (y > hi) { y = hi;}
+    return nearbyintf(y);
+}
+
+int simd_f32_to_i8(const float *a, int8_t *result, const float *inv_scale, const int32_t zero_point, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int8_t)quantize_f32(a[i], *inv_scale, (float)zero_point, INT8_MIN, INT8_MAX);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_f32_to_i16(const float *a, int16_t *result, const float *inv_scale, const int32_t zero_point, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int16_t)quantize_f32(a[i], *inv_scale, (float)zero_point, INT16_MIN, INT16_MAX);
+    }
+    return VECTOR_SUCCESS;
+}
@@ -0,0 +1,335 @@
+#include "simd_functions.h"
+#include "simd_portable.h"
+#include <string.h>
+
+/**
+ * Portable int16_t kernels. See the vector_i16 assembly sources for the PIE implementations these mirror.
+ */
+
+// Hot kernels. The x86 backend (src/vector/x86) provides its own when ESP_SIMD_BACKEND=x86
+#if !defined(ESP_SIMD_BACKEND_X86)
+
+int simd_add_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i16((int32_t)a[i] + (int32_t)b[i]);                            // ee.vadds.s16 saturates to [-32768, 32767]
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i16((int32_t)a[i] - (int32_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_i16(const int16_t *a, const int16_t *b, int16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int16_t)(wrap_mul_i32(a[i], b[i]) >> shift_amount);                // ee.vmul.s16 keeps the low half-word after the SAR shift
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_i16(const int16_t *a, const int16_t *b, const int16_t *c, int16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        int16_t prod = (int16_t)(wrap_mul_i32(a[i], b[i]) >> shift_amount);             // As simd_mul_shift_i16, then ee.vadds.s16
+        result[i] = sat_i16((int32_t)prod + (int32_t)c[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_i16(const int16_t *a, int32_t *result, const size_t size) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, a[i]);
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_i16(const int16_t *a, const int16_t *b, int32_t *result, const size_t size) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, (int32_t)a[i] * (int32_t)b[i]);                         // Lower 32 bits of QACC
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_eq_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] == b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_and_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] & b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_or_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] | b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xor_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] ^ b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_not_i16(const int16_t *a, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = ~a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+#endif
+
+int simd_abs_i16(const int16_t *a, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        int32_t val = a[i];
+        result[i] = sat_i16(val < 0 ? -val : val);                                      // abs(-32768) saturates to 32767
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_add_scalar_i16(const int16_t *a, const int16_t *scalar_val, int16_t *result, const size_t size) {
+    const int32_t val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i16((int32_t)a[i] + val);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_ceil_i16(const int16_t *a, int16_t *result, const int16_t *max_val, const size_t size) {
+    const int16_t ceil = *max_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > ceil ? ceil : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fill_i16(int16_t *a, const int16_t *val, const size_t size) {
+    const int16_t fill = *val;
+    for (size_t i = 0; i < size; i++) {
+        a[i] = fill;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_floor_i16(const int16_t *a, int16_t *result, const int16_t *min_val, const size_t size) {
+    const int16_t floor = *min_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < floor ? floor : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mac_i16(const int16_t *a, int32_t *accumulator, const int16_t *multiplier, const size_t size) {
+    const int32_t mul = *multiplier;
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, (int32_t)a[i] * mul);
+    }
+    *accumulator = wrap_add_i32(*accumulator, acc);
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_i16_to_i32(const int16_t *a, const int16_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int32_t)a[i] * (int32_t)b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_scalar_i16(const int16_t *a, const int16_t *scalar_val, int16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    const int32_t val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int16_t)(wrap_mul_i32(a[i], val) >> shift_amount);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_neg_i16(const int16_t *a, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i16(-(int32_t)a[i]);                                            // -(-32768) saturates to 32767
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_ones_i16(int16_t *a, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        a[i] = 1;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_relu_i16(const int16_t *a, const int multiplier, const unsigned int shift_amount, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        int32_t val = a[i];
+        result[i] = val < 0 ? (int16_t)(wrap_mul_i32(val, multiplier) >> (shift_amount & 0x1F)) : (int16_t)val;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_zeros_i16(int16_t *a, const size_t size) {
+    memset(a, 0, size * sizeof(int16_t));
+    return VECTOR_SUCCESS;
+}
+
+int simd_copy_i16(const int16_t *a, int16_t *result, const size_t size) {
+    memmove(result, a, size * sizeof(int16_t));
+    return VECTOR_SUCCESS;
+}
+
+int simd_i16_to_i32(const int16_t *a, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int32_t)a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fir_i16(const int16_t *window, const int16_t *taps, int16_t *result, const size_t ntaps, const size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        int64_t acc = 0;                                                                // Stands in for the 40-bit ACCX
+        for (size_t j = 0; j < ntaps; j++) {
+            acc += (int32_t)window[n + j] * taps[j];
+        }
+        result[n] = sat_i16(sat_i32((acc + (1 << 14)) >> 15));                          // ee.srs.accx rounds and saturates, clamps narrows
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_biquad_i16(int16_t *frames, const int16_t *coeffs, int16_t *delay, const size_t stages, const size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        int16_t *x = frames + 8 * n;                                                    // One sample of 8 channels
+        for (size_t s = 0; s < stages; s++) {
+            const int16_t *c = coeffs + 40 * s;                                         // b0, b1, b2, -a1, -a2, each broadcast to 8 lanes
+            int16_t *d = delay + 32 * s;                                                // x1, x2, y1, y2 for 8 lanes
+            for (size_t l = 0; l < 8; l++) {
+                int64_t acc = (int32_t)x[l] * c[l] + (int32_t)d[l] * c[8 + l]          // Stands in for a 40-bit QACC lane
+                            + (int32_t)d[8 + l] * c[16 + l] + (int32_t)d[16 + l] * c[24 + l]
+                            + (int32_t)d[24 + l] * c[32 + l];
+                int16_t y = sat_i16(sat_i32(acc >> 14));                                // ee.srcmb.s16.qacc truncates and saturates
+                d[8 + l] = d[l];
+                d[l] = x[l];
+                d[24 + l] = d[16 + l];
+                d[16 + l] = y;
+                x[l] = y;
+            }
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fft_r2_i16(int16_t *data, const int16_t *twiddles, const size_t groups, const size_t half, int16_t *peak) {
+    for (size_t l = 0; l < 8; l++) {
+        peak[l] = 0;                                                                    // Lane maxima and minima start at 0
+        peak[8 + l] = 0;
+    }
+    for (size_t g = 0; g < groups; g++) {
+        int16_t *a = data + 4 * half * g;
+        int16_t *b = a + 2 * half;
+        for (size_t j = 0; j < half; j++) {
+            const int64_t wr = twiddles[2 * j], wi = twiddles[2 * j + 1];
+            const int64_t br = b[2 * j], bi = b[2 * j + 1];
+            const int32_t tr = sat_i16((int32_t)((br * wr - bi * wi) >> 15));           // ee.cmul.s16 with SAR = 15
+            const int32_t ti = sat_i16((int32_t)((br * wi + bi * wr) >> 15));
+            const int16_t out[4] = {sat_i16(a[2 * j] + tr), sat_i16(a[2 * j + 1] + ti),
+                                    sat_i16(a[2 * j] - tr), sat_i16(a[2 * j + 1] - ti)};
+            a[2 * j] = out[0];
+            a[2 * j + 1] = out[1];
+            b[2 * j] = out[2];
+            b[2 * j + 1] = out[3];
+            for (size_t k = 0; k < 4; k++) {
+                const size_t lane = (2 * j + (k & 1)) & 7;                              // A and B blocks share lane positions
+                if (out[k] > peak[lane]) { peak[lane] = out[k];}
+                if (out[k] < peak[8 + lane]) { peak[8 + lane] = out[k];}
+            }
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xcorr_i16(const int16_t *a, const int16_t *b, int32_t *result, const size_t size, const size_t lags) {
+    for (size_t l = 0; l < lags; l++) {
+        int32_t acc = 0;
+        for (size_t n = 0; n + l < size; n++) {
+            acc = wrap_add_i32(acc, (int32_t)a[n] * b[n + l]);                          // Low 32 bits of the QACC lane
+        }
+        result[l] = acc;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_i16_to_i8(const int16_t *a, int8_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i8(round_shift_i32(a[i], shift_amount));                        // Shifts are ee.vmul.s16 by 1
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_i16_to_f32(const int16_t *a, float *result, const float *scale, const int32_t zero_point, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (float)((int32_t)a[i] - zero_point) * *scale;                      // sub, float.s, mul.s
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_wide_i16(const int16_t *a, const int16_t *b, int64_t *result, const size_t size) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += (int32_t)a[i] * (int32_t)b[i];                                           // Chunked ACCX sums, exact
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_wide_i16(const int16_t *a, int64_t *result, const size_t size) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += a[i];                                                                    // Chunked ACCX sums, exact
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
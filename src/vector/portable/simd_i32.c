@@ -0,0 +1,258 @@
+#include "simd_functions.h"
+#include "simd_portable.h"
+#include <string.h>
+
+/**
+ * Portable int32_t kernels. See the vector_i32 assembly sources for the PIE implementations these mirror.
+ */
+
+// Hot kernels. The x86 backend (src/vector/x86) provides its own when ESP_SIMD_BACKEND=x86
+#if !defined(ESP_SIMD_BACKEND_X86)
+
+int simd_add_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i32((int64_t)a[i] + (int64_t)b[i]);                            // ee.vadds.s32 saturates
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i32((int64_t)a[i] - (int64_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_i32(const int32_t *a, const int32_t *b, int32_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int32_t)(((int64_t)a[i] * (int64_t)b[i]) >> shift_amount);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_i32(const int32_t *a, const int32_t *b, const int32_t *c, int32_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        int32_t prod = (int32_t)(((int64_t)a[i] * (int64_t)b[i]) >> shift_amount);      // As simd_mul_shift_i32, then ee.vadds.s32
+        result[i] = sat_i32((int64_t)prod + (int64_t)c[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_i32(const int32_t *a, int32_t *result, const size_t size) {
+    int32_t lanes[4] = {0, 0, 0, 0};                                                    // Four saturating 32-bit lanes, as in q0
+    size_t blocks = size >> 2;
+    for (size_t i = 0; i < blocks; i++) {
+        for (int lane = 0; lane < 4; lane++) {
+            lanes[lane] = sat_i32((int64_t)lanes[lane] + a[4 * i + lane]);
+        }
+    }
+
+    int32_t acc = wrap_add_i32(wrap_add_i32(lanes[0], lanes[1]), wrap_add_i32(lanes[2], lanes[3]));
+    for (size_t i = blocks << 2; i < size; i++) {                                       // Tail accumulates without saturation
+        acc = wrap_add_i32(acc, a[i]);
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, wrap_mul_i32(a[i], b[i]));                              // mull keeps the low 32 bits of each product
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_eq_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] == b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_and_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] & b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_or_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] | b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xor_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] ^ b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_not_i32(const int32_t *a, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = ~a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+#endif
+
+int simd_abs_i32(const int32_t *a, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        int32_t val = a[i];
+        result[i] = val < 0 ? (int32_t)(0u - (uint32_t)val) : val;                      // abs(INT32_MIN) wraps, as the abs instruction does
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_add_scalar_i32(const int32_t *a, const int32_t *scalar_val, int32_t *result, const size_t size) {
+    const int64_t val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i32((int64_t)a[i] + val);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_ceil_i32(const int32_t *a, int32_t *result, const int32_t *max_val, const size_t size) {
+    const int32_t ceil = *max_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > ceil ? ceil : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fill_i32(int32_t *a, const int32_t *val, const size_t size) {
+    const int32_t fill = *val;
+    for (size_t i = 0; i < size; i++) {
+        a[i] = fill;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_floor_i32(const int32_t *a, int32_t *result, const int32_t *min_val, const size_t size) {
+    const int32_t floor = *min_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < floor ? floor : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mac_i32(const int32_t *a, int32_t *accumulator, const int32_t *multiplier, const size_t size) {
+    const int32_t mul = *multiplier;
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, wrap_mul_i32(a[i], mul));
+    }
+    *accumulator = wrap_add_i32(*accumulator, acc);
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_scalar_i32(const int32_t *a, const int32_t *scalar_val, int32_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    const int64_t val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int32_t)(((int64_t)a[i] * val) >> shift_amount);                   // mulsh/mull pair funnel-shifted by SAR
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_neg_i32(const int32_t *a, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int32_t)(0u - (uint32_t)a[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_ones_i32(int32_t *a, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        a[i] = 1;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_zeros_i32(int32_t *a, const size_t size) {
+    memset(a, 0, size * sizeof(int32_t));
+    return VECTOR_SUCCESS;
+}
+
+int simd_copy_i32(const int32_t *a, int32_t *result, const size_t size) {
+    memmove(result, a, size * sizeof(int32_t));
+    return VECTOR_SUCCESS;
+}
+
+int simd_i32_to_i16(const int32_t *a, int16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i16(round_shift_i32(a[i], shift_amount));                       // ee.vsr.32, ee.vmin/vmax.s32, ee.vunzip.16
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_i32_to_i8(const int32_t *a, int8_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i8(round_shift_i32(a[i], shift_amount));
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_wide_i32(const int32_t *a, const int32_t *b, int64_t *result, const size_t size) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i64(acc, (int64_t)a[i] * (int64_t)b[i]);                         // mull / mulsh, wrapping only past int64_t
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_wide_i32(const int32_t *a, int64_t *result, const size_t size) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += a[i];                                                                    // Chunked half sums, exact
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_lanes_i32(const int32_t *a, int32_t *lanes, const size_t size) {
+    for (size_t i = 0; i + 4 <= size; i += 4) {
+        for (int lane = 0; lane < 4; lane++) {
+            lanes[lane] = sat_i32((int64_t)lanes[lane] + a[i + lane]);                  // The block loop of simd_sum_i32
+        }
+    }
+    return VECTOR_SUCCESS;
+}
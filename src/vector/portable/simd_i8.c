@@ -0,0 +1,305 @@
+#include "simd_functions.h"
+#include "simd_portable.h"
+#include <string.h>
+
+/**
+ * Portable int8_t kernels. See the vector_i8 assembly sources for the PIE implementations these mirror.
+ */
+
+// Hot kernels. The x86 backend (src/vector/x86) provides its own when ESP_SIMD_BACKEND=x86
+#if !defined(ESP_SIMD_BACKEND_X86)
+
+int simd_add_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i8((int32_t)a[i] + (int32_t)b[i]);                              // ee.vadds.s8 saturates to [-128, 127]
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i8((int32_t)a[i] - (int32_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_i8(const int8_t *a, const int8_t *b, int8_t *result, const int shift_amount, const size_t size) {
+    if ((unsigned int)shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int8_t)(((int32_t)a[i] * (int32_t)b[i]) >> shift_amount);         // ee.vmul.s8 keeps the low byte after the SAR shift
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_i8(const int8_t *a, const int8_t *b, const int8_t *c, int8_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        int8_t prod = (int8_t)(((int32_t)a[i] * (int32_t)b[i]) >> shift_amount);        // As simd_mul_shift_i8, then ee.vadds.s8
+        result[i] = sat_i8((int32_t)prod + (int32_t)c[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_i8(const int8_t *a, int32_t *result, const size_t size) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, a[i]);                                                  // Lower 32 bits of QACC
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_i8(const int8_t *a, const int8_t *b, int32_t *result, const size_t size) {
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, (int32_t)a[i] * (int32_t)b[i]);
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+// Four weight rows per pass share each load of x; rows are stride elements apart
+int simd_gemv_i8(const int8_t *w, const int8_t *x, int32_t *result, const size_t rows, const size_t cols, const size_t stride) {
+    size_t r = 0;
+    for (; r + 4 <= rows; r += 4) {
+        const int8_t *w0 = w + r * stride;
+        const int8_t *w1 = w0 + stride;
+        const int8_t *w2 = w1 + stride;
+        const int8_t *w3 = w2 + stride;
+        int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        for (size_t i = 0; i < cols; i++) {
+            int32_t xi = x[i];
+            acc0 = wrap_add_i32(acc0, (int32_t)w0[i] * xi);
+            acc1 = wrap_add_i32(acc1, (int32_t)w1[i] * xi);
+            acc2 = wrap_add_i32(acc2, (int32_t)w2[i] * xi);
+            acc3 = wrap_add_i32(acc3, (int32_t)w3[i] * xi);
+        }
+        result[r] = acc0;
+        result[r + 1] = acc1;
+        result[r + 2] = acc2;
+        result[r + 3] = acc3;
+    }
+    for (; r < rows; r++) {
+        simd_dotp_i8(w + r * stride, x, &result[r], cols);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_eq_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] == b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_and_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] & b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_or_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] | b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xor_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] ^ b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_not_i8(const int8_t *a, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = ~a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+#endif
+
+int simd_add_scalar_i8(const int8_t *a, const int8_t *scalar_val, int8_t *result, const size_t size) {
+    const int32_t val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i8((int32_t)a[i] + val);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_i8_to_i16(const int8_t *a, const int8_t *b, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int16_t)((int32_t)a[i] * (int32_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_scalar_i8(const int8_t *a, const int8_t *scalar_val, int8_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+    const int32_t val = *scalar_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int8_t)(((int32_t)a[i] * val) >> shift_amount);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_abs_i8(const int8_t *a, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        int32_t val = a[i];
+        result[i] = sat_i8(val < 0 ? -val : val);                                       // abs(-128) saturates to 127
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_ceil_i8(const int8_t *a, int8_t *result, const int8_t *max_val, const size_t size) {
+    const int8_t ceil = *max_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > ceil ? ceil : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_floor_i8(const int8_t *a, int8_t *result, const int8_t *min_val, const size_t size) {
+    const int8_t floor = *min_val;
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < floor ? floor : a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_neg_i8(const int8_t *a, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = sat_i8(-(int32_t)a[i]);                                             // -(-128) saturates to 127
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_relu_i8(const int8_t *a, const int multiplier, const unsigned int shift_amount, int8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        int32_t val = a[i];
+        result[i] = val < 0 ? (int8_t)((val * multiplier) >> (shift_amount & 0x1F)) : (int8_t)val;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mac_i8(const int8_t *a, int32_t *accumulator, const int8_t *multiplier, const size_t size) {
+    const int32_t mul = *multiplier;
+    int32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc = wrap_add_i32(acc, (int32_t)a[i] * mul);
+    }
+    *accumulator = wrap_add_i32(*accumulator, acc);
+    return VECTOR_SUCCESS;
+}
+
+int simd_zeros_i8(int8_t *a, const size_t size) {
+    memset(a, 0, size);
+    return VECTOR_SUCCESS;
+}
+
+int simd_ones_i8(int8_t *a, const size_t size) {
+    memset(a, 1, size);
+    return VECTOR_SUCCESS;
+}
+
+int simd_fill_i8(int8_t *a, const int8_t *val, const size_t size) {
+    memset(a, (uint8_t)(*val), size);
+    return VECTOR_SUCCESS;
+}
+
+int simd_copy_i8(const int8_t *a, int8_t *result, const size_t size) {
+    memmove(result, a, size);
+    return VECTOR_SUCCESS;
+}
+
+int simd_i8_to_i16(const int8_t *a, int16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int16_t)a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_i8_to_i32(const int8_t *a, int32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (int32_t)a[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_i8_to_f32(const int8_t *a, float *result, const float *scale, const int32_t zero_point, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (float)((int32_t)a[i] - zero_point) * *scale;                      // sub, float.s, mul.s
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_wide_i8(const int8_t *a, const int8_t *b, int64_t *result, const size_t size) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += (int32_t)a[i] * (int32_t)b[i];                                           // Chunked ACCX sums, exact
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_wide_i8(const int8_t *a, int64_t *result, const size_t size) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += a[i];                                                                    // ACCX, sign-extended at the end
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+// Rows per simd_gemv_i8 call; the PIE kernel requantizes each row as it finishes, this mirror a block at a time
+#define GEMV_REQUANT_ROWS 32
+
+int simd_gemv_requant_i8(const int8_t *w, const int8_t *x, void *result, const size_t rows, const size_t cols, const simd_gemv_requant_t *requant) {
+    int32_t acc[GEMV_REQUANT_ROWS];
+    for (size_t rb = 0; rb < rows; rb += GEMV_REQUANT_ROWS) {
+        const size_t nr = (rows - rb < GEMV_REQUANT_ROWS) ? rows - rb : GEMV_REQUANT_ROWS;
+        simd_gemv_i8(w + rb * requant->stride, x, acc, nr, cols, requant->stride);
+        for (size_t r = 0; r < nr; r++) {
+            int64_t value = (int64_t)acc[r] + (requant->bias ? requant->bias[rb + r] : 0);
+            value >>= requant->shift;                                                   // src / sra on the 64-bit sum
+            int32_t out = value < requant->lo ? requant->lo : (value > requant->hi ? requant->hi : (int32_t)value);
+            switch (requant->elem) {
+                case 1:     ((int8_t*)result)[rb + r] = (int8_t)out;    break;
+                case 2:     ((int16_t*)result)[rb + r] = (int16_t)out;  break;
+                default:    ((int32_t*)result)[rb + r] = out;           break;
+            }
+        }
+    }
+    return VECTOR_SUCCESS;
+}
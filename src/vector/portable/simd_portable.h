@@ -0,0 +1,55 @@
+#ifndef SIMD_PORTABLE_H
+#define SIMD_PORTABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "vector.h"
+
+/**
+ * Shared helpers for the portable C backend.
+ *
+ * The portable backend implements every simd_* entry point in simd_functions.h in plain C so
+ * the library can be built and tested on hosts without the ESP32-S3 PIE extension. Each kernel
+ * mirrors the saturation, shift and wrap-around behavior of its hand-written .S counterpart.
+ */
+
+static inline int8_t sat_i8(int32_t val) {
+    if (val > INT8_MAX) { return INT8_MAX;}
+    if (val < INT8_MIN) { return INT8_MIN;}
+    return (int8_t)val;
+}
+
+static inline int16_t sat_i16(int32_t val) {
+    if (val > INT16_MAX) { return INT16_MAX;}
+    if (val < INT16_MIN) { return INT16_MIN;}
+    return (int16_t)val;
+}
+
+static inline int32_t sat_i32(int64_t val) {
+    if (val > INT32_MAX) { return INT32_MAX;}
+    if (val < INT32_MIN) { return INT32_MIN;}
+    return (int32_t)val;
+}
+
+// Two's complement wrap-around arithmetic, matching the 32-bit add/mull instructions
+static inline int32_t wrap_add_i32(int32_t a, int32_t b) {
+    return (int32_t)((uint32_t)a + (uint32_t)b);
+}
+
+static inline int32_t wrap_mul_i32(int32_t a, int32_t b) {
+    return (int32_t)((uint32_t)a * (uint32_t)b);
+}
+
+static inline int64_t wrap_add_i64(int64_t a, int64_t b) {
+    return (int64_t)((uint64_t)a + (uint64_t)b);
+}
+
+// Rounding arithmetic right shift as the narrowing kernels compute it, (t >> 1) + (t & 1) with t = val >> (shift - 1),
+// which rounds half up without the overflow of val + 2^(shift - 1)
+static inline int32_t round_shift_i32(int32_t val, unsigned int shift) {
+    if (shift == 0) { return val;}
+    int32_t t = val >> (shift - 1);
+    return (t >> 1) + (t & 1);
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include "simd_functions.h"
+#include "simd_portable.h"
+
+/**
+ * Portable uint16_t kernels. See the vector_u16 assembly sources for the PIE implementations these mirror.
+ */
+
+int simd_add_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        uint32_t sum = (uint32_t)a[i] + b[i];
+        result[i] = sum > UINT16_MAX ? UINT16_MAX : (uint16_t)sum;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? (uint16_t)(a[i] - b[i]) : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (uint16_t)(((uint32_t)a[i] * (uint32_t)b[i]) >> shift_amount);            // ee.vmul.u16 keeps the low bits after the SAR shift
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_u16(const uint16_t *a, uint32_t *result, const size_t size) {
+    uint32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += a[i];                                                                    // Lower 32 bits of QACC
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? (uint16_t)~0u : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? (uint16_t)~0u : 0;
+    }
+    return VECTOR_SUCCESS;
+}
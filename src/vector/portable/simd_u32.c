@@ -0,0 +1,50 @@
+#include "simd_functions.h"
+#include "simd_portable.h"
+
+/**
+ * Portable uint32_t kernels. See the vector_u32 assembly sources for the PIE implementations these mirror.
+ * The multiply and sum kernels have no PIE counterpart and live in simd_unsigned.c for every target.
+ */
+
+int simd_add_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        uint32_t sum = a[i] + b[i];
+        result[i] = sum < a[i] ? UINT32_MAX : sum;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] - b[i] : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? UINT32_MAX : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? UINT32_MAX : 0;
+    }
+    return VECTOR_SUCCESS;
+}
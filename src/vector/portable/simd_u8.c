@@ -0,0 +1,72 @@
+#include "simd_functions.h"
+#include "simd_portable.h"
+#include <string.h>
+
+/**
+ * Portable uint8_t kernels. See the vector_u8 assembly sources for the PIE implementations these mirror.
+ */
+
+int simd_add_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        uint32_t sum = (uint32_t)a[i] + b[i];
+        result[i] = sum > UINT8_MAX ? UINT8_MAX : (uint8_t)sum;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? (uint8_t)(a[i] - b[i]) : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (uint8_t)(((uint32_t)a[i] * (uint32_t)b[i]) >> shift_amount);            // ee.vmul.u8 keeps the low bits after the SAR shift
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_u8(const uint8_t *a, uint32_t *result, const size_t size) {
+    uint32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += a[i];                                                                    // Lower 32 bits of QACC
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] > b[i] ? (uint8_t)~0u : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        result[i] = a[i] < b[i] ? (uint8_t)~0u : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_realign_u8(const uint8_t *src, uint8_t *dst, const size_t size) {
+    memcpy(dst, src, size);                                                             // ee.ld.128.usar.ip + ee.src.q funnel shift
+    return VECTOR_SUCCESS;
+}
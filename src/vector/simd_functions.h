@@ -8,16 +8,34 @@
 extern "C" {    
 #endif  
 
+/**
+ * Row epilogue of simd_gemv_requant_i8. Each wrapped 32-bit row sum has its bias added in 64 bits, is
+ * shifted right arithmetically and saturated to [lo, hi], then stored as an elem-byte integer.
+ * The assembly reads the fields at fixed offsets, so keep their order.
+ */
+typedef struct {
+    size_t stride;                                                                          // Weight row stride in elements (bytes), a multiple of 16
+    const int32_t *bias;                                                                    // One per row, or NULL
+    uint32_t shift;                                                                         // 0 .. 31
+    int32_t lo;
+    int32_t hi;
+    uint32_t elem;                                                                          // 1, 2 or 4
+} simd_gemv_requant_t;
 
 //int8_t
 extern int simd_add_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size);
 extern int simd_add_scalar_i8(const int8_t *a, const int8_t *scalar_val, int8_t *result, const size_t size);  
 extern int simd_sub_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size);
 extern int simd_mul_shift_i8(const int8_t *a, const int8_t *b, int8_t *result, const int shift_amount, const size_t size);
+extern int simd_fma_i8(const int8_t *a, const int8_t *b, const int8_t *c, int8_t *result, const unsigned int shift_amount, const size_t size);
 extern int simd_mul_i8_to_i16(const int8_t *a, const int8_t *b, int16_t *result, const size_t size);
 extern int simd_sum_i8(const int8_t *a, int32_t* result, const size_t size);
+extern int simd_sum_wide_i8(const int8_t *a, int64_t *result, const size_t size);
 extern int simd_mul_scalar_i8(const int8_t *a, const int8_t *scalar_val, int8_t *result, const unsigned int shift_amount, const size_t size);
 extern int simd_dotp_i8(const int8_t *a, const int8_t *b, int32_t* result, const size_t size);
+extern int simd_dotp_wide_i8(const int8_t *a, const int8_t *b, int64_t *result, const size_t size);
+extern int simd_gemv_i8(const int8_t *w, const int8_t *x, int32_t *result, const size_t rows, const size_t cols, const size_t stride);
+extern int simd_gemv_requant_i8(const int8_t *w, const int8_t *x, void *result, const size_t rows, const size_t cols, const simd_gemv_requant_t *requant);
 extern int simd_abs_i8(const int8_t *a, int8_t *result, const size_t size);
 extern int simd_ceil_i8(const int8_t *a, int8_t *result, const int8_t *max_val, const size_t size);
 extern int simd_floor_i8(const int8_t *a, int8_t *result, const int8_t *min_val, const size_t size);
@@ -49,6 +67,7 @@ extern int simd_compare_eq_i16(const int16_t *a, const int16_t *b, int16_t *resu
 extern int simd_compare_gt_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size);
 extern int simd_compare_lt_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size);
 extern int simd_dotp_i16(const int16_t *a, const int16_t *b, int32_t* result, const size_t size);
+extern int simd_dotp_wide_i16(const int16_t *a, const int16_t *b, int64_t *result, const size_t size);
 extern int simd_fill_i16(int16_t *a, const int16_t *val, const size_t size);
 extern int simd_floor_i16(const int16_t *a, int16_t *result, const int16_t *min_val, const size_t size);
 extern int simd_max_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size);
@@ -57,6 +76,11 @@ extern int simd_mac_i16(const int16_t *a,  int32_t *accumulator, const int16_t *
 extern int simd_mul_i16_to_i32(const int16_t *a, const int16_t *b, int32_t *result, const size_t size);
 extern int simd_mul_scalar_i16(const int16_t *a, const int16_t *scalar_val, int16_t *result, const unsigned int shift_amount, const size_t size);
 extern int simd_mul_shift_i16(const int16_t *a, const int16_t *b, int16_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_fma_i16(const int16_t *a, const int16_t *b, const int16_t *c, int16_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_fir_i16(const int16_t *window, const int16_t *taps, int16_t *result, const size_t ntaps, const size_t size);
+extern int simd_biquad_i16(int16_t *frames, const int16_t *coeffs, int16_t *delay, const size_t stages, const size_t size);
+extern int simd_fft_r2_i16(int16_t *data, const int16_t *twiddles, const size_t groups, const size_t half, int16_t *peak);
+extern int simd_xcorr_i16(const int16_t *a, const int16_t *b, int32_t *result, const size_t size, const size_t lags);
 extern int simd_neg_i16(const int16_t *a, int16_t *result, const size_t size);
 extern int simd_not_i16(const int16_t *a, int16_t *result, const size_t size);
 extern int simd_ones_i16(int16_t *a, const size_t size);
@@ -64,6 +88,7 @@ extern int simd_or_i16(const int16_t *a, const int16_t *b, int16_t *result, cons
 extern int simd_relu_i16(const int16_t *a, const int multiplier, const unsigned int shift_amount, int16_t *result, const size_t size);
 extern int simd_sub_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size);
 extern int simd_sum_i16(const int16_t *a, int32_t* result, const size_t size);
+extern int simd_sum_wide_i16(const int16_t *a, int64_t *result, const size_t size);
 extern int simd_xor_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size);
 extern int simd_zeros_i16(int16_t *a, const size_t size);
 extern int simd_copy_i16(const int16_t *a, int16_t *result, const size_t size); 
@@ -80,6 +105,7 @@ extern int simd_compare_eq_i32(const int32_t *a, const int32_t *b, int32_t *resu
 extern int simd_compare_gt_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size);
 extern int simd_compare_lt_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size); 
 extern int simd_dotp_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size); 
+extern int simd_dotp_wide_i32(const int32_t *a, const int32_t *b, int64_t *result, const size_t size);
 extern int simd_fill_i32(int32_t *a, const int32_t *val, const size_t size);
 extern int simd_floor_i32(const int32_t *a, int32_t *result, const int32_t *min_val, const size_t size);
 extern int simd_max_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size);
@@ -88,6 +114,7 @@ extern int simd_mac_i32(const int32_t *a, int32_t *accumulator, const int32_t *m
 extern int simd_mul_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size);
 extern int simd_mul_scalar_i32(const int32_t *a, const int32_t *scalar_val, int32_t *result, const unsigned int shift_amount, const size_t size);
 extern int simd_mul_shift_i32(const int32_t *a, const int32_t *b, int32_t *result, const unsigned int shift_amount, const size_t size); 
+extern int simd_fma_i32(const int32_t *a, const int32_t *b, const int32_t *c, int32_t *result, const unsigned int shift_amount, const size_t size);
 extern int simd_neg_i32(const int32_t *a, int32_t *result, const size_t size);
 extern int simd_not_i32(const int32_t *a, int32_t *result, const size_t size);
 extern int simd_ones_i32(int32_t *a, const size_t size);
@@ -95,6 +122,8 @@ extern int simd_or_i32(const int32_t *a, const int32_t *b, int32_t *result, cons
 extern int simd_relu_i32(const int32_t *a, const int multiplier, const unsigned int shift_amount, int32_t *result, const size_t size); 
 extern int simd_sub_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size); 
 extern int simd_sum_i32(const int32_t *a, int32_t *result, const size_t size); 
+extern int simd_sum_lanes_i32(const int32_t *a, int32_t *lanes, const size_t size);
+extern int simd_sum_wide_i32(const int32_t *a, int64_t *result, const size_t size);
 extern int simd_xor_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size);
 extern int simd_zeros_i32(int32_t *a, const size_t size);
 extern int simd_copy_i32(const int32_t *a, int32_t *result, const size_t size); 
@@ -105,31 +134,78 @@ extern int simd_add_f32(const float* a, const float* b,float* result, const size
 extern int simd_sub_f32(const float* a, const float* b,float* result, const size_t size);
 extern int simd_add_scalar_f32(const float *a, const float *scalar_val, float *result, const size_t size);
 extern int simd_mul_shift_f32(const float *a, const float *b, float *result, const unsigned int shift_amount, const size_t size);  
+extern int simd_fma_f32(const float *a, const float *b, const float *c, float *result, const unsigned int shift_amount, const size_t size);
 extern int simd_sum_f32(const float *a, float * result, const size_t size);
 extern int simd_mul_scalar_f32(const float* a, const float* scalar_val, float* result, const size_t size);
 extern int simd_dotp_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_gemm_2x2_f32(const float *a0, const float *a1, const float *b0, const float *b1, float *result, const size_t size);
 extern int simd_ceil_f32(const float *a, float *result, const float *max_val, const size_t size);
 extern int simd_floor_f32(const float *a, float *result, const float *min_val, const size_t size);
 extern int simd_neg_f32(const float *a, float *result, const size_t size);
 extern int simd_mac_f32(const float *a, float *accumulator, const float *multiplier, const size_t size); 
-extern int simd_min_f32(const float* a, const float *b, float *result);
-extern int simd_max_f32(const float* a, const float *b, float *result);
-
+extern int simd_fir_f32(const float *window, const float *taps, float *result, const size_t ntaps, const size_t size);
+extern int simd_biquad_f32(float *frames, const float *coeffs, float *delay, const size_t stages, const size_t size);
+extern int simd_fft_r2_f32(float *data, const float *twiddles, const size_t groups, const size_t half);
+extern int simd_xcorr_f32(const float *a, const float *b, float *result, const size_t size, const size_t lags);
+extern int simd_min_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_max_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_compare_eq_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_compare_ne_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_compare_gt_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_compare_ge_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_compare_lt_f32(const float *a, const float *b, float *result, const size_t size);
+extern int simd_compare_le_f32(const float *a, const float *b, float *result, const size_t size);
+
+
+//uint8_t
+extern int simd_add_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size);
+extern int simd_sub_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size);
+extern int simd_mul_shift_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_fma_u8(const uint8_t *a, const uint8_t *b, const uint8_t *c, uint8_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_sum_u8(const uint8_t *a, uint32_t *result, const size_t size);
+extern int simd_max_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size);
+extern int simd_min_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size);
+extern int simd_compare_gt_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size);
+extern int simd_compare_lt_u8(const uint8_t *a, const uint8_t *b, uint8_t *result, const size_t size);
+extern int simd_realign_u8(const uint8_t *src, uint8_t *dst, const size_t size);
+
+//uint16_t
+extern int simd_add_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size);
+extern int simd_sub_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size);
+extern int simd_mul_shift_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_fma_u16(const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_sum_u16(const uint16_t *a, uint32_t *result, const size_t size);
+extern int simd_max_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size);
+extern int simd_min_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size);
+extern int simd_compare_gt_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size);
+extern int simd_compare_lt_u16(const uint16_t *a, const uint16_t *b, uint16_t *result, const size_t size);
+
+//uint32_t
+extern int simd_add_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size);
+extern int simd_sub_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size);
+extern int simd_mul_shift_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_fma_u32(const uint32_t *a, const uint32_t *b, const uint32_t *c, uint32_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_sum_u32(const uint32_t *a, uint32_t *result, const size_t size);
+extern int simd_sum_wide_u32(const uint32_t *a, uint64_t *result, const size_t size);
+extern int simd_max_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size);
+extern int simd_min_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size);
+extern int simd_compare_gt_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size);
+extern int simd_compare_lt_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const size_t size);
 
 //Conversion functions
 extern int simd_i8_to_i16(const int8_t *a, int16_t *result, const size_t size);
 extern int simd_i8_to_i32(const int8_t *a, int32_t *result, const size_t size);
 extern int simd_i16_to_i32(const int16_t *a, int32_t *result, const size_t size);
-extern int simd_i16_to_i8(const int16_t *a, int8_t *result, const size_t size);
-extern int simd_i32_to_i8(const int32_t *a, int8_t *result, const size_t size);
-extern int simd_i32_to_i16(const int32_t *a, int16_t *result, const size_t size); 
+extern int simd_i16_to_i8(const int16_t *a, int8_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_i32_to_i8(const int32_t *a, int8_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_i32_to_i16(const int32_t *a, int16_t *result, const unsigned int shift_amount, const size_t size);
+extern int simd_f32_to_i8(const float *a, int8_t *result, const float *inv_scale, const int32_t zero_point, const size_t size);
+extern int simd_f32_to_i16(const float *a, int16_t *result, const float *inv_scale, const int32_t zero_point, const size_t size);
+extern int simd_i8_to_f32(const int8_t *a, float *result, const float *scale, const int32_t zero_point, const size_t size);
+extern int simd_i16_to_f32(const int16_t *a, float *result, const float *scale, const int32_t zero_point, const size_t size);
 
 /**
-    extern int simd_f32_to_i8(const float *a, int8_t *result, const size_t size);
-    extern int simd_f32_to_i16(const float *a, int16_t *result, const size_t size);
     extern int simd_f32_to_i32(const float *a, int32_t *result, const size_t size);
-    extern int simd_i8_to_f32(const int8_t *a, float *result, const size_t size);
-    extern int simd_i16_to_f32(const int16_t *a, float *result, const size_t size);
     extern int simd_i32_to_f32(const int32_t *a, float *result, const size_t size);
  */
 
@@ -0,0 +1,71 @@
+#include "simd_functions.h"
+#include "vector.h"
+
+/**
+ * Unsigned kernels with no PIE counterpart, built for every target.
+ *
+ * PIE has no 32-bit lane multiply and its lane adds all saturate, so the uint32_t multiply and the
+ * wrapping sums are plain C on the ESP32-S3 as well, and so are the fused multiply-adds. The unsigned
+ * kernels on PIE are in vector_u8/, vector_u16/ and vector_u32/.
+ */
+
+static inline uint32_t sat_add_u32(uint32_t a, uint32_t b) {
+    uint32_t sum = a + b;
+    return sum < a ? UINT32_MAX : sum;
+}
+
+int simd_mul_shift_u32(const uint32_t *a, const uint32_t *b, uint32_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        result[i] = (uint32_t)(((uint64_t)a[i] * b[i]) >> shift_amount);              // Low word after the shift, as simd_mul_shift_i32
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_u32(const uint32_t *a, uint32_t *result, const size_t size) {
+    uint32_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += a[i];                                                                    // Wraps in 32 bits
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_wide_u32(const uint32_t *a, uint64_t *result, const size_t size) {
+    uint64_t acc = 0;
+    for (size_t i = 0; i < size; i++) {
+        acc += a[i];                                                                    // Exact below 2^32 elements
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+//Fused multiply-add, scalar on every target
+int simd_fma_u8(const uint8_t *a, const uint8_t *b, const uint8_t *c, uint8_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        uint8_t prod = (uint8_t)(((uint32_t)a[i] * (uint32_t)b[i]) >> shift_amount);    // As simd_mul_shift_u8
+        uint32_t sum = (uint32_t)prod + c[i];
+        result[i] = sum > UINT8_MAX ? UINT8_MAX : (uint8_t)sum;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_u16(const uint16_t *a, const uint16_t *b, const uint16_t *c, uint16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        uint16_t prod = (uint16_t)(((uint32_t)a[i] * (uint32_t)b[i]) >> shift_amount);  // As simd_mul_shift_u16
+        uint32_t sum = (uint32_t)prod + c[i];
+        result[i] = sum > UINT16_MAX ? UINT16_MAX : (uint16_t)sum;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_u32(const uint32_t *a, const uint32_t *b, const uint32_t *c, uint32_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    for (size_t i = 0; i < size; i++) {
+        uint32_t prod = (uint32_t)(((uint64_t)a[i] * (uint64_t)b[i]) >> shift_amount);  // As simd_mul_shift_u32
+        result[i] = sat_add_u32(prod, c[i]);
+    }
+    return VECTOR_SUCCESS;
+}
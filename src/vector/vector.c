@@ -1,17 +1,41 @@
 #include "vector.h"
 #include "simd_functions.h"                                                                 // For SIMD vector operations
 #include <stdlib.h>  
+#include <string.h>
 #include "esp_heap_caps.h"  
+#include "esp_memory_utils.h"
 #include "esp_log.h"
 
+#define PLACEMENT_MEMORY (VECTOR_PLACEMENT_INTERNAL | VECTOR_PLACEMENT_PSRAM)
+
+// heap_caps capabilities for a placement request; 0 if the request is contradictory
+static uint32_t placement_caps(uint32_t placement) {
+    if ((placement & PLACEMENT_MEMORY) == PLACEMENT_MEMORY) { return 0;}
+    if (!(placement & (PLACEMENT_MEMORY | VECTOR_PLACEMENT_DMA))) { return MALLOC_CAP_DEFAULT;}
+
+    uint32_t caps = MALLOC_CAP_8BIT;
+    if (placement & VECTOR_PLACEMENT_INTERNAL) { caps |= MALLOC_CAP_INTERNAL;}
+    if (placement & VECTOR_PLACEMENT_PSRAM)    { caps |= MALLOC_CAP_SPIRAM;}
+    if (placement & VECTOR_PLACEMENT_DMA)      { caps |= MALLOC_CAP_DMA;}
+    return caps;
+}
 
 vector_t *vector_create(size_t size, dtype type) {
-    if (type < DTYPE_INT8 || type > DTYPE_FLOAT32) { return NULL;}
+    return vector_create_ex(size, type, VECTOR_PLACEMENT_DEFAULT);
+}
+
+vector_t *vector_create_ex(size_t size, dtype type, uint32_t placement) {
+    if (type < DTYPE_INT8 || type > DTYPE_UINT32) { return NULL;}
+    uint32_t caps = placement_caps(placement);
+    if (!caps) { return NULL;}
 
     vector_t *vec = malloc(sizeof(vector_t));                                               // Returns NULL if size == 0
     if (!vec) { return NULL;}
  
-    vec->data = heap_caps_aligned_alloc(16, size * sizeof_dtype(type), MALLOC_CAP_DEFAULT); // Allocate aligned memory for the data array
+    vec->data = heap_caps_aligned_alloc(16, size * sizeof_dtype(type), caps);              // Allocate aligned memory for the data array
+    if (!vec->data && (placement & VECTOR_PLACEMENT_FALLBACK) && caps != MALLOC_CAP_DEFAULT) {
+        vec->data = heap_caps_aligned_alloc(16, size * sizeof_dtype(type), MALLOC_CAP_DEFAULT);
+    }
     if (!vec->data) {                                           
         free(vec);  
         return NULL;
@@ -23,10 +47,38 @@ vector_t *vector_create(size_t size, dtype type) {
     return vec;                                                                             // Return the created vector_t
 }
 
+uint32_t vector_placement(const vector_t *vec) {
+    if (!vec || !vec->data) { return 0;}
+    uint32_t placement = 0;
+    if (esp_ptr_internal(vec->data))     { placement |= VECTOR_PLACEMENT_INTERNAL;}
+    if (esp_ptr_external_ram(vec->data)) { placement |= VECTOR_PLACEMENT_PSRAM;}
+    if (esp_ptr_dma_capable(vec->data))  { placement |= VECTOR_PLACEMENT_DMA;}
+    return placement;
+}
+
+vector_status_t vector_migrate(vector_t *vec, uint32_t placement) {
+    vector_status_t status = vector_ok(vec);
+    if (status != VECTOR_SUCCESS) { return status;}
+    placement &= ~(uint32_t)VECTOR_PLACEMENT_FALLBACK;
+    uint32_t caps = placement_caps(placement);
+    if (!caps) { return VECTOR_INVALID_ARGUMENT;}
+    if ((vector_placement(vec) & placement) == placement) { return VECTOR_SUCCESS;}        // Already there
+
+    size_t bytes = vec->size * sizeof_dtype(vec->type);
+    void *data = heap_caps_aligned_alloc(16, bytes, caps);
+    if (!data) { return VECTOR_ERROR;}
+    memcpy(data, vec->data, bytes);
+
+    if (vec->owns_data) { heap_caps_free(vec->data);}
+    vec->data = data;
+    vec->owns_data = true;                                                                  // The new buffer is always ours
+    return VECTOR_SUCCESS;
+}
+
 vector_status_t vector_ok(vector_t *vec) {
     if (!vec || !vec->data) { return VECTOR_NULL;}                                          // Vec or data pointer is NULL
-    if ((uint32_t)vec->data & 0xF) { return VECTOR_UNALIGNED_DATA;}                         // Data not 128-bit aligned
-    if (vec->type < DTYPE_INT8 || vec->type > DTYPE_FLOAT32) { return VECTOR_TYPE_MISMATCH;}// Invalid Type
+    if ((uintptr_t)vec->data & 0xF) { return VECTOR_UNALIGNED_DATA;}                        // Data not 128-bit aligned
+    if (vec->type < DTYPE_INT8 || vec->type > DTYPE_UINT32) { return VECTOR_TYPE_MISMATCH;}// Invalid Type
     return VECTOR_SUCCESS;                                                                  
 }
 
@@ -54,8 +106,8 @@ vector_status_t vector_destroy(vector_t *vec) {
 vector_status_t vector_set(vector_t *vec, void *data, size_t size, dtype type, bool owns_data) {
     if (!vec) { return VECTOR_NULL; }
     if (!data) { return VECTOR_NULL; }
-    if ((uint32_t)data & 0xF) { return VECTOR_UNALIGNED_DATA; }                             // Data not 128-bit aligned
-    if (type < DTYPE_INT8 || type > DTYPE_FLOAT32) { return VECTOR_TYPE_MISMATCH; }         // Invalid Type
+    if ((uintptr_t)data & 0xF) { return VECTOR_UNALIGNED_DATA; }                            // Data not 128-bit aligned
+    if (type < DTYPE_INT8 || type > DTYPE_UINT32) { return VECTOR_TYPE_MISMATCH; }         // Invalid Type
 
     vec->data = data;
     vec->size = size;
@@ -63,4 +115,18 @@ vector_status_t vector_set(vector_t *vec, void *data, size_t size, dtype type, b
     vec->owns_data = owns_data;
 
     return VECTOR_SUCCESS;
-}
\ No newline at end of file
+}
+
+vector_status_t vector_set_unaligned(vector_t *vec, void *data, size_t size, dtype type) {
+    if (!vec) { return VECTOR_NULL; }
+    if (!data) { return VECTOR_NULL; }
+    if (type < DTYPE_INT8 || type > DTYPE_UINT32) { return VECTOR_TYPE_MISMATCH; }         // Invalid Type
+    if ((uintptr_t)data & (sizeof_dtype(type) - 1)) { return VECTOR_UNALIGNED_DATA; }       // Scalar head/tail loads need natural alignment
+
+    vec->data = data;
+    vec->size = size;
+    vec->type = type;
+    vec->owns_data = false;
+
+    return VECTOR_SUCCESS;
+}
@@ -0,0 +1,163 @@
+#include "vector_arena.h"
+#include "esp_heap_caps.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(bytes) (((bytes) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+static bool dtype_valid(dtype type) {
+    return type >= DTYPE_INT8 && type <= DTYPE_UINT32;
+}
+
+vector_status_t vector_arena_init(vector_arena_t *arena, size_t capacity, uint32_t caps) {
+    if (!arena) { return VECTOR_NULL;}
+    if (capacity == 0) { return VECTOR_INVALID_ARGUMENT;}
+
+    capacity = ARENA_ROUND(capacity);
+    uint8_t *base = heap_caps_aligned_alloc(ARENA_ALIGN, capacity, caps);
+    if (!base) { return VECTOR_ERROR;}
+
+    arena->base = base;
+    arena->capacity = capacity;
+    arena->used = 0;
+    arena->high_water = 0;
+    arena->owns_buffer = true;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_arena_init_static(vector_arena_t *arena, void *buffer, size_t capacity) {
+    if (!arena || !buffer) { return VECTOR_NULL;}
+    if ((uintptr_t)buffer & 0xF) { return VECTOR_UNALIGNED_DATA;}                            // Data not 128-bit aligned
+
+    arena->base = buffer;
+    arena->capacity = capacity & ~(size_t)(ARENA_ALIGN - 1);                                // Trailing partial block is unusable
+    arena->used = 0;
+    arena->high_water = 0;
+    arena->owns_buffer = false;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_arena_deinit(vector_arena_t *arena) {
+    if (arena && arena->owns_buffer && arena->base) {
+        heap_caps_free(arena->base);
+    }
+    if (arena) { memset(arena, 0, sizeof(*arena));}
+    return VECTOR_SUCCESS;
+}
+
+void *vector_arena_alloc(vector_arena_t *arena, size_t bytes) {
+    if (!arena || !arena->base || bytes == 0) { return NULL;}
+    if (bytes > arena->capacity - arena->used) { return NULL;}                              // Checked before rounding to avoid overflow
+    bytes = ARENA_ROUND(bytes);
+    if (bytes > arena->capacity - arena->used) { return NULL;}
+
+    void *ptr = arena->base + arena->used;
+    arena->used += bytes;
+    if (arena->used > arena->high_water) { arena->high_water = arena->used;}
+    return ptr;
+}
+
+vector_t *vector_arena_create(vector_arena_t *arena, size_t size, dtype type) {
+    if (!dtype_valid(type) || size == 0) { return NULL;}
+    if (size > SIZE_MAX / sizeof_dtype(type)) { return NULL;}
+    size_t mark = vector_arena_mark(arena);
+
+    vector_t *vec = vector_arena_alloc(arena, sizeof(vector_t));
+    if (!vec) { return NULL;}
+    void *data = vector_arena_alloc(arena, size * sizeof_dtype(type));
+    if (!data) {
+        vector_arena_rewind(arena, mark);                                                   // Give the struct back
+        return NULL;
+    }
+
+    vec->data = data;
+    vec->type = type;
+    vec->size = size;
+    vec->owns_data = false;                                                                 // The arena owns the memory
+    return vec;
+}
+
+size_t vector_arena_mark(const vector_arena_t *arena) {
+    return arena ? arena->used : 0;
+}
+
+vector_status_t vector_arena_rewind(vector_arena_t *arena, size_t mark) {
+    if (!arena) { return VECTOR_NULL;}
+    if (mark > arena->used) { return VECTOR_INVALID_ARGUMENT;}
+    arena->used = mark;
+    return VECTOR_SUCCESS;
+}
+
+void vector_arena_reset(vector_arena_t *arena) {
+    if (arena) { arena->used = 0;}
+}
+
+vector_status_t vector_pool_init(vector_pool_t *pool, size_t block_bytes, size_t block_count, uint32_t caps) {
+    if (!pool) { return VECTOR_NULL;}
+    if (block_bytes == 0 || block_count == 0) { return VECTOR_INVALID_ARGUMENT;}
+
+    block_bytes = ARENA_ROUND(block_bytes);                                                 // Also leaves room for the free-list link
+    if (block_count > SIZE_MAX / block_bytes) { return VECTOR_INVALID_ARGUMENT;}
+
+    uint8_t *blocks = heap_caps_aligned_alloc(ARENA_ALIGN, block_bytes * block_count, caps);
+    vector_t *vectors = calloc(block_count, sizeof(vector_t));                             // Headers need no special placement
+    if (!blocks || !vectors) {
+        if (blocks) { heap_caps_free(blocks);}
+        free(vectors);
+        return VECTOR_ERROR;
+    }
+
+    void *next = NULL;                                                                      // Thread the free list, lowest block first
+    for (size_t i = block_count; i-- > 0;) {
+        void *block = blocks + i * block_bytes;
+        memcpy(block, &next, sizeof(next));
+        next = block;
+    }
+
+    pool->blocks = blocks;
+    pool->vectors = vectors;
+    pool->free_list = next;
+    pool->block_bytes = block_bytes;
+    pool->block_count = block_count;
+    pool->free_count = block_count;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_pool_deinit(vector_pool_t *pool) {
+    if (!pool) { return VECTOR_SUCCESS;}
+    if (pool->blocks) { heap_caps_free(pool->blocks);}
+    free(pool->vectors);
+    memset(pool, 0, sizeof(*pool));
+    return VECTOR_SUCCESS;
+}
+
+vector_t *vector_pool_create(vector_pool_t *pool, size_t size, dtype type) {
+    if (!pool || !pool->free_list) { return NULL;}                                          // Uninitialized or exhausted
+    if (!dtype_valid(type) || size == 0) { return NULL;}
+    if (size > pool->block_bytes / sizeof_dtype(type)) { return NULL;}                      // Does not fit the size class
+
+    uint8_t *block = pool->free_list;
+    memcpy(&pool->free_list, block, sizeof(pool->free_list));
+    pool->free_count--;
+
+    vector_t *vec = &pool->vectors[(size_t)(block - pool->blocks) / pool->block_bytes];
+    vec->data = block;
+    vec->type = type;
+    vec->size = size;
+    vec->owns_data = false;                                                                 // The pool owns the memory
+    return vec;
+}
+
+vector_status_t vector_pool_release(vector_pool_t *pool, vector_t *vec) {
+    if (!pool || !vec) { return VECTOR_NULL;}
+    if (!pool->vectors || vec < pool->vectors || vec >= pool->vectors + pool->block_count) { return VECTOR_INVALID_ARGUMENT;}
+    if (!vec->data) { return VECTOR_INVALID_ARGUMENT;}                                      // Already released
+
+    uint8_t *block = pool->blocks + (size_t)(vec - pool->vectors) * pool->block_bytes;
+    memcpy(block, &pool->free_list, sizeof(pool->free_list));
+    pool->free_list = block;
+    pool->free_count++;
+    vec->data = NULL;
+    return VECTOR_SUCCESS;
+}
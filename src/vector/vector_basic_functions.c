@@ -1,46 +1,48 @@
 #include "vector_basic_functions.h"
 #include "simd_functions.h"
+#include "vector_dispatch_table.h"
+#include <math.h>
+
+// Thunks adapting the sum and dot product kernels to vector_reduce_kernel_t, for vector_dispatch_reduce()
+#define SUM_THUNK(kernel, T, R)                                                                             \
+    static int kernel##_thunk(const void *a, const void *b, void *result, size_t size) {                    \
+        (void)b;                                                                                            \
+        return kernel((const T*)a, (R*)result, size);                                                       \
+    }
+
+#define DOTP_THUNK(kernel, T, R)                                                                            \
+    static int kernel##_thunk(const void *a, const void *b, void *result, size_t size) {                    \
+        return kernel((const T*)a, (const T*)b, (R*)result, size);                                          \
+    }
+
+SUM_THUNK(simd_sum_i8, int8_t, int32_t)
+SUM_THUNK(simd_sum_i16, int16_t, int32_t)
+SUM_THUNK(simd_sum_i32, int32_t, int32_t)
+SUM_THUNK(simd_sum_f32, float, float)
+SUM_THUNK(simd_sum_u8, uint8_t, uint32_t)
+SUM_THUNK(simd_sum_u16, uint16_t, uint32_t)
+SUM_THUNK(simd_sum_u32, uint32_t, uint32_t)
+SUM_THUNK(simd_sum_wide_i8, int8_t, int64_t)
+SUM_THUNK(simd_sum_wide_i16, int16_t, int64_t)
+SUM_THUNK(simd_sum_wide_i32, int32_t, int64_t)
+DOTP_THUNK(simd_dotp_i8, int8_t, int32_t)
+DOTP_THUNK(simd_dotp_i16, int16_t, int32_t)
+DOTP_THUNK(simd_dotp_i32, int32_t, int32_t)
+DOTP_THUNK(simd_dotp_f32, float, float)
+DOTP_THUNK(simd_dotp_wide_i8, int8_t, int64_t)
+DOTP_THUNK(simd_dotp_wide_i16, int16_t, int64_t)
+DOTP_THUNK(simd_dotp_wide_i32, int32_t, int64_t)
 
 vector_status_t vec_add(const vector_t *vec1, const vector_t *vec2, vector_t *result) { 
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;} 
     if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
-    switch (vec1->type) {
-        case DTYPE_INT8: {
-            return simd_add_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size); 
-        }
-        case DTYPE_INT16: { 
-            return simd_add_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case DTYPE_INT32: {
-            return simd_add_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size); 
-        }
-        case DTYPE_FLOAT32: {
-            return simd_add_f32((float*)(vec1->data), (float*)(vec2->data), (float*)(result->data), vec1->size); 
-        }
-        default:
-            return VECTOR_ERROR; 
-    }   
+    return vector_dispatch_binary(VECTOR_OP_ADD, vec1, vec2, result, 0);
 }
  
 vector_status_t vec_sub(const vector_t *vec1, const vector_t *vec2, vector_t *result) {  
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;} 
-    switch (vec1->type) {
-        case DTYPE_INT8: {
-            return simd_sub_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size);                                             
-        }
-        case DTYPE_INT16: {
-            return simd_sub_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case DTYPE_INT32: {
-            return simd_sub_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size); 
-        }
-        case DTYPE_FLOAT32: { 
-            return simd_sub_f32((float*)(vec1->data), (float*)(vec2->data), (float*)(result->data), vec1->size);  
-        }
-        default:
-            return VECTOR_ERROR;                                  
-    } 
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_SUB, vec1, vec2, result, 0);
 }
 
 vector_status_t vec_add_scalar(const vector_t *vec1, const int value, vector_t *result) { 
@@ -88,57 +90,110 @@ vector_status_t vec_add_scalar_f32(const vector_t *vec1, const float value, vect
 
 vector_status_t vec_mul(const vector_t *vec1, const vector_t *vec2, vector_t *result, const unsigned int shift_amount) { 
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}  
-    switch (vec1->type) {
-        case DTYPE_INT8: { 
-            return simd_mul_shift_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), shift_amount, vec1->size);
-        }
-        case DTYPE_INT16: { 
-            return simd_mul_shift_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), shift_amount, vec1->size); 
-        }
-        case DTYPE_INT32: { 
-            return simd_mul_shift_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), shift_amount, vec1->size);
-        }
-        case DTYPE_FLOAT32: {
-            return simd_mul_shift_f32((float*)(vec1->data), (float*)(vec2->data), (float*)(result->data), shift_amount, vec1->size);  
-        }
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_MUL, vec1, vec2, result, shift_amount);
+}
+
+vector_status_t vec_fma(const vector_t *vec1, const vector_t *vec2, const vector_t *vec3, vector_t *result, const unsigned int shift_amount) { 
+    if (vec1->size != vec2->size || vec1->size != vec3->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
+    if (vec1->type != vec2->type || vec1->type != vec3->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    switch (vec1->type){
+        case DTYPE_INT8:
+            return simd_fma_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(vec3->data), (int8_t*)(result->data), shift_amount, vec1->size);
+        case DTYPE_INT16:
+            return simd_fma_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(vec3->data), (int16_t*)(result->data), shift_amount, vec1->size);
+        case DTYPE_INT32:
+            return simd_fma_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(vec3->data), (int32_t*)(result->data), shift_amount, vec1->size);
+        case DTYPE_FLOAT32:
+            return simd_fma_f32((float*)(vec1->data), (float*)(vec2->data), (float*)(vec3->data), (float*)(result->data), shift_amount, vec1->size);
+        case DTYPE_UINT8:
+            return simd_fma_u8((uint8_t*)(vec1->data), (uint8_t*)(vec2->data), (uint8_t*)(vec3->data), (uint8_t*)(result->data), shift_amount, vec1->size);
+        case DTYPE_UINT16:
+            return simd_fma_u16((uint16_t*)(vec1->data), (uint16_t*)(vec2->data), (uint16_t*)(vec3->data), (uint16_t*)(result->data), shift_amount, vec1->size);
+        case DTYPE_UINT32:
+            return simd_fma_u32((uint32_t*)(vec1->data), (uint32_t*)(vec2->data), (uint32_t*)(vec3->data), (uint32_t*)(result->data), shift_amount, vec1->size);
         default:
-            return VECTOR_ERROR; 
-    }  
+            return VECTOR_ERROR;
+    }
 }
 
 vector_status_t vec_sum(const vector_t *vec1, int32_t* result){ 
     switch (vec1->type){
         case(DTYPE_INT8): { 
-            return simd_sum_i8((int8_t*)(vec1->data), result, vec1->size); 
+            return vector_dispatch_reduce(simd_sum_i8_thunk, vec1, NULL, result); 
         }
         case(DTYPE_INT16): {
-            return simd_sum_i16((int16_t*)(vec1->data), result, vec1->size); 
+            return vector_dispatch_reduce(simd_sum_i16_thunk, vec1, NULL, result); 
         }
         case(DTYPE_INT32): {
-            return simd_sum_i32((int32_t*)(vec1->data), result, vec1->size); 
+            return vector_dispatch_reduce(simd_sum_i32_thunk, vec1, NULL, result); 
         }
         case(DTYPE_FLOAT32): {
             return VECTOR_UNSUPPORTED_OPERATION; // Please use vec_sum_f32
         }
+        case(DTYPE_UINT8):
+        case(DTYPE_UINT16):
+        case(DTYPE_UINT32): {
+            return VECTOR_UNSUPPORTED_OPERATION; // Please use vec_sum_unsigned
+        }
         default:
             return VECTOR_ERROR;
     } 
 }
 
+vector_status_t vec_sum_i64(const vector_t *vec1, int64_t* result){ 
+    switch (vec1->type){
+        case (DTYPE_INT8): {
+            return vector_dispatch_reduce_ex(simd_sum_wide_i8_thunk, vec1, NULL, result, true); 
+        }
+        case (DTYPE_INT16): {
+            return vector_dispatch_reduce_ex(simd_sum_wide_i16_thunk, vec1, NULL, result, true); 
+        }
+        case (DTYPE_INT32): {
+            return vector_dispatch_reduce_ex(simd_sum_wide_i32_thunk, vec1, NULL, result, true); 
+        }
+        case (DTYPE_FLOAT32): {
+            return VECTOR_UNSUPPORTED_OPERATION; // Please use vec_sum_f32
+        }
+        default:
+            return VECTOR_UNSUPPORTED_OPERATION; // Unsigned sums fit vec_sum_unsigned
+    }
+}
+
 vector_status_t vec_sum_f32(const vector_t *vec1, float* result){ 
     switch (vec1->type){
         case(DTYPE_INT8): return VECTOR_UNSUPPORTED_OPERATION;  
         case(DTYPE_INT16): return VECTOR_UNSUPPORTED_OPERATION;   
         case(DTYPE_INT32): return VECTOR_UNSUPPORTED_OPERATION;  
         case(DTYPE_FLOAT32):  {
-            return simd_sum_f32((float*)vec1->data, result, vec1->size); // Please use vec_sum
+            return vector_dispatch_reduce(simd_sum_f32_thunk, vec1, NULL, result);
         }
         default:
             return VECTOR_ERROR;
     } 
 }
 
+vector_status_t vec_sum_unsigned(const vector_t *vec1, uint32_t* result){ 
+    switch (vec1->type){
+        case(DTYPE_UINT8): {
+            return vector_dispatch_reduce(simd_sum_u8_thunk, vec1, NULL, result); 
+        }
+        case(DTYPE_UINT16): {
+            return vector_dispatch_reduce(simd_sum_u16_thunk, vec1, NULL, result); 
+        }
+        case(DTYPE_UINT32): {
+            return vector_dispatch_reduce(simd_sum_u32_thunk, vec1, NULL, result); 
+        }
+        case(DTYPE_INT8):
+        case(DTYPE_INT16):
+        case(DTYPE_INT32):
+        case(DTYPE_FLOAT32): 
+            return VECTOR_UNSUPPORTED_OPERATION; // Please use vec_sum or vec_sum_f32
+        default:
+            return VECTOR_ERROR;
+    } 
+}
+
 vector_status_t vec_mul_scalar(const vector_t *vec1, const int value, vector_t *result, const unsigned int shift_amount) {  
     if (vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;} 
     if (vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}  
@@ -185,13 +240,13 @@ vector_status_t vec_dotp(const vector_t *vec1, const vector_t *vec2, int32_t *re
     if (vec1->type != vec2->type) { return VECTOR_TYPE_MISMATCH;}   
     switch (vec1->type){
         case (DTYPE_INT8): {
-            return simd_dotp_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), result,vec1->size); 
+            return vector_dispatch_reduce(simd_dotp_i8_thunk, vec1, vec2, result); 
         }
         case (DTYPE_INT16): {
-            return simd_dotp_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), result,vec1->size); 
+            return vector_dispatch_reduce(simd_dotp_i16_thunk, vec1, vec2, result); 
         }
         case (DTYPE_INT32): {
-            return simd_dotp_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), result,vec1->size); 
+            return vector_dispatch_reduce(simd_dotp_i32_thunk, vec1, vec2, result); 
         }
         case (DTYPE_FLOAT32): { 
             return VECTOR_UNSUPPORTED_OPERATION; // Please use vec_dotp_f32
@@ -201,6 +256,27 @@ vector_status_t vec_dotp(const vector_t *vec1, const vector_t *vec2, int32_t *re
     }
 }
 
+vector_status_t vec_dotp_i64(const vector_t *vec1, const vector_t *vec2, int64_t *result){
+    if (vec1->size != vec2->size ) { return VECTOR_SIZE_MISMATCH;}  
+    if (vec1->type != vec2->type) { return VECTOR_TYPE_MISMATCH;}   
+    switch (vec1->type){
+        case (DTYPE_INT8): {
+            return vector_dispatch_reduce_ex(simd_dotp_wide_i8_thunk, vec1, vec2, result, true); 
+        }
+        case (DTYPE_INT16): {
+            return vector_dispatch_reduce_ex(simd_dotp_wide_i16_thunk, vec1, vec2, result, true); 
+        }
+        case (DTYPE_INT32): {
+            return vector_dispatch_reduce_ex(simd_dotp_wide_i32_thunk, vec1, vec2, result, true); 
+        }
+        case (DTYPE_FLOAT32): { 
+            return VECTOR_UNSUPPORTED_OPERATION; // Please use vec_dotp_f32
+        }
+        default:
+            return VECTOR_UNSUPPORTED_OPERATION; 
+    }
+}
+
 vector_status_t vec_dotp_f32(const vector_t *vec1, const vector_t *vec2, float *result){   
     if (vec1->size != vec2->size ) { return VECTOR_SIZE_MISMATCH;}  
     if (vec1->type != vec2->type) { return VECTOR_TYPE_MISMATCH;}   
@@ -210,7 +286,7 @@ vector_status_t vec_dotp_f32(const vector_t *vec1, const vector_t *vec2, float *
         case (DTYPE_INT16):  return VECTOR_UNSUPPORTED_OPERATION;
         case (DTYPE_INT32):  return VECTOR_UNSUPPORTED_OPERATION;
         case (DTYPE_FLOAT32): {
-            return simd_dotp_f32((float*)(vec1->data), (float*)(vec2->data), result,vec1->size); 
+            return vector_dispatch_reduce(simd_dotp_f32_thunk, vec1, vec2, result); 
         }
         default:
             return VECTOR_ERROR;  
@@ -219,24 +295,8 @@ vector_status_t vec_dotp_f32(const vector_t *vec1, const vector_t *vec2, float *
 
 vector_status_t vec_abs(const vector_t *vec1, vector_t* result){ 
     if (vec1->size != result->size ) { return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != result->type) { return VECTOR_TYPE_MISMATCH;}   
-
-    switch (vec1->type){
-        case (DTYPE_INT8): {
-            return simd_abs_i8((int8_t*)(vec1->data), (int8_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT16): {
-            return simd_abs_i16((int16_t*)(vec1->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT32): { 
-            return simd_abs_i32((int32_t*)(vec1->data), (int32_t*)(result->data), vec1->size);
-        };
-        case (DTYPE_FLOAT32): { 
-            return simd_abs_f32((float*)(vec1->data), (float*)(result->data), vec1->size);
-        };
-        default:
-            return VECTOR_ERROR;
-    }
+    if (vec1->type != result->type) { return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_unary(VECTOR_OP_ABS, vec1, result);
 }
 
 vector_status_t vec_ceil(const vector_t *vec1, vector_t* result, const int ceiling){ 
@@ -323,48 +383,60 @@ vector_status_t vec_floor_f32(const vector_t *vec1, vector_t* result, const floa
 
 vector_status_t vec_neg(const vector_t *vec1, vector_t* result){  
     if (vec1->size != result->size ) { return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != result->type) { return VECTOR_TYPE_MISMATCH;}  
+    if (vec1->type != result->type) { return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_unary(VECTOR_OP_NEG, vec1, result);
+}
+
+vector_status_t vec_mac(const vector_t *vec1, int32_t* accumulator, const int multiplier){  
+    if (!accumulator) { return VECTOR_INVALID_ARGUMENT;}
     switch (vec1->type){
         case (DTYPE_INT8): {
-            return simd_neg_i8((int8_t*)(vec1->data), (int8_t*)(result->data), vec1->size); 
+            if (multiplier < INT8_MIN || multiplier > INT8_MAX) { return VECTOR_INVALID_ARGUMENT;}
+            int8_t multiplier_i8 = (int8_t)multiplier;
+            return simd_mac_i8((int8_t*)(vec1->data), accumulator, &multiplier_i8, vec1->size); 
         }
         case (DTYPE_INT16): {
-            return simd_neg_i16((int16_t*)(vec1->data), (int16_t*)(result->data), vec1->size); 
+            if (multiplier < INT16_MIN || multiplier > INT16_MAX) { return VECTOR_INVALID_ARGUMENT;}
+            int16_t multiplier_i16 = (int16_t)multiplier;
+            return simd_mac_i16((int16_t*)(vec1->data), accumulator, &multiplier_i16, vec1->size); 
         }
         case (DTYPE_INT32): { 
-            return simd_neg_i32((int32_t*)(vec1->data), (int32_t*)(result->data), vec1->size); 
+            int32_t multiplier_i32 = (int32_t)multiplier;
+            return simd_mac_i32((int32_t*)(vec1->data), accumulator, &multiplier_i32, vec1->size); 
         }
-        case (DTYPE_FLOAT32): { 
-            return simd_neg_f32((float*)(vec1->data), (float*)(result->data), vec1->size); 
+        case (DTYPE_FLOAT32): {
+            return VECTOR_UNSUPPORTED_OPERATION;
         }
         default:
             return VECTOR_ERROR;
     }
 }
 
-vector_status_t vec_mac(const vector_t *vec1, int32_t* accumulator, const int multiplier){  
+vector_status_t vec_mac_i64(const vector_t *vec1, int64_t* accumulator, const int multiplier){  
     if (!accumulator) { return VECTOR_INVALID_ARGUMENT;}
     switch (vec1->type){
         case (DTYPE_INT8): {
             if (multiplier < INT8_MIN || multiplier > INT8_MAX) { return VECTOR_INVALID_ARGUMENT;}
-            int8_t multiplier_i8 = (int8_t)multiplier;
-            return simd_mac_i8((int8_t*)(vec1->data), accumulator, &multiplier_i8, vec1->size); 
+            break;
         }
         case (DTYPE_INT16): {
             if (multiplier < INT16_MIN || multiplier > INT16_MAX) { return VECTOR_INVALID_ARGUMENT;}
-            int16_t multiplier_i16 = (int16_t)multiplier;
-            return simd_mac_i16((int16_t*)(vec1->data), accumulator, &multiplier_i16, vec1->size); 
+            break;
         }
-        case (DTYPE_INT32): { 
-            int32_t multiplier_i32 = (int32_t)multiplier;
-            return simd_mac_i32((int32_t*)(vec1->data), accumulator, &multiplier_i32, vec1->size); 
+        case (DTYPE_INT32): {
+            break;
         }
         case (DTYPE_FLOAT32): {
             return VECTOR_UNSUPPORTED_OPERATION;
         }
         default:
-            return VECTOR_ERROR;
+            return VECTOR_UNSUPPORTED_OPERATION;
     }
+    int64_t sum;                                                    // sum(a[i] * m) = m * sum(a[i]): one multiply after the wide sum
+    vector_status_t status = vec_sum_i64(vec1, &sum);
+    if (status != VECTOR_SUCCESS) { return status;}
+    *accumulator = (int64_t)((uint64_t)*accumulator + (uint64_t)sum * (uint64_t)(int64_t)multiplier);
+    return VECTOR_SUCCESS;
 }
 
 vector_status_t vec_mac_f32(const vector_t *vec1, float* accumulator, const float multiplier){  
@@ -461,30 +533,22 @@ vector_status_t vec_fill_f32(vector_t *vec1, const float val){
 
 vector_status_t vec_copy(vector_t *vec1, vector_t *result){ 
     if (vec1->size != result->size ) { return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != result->type) { return VECTOR_TYPE_MISMATCH;}  
-    switch (vec1->type){
-        case (DTYPE_INT8): {   
-            return simd_copy_i8((int8_t*)(vec1->data), (int8_t*)(result->data), vec1->size);
-        }
-        case (DTYPE_INT16): {  
-            return simd_copy_i16((int16_t*)(vec1->data), (int16_t*)(result->data), vec1->size);
-        }
-        case (DTYPE_INT32): {   
-            return simd_copy_i32((int32_t*)(vec1->data), (int32_t*)(result->data), vec1->size);
-        }
-        case (DTYPE_FLOAT32): {
-            return simd_copy_i32((int32_t*)(vec1->data), (int32_t*)(result->data), vec1->size);
-        }
-        default:
-            return VECTOR_ERROR;
-    }
+    if (vec1->type != result->type) { return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_unary(VECTOR_OP_COPY, vec1, result);
 }
 
 vector_status_t vec_convert(const vector_t *src, vector_t *dst){
+    return vec_convert_shift(src, dst, 0);
+}
+
+static const float unit_scale = 1.0f;
+
+vector_status_t vec_convert_shift(const vector_t *src, vector_t *dst, const unsigned int shift_amount){
     if (src->type == dst->type) { return VECTOR_INVALID_ARGUMENT;}
     if (src->size != dst->size ) { return VECTOR_SIZE_MISMATCH;}
     switch(src->type){
         case DTYPE_INT8:{
+            if (shift_amount) { return VECTOR_INVALID_ARGUMENT;}                                // Widening only
             switch(dst->type){ 
                 case DTYPE_INT16:{
                     return simd_i8_to_i16((int8_t*)(src->data), (int16_t*)(dst->data), src->size);
@@ -493,7 +557,7 @@ vector_status_t vec_convert(const vector_t *src, vector_t *dst){
                     return simd_i8_to_i32((int8_t*)(src->data), (int32_t*)(dst->data), src->size); 
                 }
                 case DTYPE_FLOAT32:{
-                    return VECTOR_NOT_IMPLEMENTED;
+                    return simd_i8_to_f32((int8_t*)(src->data), (float*)(dst->data), &unit_scale, 0, src->size);
                 }
                 default:
                     return VECTOR_ERROR;
@@ -502,14 +566,15 @@ vector_status_t vec_convert(const vector_t *src, vector_t *dst){
         case DTYPE_INT16:{
             switch(dst->type){ 
                 case DTYPE_INT8:{
-                    return VECTOR_NOT_IMPLEMENTED;
-                    //return simd_i16_to_i8((int16_t*)(src->data), (int8_t*)(dst->data), src->size);
+                    return simd_i16_to_i8((int16_t*)(src->data), (int8_t*)(dst->data), shift_amount, src->size);
                 }
                 case DTYPE_INT32:{ 
+                    if (shift_amount) { return VECTOR_INVALID_ARGUMENT;}
                     return simd_i16_to_i32((int16_t*)(src->data), (int32_t*)(dst->data), src->size);
                 }
                 case DTYPE_FLOAT32:{
-                    return VECTOR_NOT_IMPLEMENTED;
+                    if (shift_amount) { return VECTOR_INVALID_ARGUMENT;}
+                    return simd_i16_to_f32((int16_t*)(src->data), (float*)(dst->data), &unit_scale, 0, src->size);
                 }
                 default:
                     return VECTOR_ERROR;
@@ -518,12 +583,10 @@ vector_status_t vec_convert(const vector_t *src, vector_t *dst){
         case DTYPE_INT32:{
             switch(dst->type){ 
                 case DTYPE_INT8:{
-                    return VECTOR_NOT_IMPLEMENTED;
-                    //return simd_i32_to_i8((int32_t*)(src->data), (int8_t*)(dst->data), src->size);
+                    return simd_i32_to_i8((int32_t*)(src->data), (int8_t*)(dst->data), shift_amount, src->size);
                 }
                 case DTYPE_INT16:{
-                    return VECTOR_NOT_IMPLEMENTED;
-                    //return simd_i32_to_i16((int32_t*)(src->data), (int16_t*)(dst->data), src->size);
+                    return simd_i32_to_i16((int32_t*)(src->data), (int16_t*)(dst->data), shift_amount, src->size);
                 }
                 case DTYPE_FLOAT32:{
                     return VECTOR_NOT_IMPLEMENTED;
@@ -533,9 +596,63 @@ vector_status_t vec_convert(const vector_t *src, vector_t *dst){
             }
         }
         case DTYPE_FLOAT32:{
-            return VECTOR_NOT_IMPLEMENTED;
+            if (shift_amount) { return VECTOR_INVALID_ARGUMENT;}
+            switch(dst->type){
+                case DTYPE_INT8:{
+                    return simd_f32_to_i8((float*)(src->data), (int8_t*)(dst->data), &unit_scale, 0, src->size);
+                }
+                case DTYPE_INT16:{
+                    return simd_f32_to_i16((float*)(src->data), (int16_t*)(dst->data), &unit_scale, 0, src->size);
+                }
+                case DTYPE_INT32:{
+                    return VECTOR_NOT_IMPLEMENTED;
+                }
+                default:
+                    return VECTOR_ERROR;
+            }
         }
         default:
             return VECTOR_ERROR;
     }   
 }
+
+static bool quantize_params_ok(const float scale, const int zero_point, const dtype type){
+    if (!(scale > 0.0f) || !isfinite(scale) || !isfinite(1.0f / scale)) { return false;}   // Rejects NaN, zero, negative, inf and denormals
+    switch(type){
+        case DTYPE_INT8:
+            return zero_point >= INT8_MIN && zero_point <= INT8_MAX;
+        case DTYPE_INT16:
+            return zero_point >= INT16_MIN && zero_point <= INT16_MAX;
+        default:
+            return true;
+    }
+}
+
+vector_status_t vec_quantize(const vector_t *src, vector_t *dst, const float scale, const int zero_point){
+    if (src->size != dst->size ) { return VECTOR_SIZE_MISMATCH;}
+    if (src->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (!quantize_params_ok(scale, zero_point, dst->type)) { return VECTOR_INVALID_ARGUMENT;}
+    const float inv_scale = 1.0f / scale;                                                       // One divide per call, a multiply per element
+    switch(dst->type){
+        case DTYPE_INT8:
+            return simd_f32_to_i8((float*)(src->data), (int8_t*)(dst->data), &inv_scale, zero_point, src->size);
+        case DTYPE_INT16:
+            return simd_f32_to_i16((float*)(src->data), (int16_t*)(dst->data), &inv_scale, zero_point, src->size);
+        default:
+            return VECTOR_UNSUPPORTED_OPERATION;
+    }
+}
+
+vector_status_t vec_dequantize(const vector_t *src, vector_t *dst, const float scale, const int zero_point){
+    if (src->size != dst->size ) { return VECTOR_SIZE_MISMATCH;}
+    if (dst->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (!quantize_params_ok(scale, zero_point, src->type)) { return VECTOR_INVALID_ARGUMENT;}
+    switch(src->type){
+        case DTYPE_INT8:
+            return simd_i8_to_f32((int8_t*)(src->data), (float*)(dst->data), &scale, zero_point, src->size);
+        case DTYPE_INT16:
+            return simd_i16_to_f32((int16_t*)(src->data), (float*)(dst->data), &scale, zero_point, src->size);
+        default:
+            return VECTOR_UNSUPPORTED_OPERATION;
+    }
+}
@@ -1,115 +1,51 @@
 #include "vector_compare_functions.h"
-#include "simd_functions.h"
+#include "vector_dispatch_table.h"
 
 
 vector_status_t vec_max(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;} 
-    
-    switch (vec1->type){
-        case (DTYPE_INT8): { 
-            return simd_max_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT16): { 
-            return simd_max_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT32): { 
-            return simd_max_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_FLOAT32): {
-            // return simd_max_f32((float*)(vec1->data), (float*)(vec2->data), (float*)(result->data), vec1->size);
-            return VECTOR_NOT_IMPLEMENTED;
-        }
-        default:
-            return VECTOR_ERROR;
-    }
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_MAX, vec1, vec2, result, 0);
 }
 
 vector_status_t vec_min(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;} 
-    
-    switch (vec1->type){
-        case (DTYPE_INT8): { 
-            return simd_min_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT16): { 
-            return simd_min_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT32): { 
-            return simd_min_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_FLOAT32): {
-            //return simd_min_f32((float*)(vec1->data), (float*)(vec2->data), (float*)(result->data), vec1->size);
-            return VECTOR_NOT_IMPLEMENTED;
-        }
-        default:
-            return VECTOR_ERROR;
-    }
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_MIN, vec1, vec2, result, 0);
 }
 
 vector_status_t vec_gt(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;} 
-
-    switch (vec1->type){
-        case (DTYPE_INT8): { 
-            return simd_compare_gt_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT16): { 
-            return simd_compare_gt_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT32): { 
-            return simd_compare_gt_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_FLOAT32): {
-            return VECTOR_NOT_IMPLEMENTED;
-        }
-        default:
-            return VECTOR_ERROR;
-    }
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_GT, vec1, vec2, result, 0);
 }
 
 vector_status_t vec_lt(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;} 
-
-    switch (vec1->type){
-        case (DTYPE_INT8): { 
-            return simd_compare_lt_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT16): { 
-            return simd_compare_lt_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT32): { 
-            return simd_compare_lt_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_FLOAT32): {
-            return VECTOR_NOT_IMPLEMENTED;
-        }
-        default:
-            return VECTOR_ERROR;
-    }
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_LT, vec1, vec2, result, 0);
 }
 
 vector_status_t vec_eq(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
     if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
-    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;} 
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_EQ, vec1, vec2, result, 0);
+}
+
+vector_status_t vec_ge(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
+    if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_GE, vec1, vec2, result, 0);
+}
 
-    switch (vec1->type){
-        case (DTYPE_INT8): { 
-            return simd_compare_eq_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT16): { 
-            return simd_compare_eq_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_INT32): { 
-            return simd_compare_eq_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size); 
-        }
-        case (DTYPE_FLOAT32): {
-            return VECTOR_NOT_IMPLEMENTED;
-        }
-        default:
-            return VECTOR_ERROR;
-    }
+vector_status_t vec_le(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
+    if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_LE, vec1, vec2, result, 0);
+}
+
+vector_status_t vec_ne(const vector_t *vec1, const vector_t *vec2, vector_t *result){ 
+    if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    return vector_dispatch_binary(VECTOR_OP_NE, vec1, vec2, result, 0);
 }
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include "vector_dispatch.h"
+#include "vector_dispatch_table.h"
+#include "simd_functions.h"
+
+// Thunks adapting each typed simd_* kernel to the type-erased table signatures. They compile to a single tail call.
+#define BINARY_THUNK(kernel, T)                                                                             \
+    static int kernel##_thunk(const void *a, const void *b, void *result, unsigned int shift_amount, size_t size) { \
+        (void)shift_amount;                                                                                 \
+        return kernel((const T*)a, (const T*)b, (T*)result, size);                                          \
+    }
+
+#define SHIFT_THUNK(kernel, T)                                                                              \
+    static int kernel##_thunk(const void *a, const void *b, void *result, unsigned int shift_amount, size_t size) { \
+        return kernel((const T*)a, (const T*)b, (T*)result, shift_amount, size);                            \
+    }
+
+// An integer comparison computed as the complement of another, e.g. a >= b as NOT(a < b), in place over the result
+#define COMPLEMENT_THUNK(name, kernel, not_kernel, T)                                                       \
+    static int name##_thunk(const void *a, const void *b, void *result, unsigned int shift_amount, size_t size) { \
+        (void)shift_amount;                                                                                 \
+        int status = kernel((const T*)a, (const T*)b, (T*)result, size);                                    \
+        if (status) { return status;}                                                                       \
+        return not_kernel(result, result, size);                                                            \
+    }
+
+#define UNARY_THUNK(kernel, T)                                                                              \
+    static int kernel##_thunk(const void *a, void *result, size_t size) {                                   \
+        return kernel((const T*)a, (T*)result, size);                                                       \
+    }
+
+#define BINARY_THUNKS_INT(op)                                                                               \
+    BINARY_THUNK(simd_##op##_i8, int8_t)                                                                    \
+    BINARY_THUNK(simd_##op##_i16, int16_t)                                                                  \
+    BINARY_THUNK(simd_##op##_i32, int32_t)
+
+#define BINARY_THUNKS_UINT(op)                                                                              \
+    BINARY_THUNK(simd_##op##_u8, uint8_t)                                                                   \
+    BINARY_THUNK(simd_##op##_u16, uint16_t)                                                                 \
+    BINARY_THUNK(simd_##op##_u32, uint32_t)
+
+#define UNARY_THUNKS_INT(op)                                                                                \
+    UNARY_THUNK(simd_##op##_i8, int8_t)                                                                     \
+    UNARY_THUNK(simd_##op##_i16, int16_t)                                                                   \
+    UNARY_THUNK(simd_##op##_i32, int32_t)
+
+BINARY_THUNKS_INT(add)
+BINARY_THUNKS_INT(sub)
+BINARY_THUNKS_INT(and)
+BINARY_THUNKS_INT(or)
+BINARY_THUNKS_INT(xor)
+BINARY_THUNKS_INT(max)
+BINARY_THUNKS_INT(min)
+BINARY_THUNKS_INT(compare_gt)
+BINARY_THUNKS_INT(compare_lt)
+BINARY_THUNKS_INT(compare_eq)
+BINARY_THUNKS_UINT(add)
+BINARY_THUNKS_UINT(sub)
+BINARY_THUNKS_UINT(max)
+BINARY_THUNKS_UINT(min)
+BINARY_THUNKS_UINT(compare_gt)
+BINARY_THUNKS_UINT(compare_lt)
+BINARY_THUNK(simd_add_f32, float)
+BINARY_THUNK(simd_sub_f32, float)
+BINARY_THUNK(simd_max_f32, float)
+BINARY_THUNK(simd_min_f32, float)
+BINARY_THUNK(simd_compare_gt_f32, float)
+BINARY_THUNK(simd_compare_lt_f32, float)
+BINARY_THUNK(simd_compare_eq_f32, float)
+BINARY_THUNK(simd_compare_ge_f32, float)
+BINARY_THUNK(simd_compare_le_f32, float)
+BINARY_THUNK(simd_compare_ne_f32, float)
+COMPLEMENT_THUNK(compare_ge_i8, simd_compare_lt_i8, simd_not_i8, int8_t)
+COMPLEMENT_THUNK(compare_ge_i16, simd_compare_lt_i16, simd_not_i16, int16_t)
+COMPLEMENT_THUNK(compare_ge_i32, simd_compare_lt_i32, simd_not_i32, int32_t)
+COMPLEMENT_THUNK(compare_le_i8, simd_compare_gt_i8, simd_not_i8, int8_t)
+COMPLEMENT_THUNK(compare_le_i16, simd_compare_gt_i16, simd_not_i16, int16_t)
+COMPLEMENT_THUNK(compare_le_i32, simd_compare_gt_i32, simd_not_i32, int32_t)
+COMPLEMENT_THUNK(compare_ne_i8, simd_compare_eq_i8, simd_not_i8, int8_t)
+COMPLEMENT_THUNK(compare_ne_i16, simd_compare_eq_i16, simd_not_i16, int16_t)
+COMPLEMENT_THUNK(compare_ne_i32, simd_compare_eq_i32, simd_not_i32, int32_t)
+COMPLEMENT_THUNK(compare_ge_u8, simd_compare_lt_u8, simd_not_i8, uint8_t)
+COMPLEMENT_THUNK(compare_ge_u16, simd_compare_lt_u16, simd_not_i16, uint16_t)
+COMPLEMENT_THUNK(compare_ge_u32, simd_compare_lt_u32, simd_not_i32, uint32_t)
+COMPLEMENT_THUNK(compare_le_u8, simd_compare_gt_u8, simd_not_i8, uint8_t)
+COMPLEMENT_THUNK(compare_le_u16, simd_compare_gt_u16, simd_not_i16, uint16_t)
+COMPLEMENT_THUNK(compare_le_u32, simd_compare_gt_u32, simd_not_i32, uint32_t)
+SHIFT_THUNK(simd_mul_shift_i8, int8_t)
+SHIFT_THUNK(simd_mul_shift_i16, int16_t)
+SHIFT_THUNK(simd_mul_shift_i32, int32_t)
+SHIFT_THUNK(simd_mul_shift_f32, float)
+SHIFT_THUNK(simd_mul_shift_u8, uint8_t)
+SHIFT_THUNK(simd_mul_shift_u16, uint16_t)
+SHIFT_THUNK(simd_mul_shift_u32, uint32_t)
+
+UNARY_THUNKS_INT(abs)
+UNARY_THUNKS_INT(neg)
+UNARY_THUNKS_INT(not)
+UNARY_THUNKS_INT(copy)
+UNARY_THUNK(simd_abs_f32, float)
+UNARY_THUNK(simd_neg_f32, float)
+
+// Rows follow vector_binary_op_t, columns follow dtype. Bitwise FLOAT32 ops reuse the int32_t kernels on the raw bits,
+// and unsigned bitwise ops and equality reuse the signed kernels of the same width. Integer GE, LE and NE complement
+// LT, GT and EQ; FLOAT32 has its own kernels for them, as NaN makes every comparison false and only NE true.
+const vector_binary_kernel_t vector_binary_kernels[VECTOR_BINARY_OP_COUNT][VECTOR_DISPATCH_DTYPES] = {
+    [VECTOR_OP_ADD] = { simd_add_i8_thunk,          simd_add_i16_thunk,         simd_add_i32_thunk,         simd_add_f32_thunk,
+                        simd_add_u8_thunk,          simd_add_u16_thunk,         simd_add_u32_thunk },
+    [VECTOR_OP_SUB] = { simd_sub_i8_thunk,          simd_sub_i16_thunk,         simd_sub_i32_thunk,         simd_sub_f32_thunk,
+                        simd_sub_u8_thunk,          simd_sub_u16_thunk,         simd_sub_u32_thunk },
+    [VECTOR_OP_MUL] = { simd_mul_shift_i8_thunk,    simd_mul_shift_i16_thunk,   simd_mul_shift_i32_thunk,   simd_mul_shift_f32_thunk,
+                        simd_mul_shift_u8_thunk,    simd_mul_shift_u16_thunk,   simd_mul_shift_u32_thunk },
+    [VECTOR_OP_AND] = { simd_and_i8_thunk,          simd_and_i16_thunk,         simd_and_i32_thunk,         simd_and_i32_thunk,
+                        simd_and_i8_thunk,          simd_and_i16_thunk,         simd_and_i32_thunk },
+    [VECTOR_OP_OR]  = { simd_or_i8_thunk,           simd_or_i16_thunk,          simd_or_i32_thunk,          simd_or_i32_thunk,
+                        simd_or_i8_thunk,           simd_or_i16_thunk,          simd_or_i32_thunk },
+    [VECTOR_OP_XOR] = { simd_xor_i8_thunk,          simd_xor_i16_thunk,         simd_xor_i32_thunk,         simd_xor_i32_thunk,
+                        simd_xor_i8_thunk,          simd_xor_i16_thunk,         simd_xor_i32_thunk },
+    [VECTOR_OP_MAX] = { simd_max_i8_thunk,          simd_max_i16_thunk,         simd_max_i32_thunk,         simd_max_f32_thunk,
+                        simd_max_u8_thunk,          simd_max_u16_thunk,         simd_max_u32_thunk },
+    [VECTOR_OP_MIN] = { simd_min_i8_thunk,          simd_min_i16_thunk,         simd_min_i32_thunk,         simd_min_f32_thunk,
+                        simd_min_u8_thunk,          simd_min_u16_thunk,         simd_min_u32_thunk },
+    [VECTOR_OP_GT]  = { simd_compare_gt_i8_thunk,   simd_compare_gt_i16_thunk,  simd_compare_gt_i32_thunk,  simd_compare_gt_f32_thunk,
+                        simd_compare_gt_u8_thunk,   simd_compare_gt_u16_thunk,  simd_compare_gt_u32_thunk },
+    [VECTOR_OP_LT]  = { simd_compare_lt_i8_thunk,   simd_compare_lt_i16_thunk,  simd_compare_lt_i32_thunk,  simd_compare_lt_f32_thunk,
+                        simd_compare_lt_u8_thunk,   simd_compare_lt_u16_thunk,  simd_compare_lt_u32_thunk },
+    [VECTOR_OP_EQ]  = { simd_compare_eq_i8_thunk,   simd_compare_eq_i16_thunk,  simd_compare_eq_i32_thunk,  simd_compare_eq_f32_thunk,
+                        simd_compare_eq_i8_thunk,   simd_compare_eq_i16_thunk,  simd_compare_eq_i32_thunk },
+    [VECTOR_OP_GE]  = { compare_ge_i8_thunk,        compare_ge_i16_thunk,       compare_ge_i32_thunk,       simd_compare_ge_f32_thunk,
+                        compare_ge_u8_thunk,        compare_ge_u16_thunk,       compare_ge_u32_thunk },
+    [VECTOR_OP_LE]  = { compare_le_i8_thunk,        compare_le_i16_thunk,       compare_le_i32_thunk,       simd_compare_le_f32_thunk,
+                        compare_le_u8_thunk,        compare_le_u16_thunk,       compare_le_u32_thunk },
+    [VECTOR_OP_NE]  = { compare_ne_i8_thunk,        compare_ne_i16_thunk,       compare_ne_i32_thunk,       simd_compare_ne_f32_thunk,
+                        compare_ne_i8_thunk,        compare_ne_i16_thunk,       compare_ne_i32_thunk },
+};
+
+// ABS is the identity on unsigned dtypes; NEG has no unsigned meaning
+const vector_unary_kernel_t vector_unary_kernels[VECTOR_UNARY_OP_COUNT][VECTOR_DISPATCH_DTYPES] = {
+    [VECTOR_OP_ABS]  = { simd_abs_i8_thunk,         simd_abs_i16_thunk,         simd_abs_i32_thunk,         simd_abs_f32_thunk,
+                         simd_copy_i8_thunk,        simd_copy_i16_thunk,        simd_copy_i32_thunk },
+    [VECTOR_OP_NEG]  = { simd_neg_i8_thunk,         simd_neg_i16_thunk,         simd_neg_i32_thunk,         simd_neg_f32_thunk,
+                         NULL,                      NULL,                       NULL },
+    [VECTOR_OP_NOT]  = { simd_not_i8_thunk,         simd_not_i16_thunk,         simd_not_i32_thunk,         simd_not_i32_thunk,
+                         simd_not_i8_thunk,         simd_not_i16_thunk,         simd_not_i32_thunk },
+    [VECTOR_OP_COPY] = { simd_copy_i8_thunk,        simd_copy_i16_thunk,        simd_copy_i32_thunk,        simd_copy_i32_thunk,
+                         simd_copy_i8_thunk,        simd_copy_i16_thunk,        simd_copy_i32_thunk },
+};
+
+vector_binary_kernel_t vec_binary_kernel(vector_binary_op_t op, dtype type) {
+    if ((unsigned int)op >= VECTOR_BINARY_OP_COUNT) { return NULL;}
+    if ((unsigned int)type >= VECTOR_DISPATCH_DTYPES) { return NULL;}
+    return vector_binary_kernels[op][type];
+}
+
+vector_unary_kernel_t vec_unary_kernel(vector_unary_op_t op, dtype type) {
+    if ((unsigned int)op >= VECTOR_UNARY_OP_COUNT) { return NULL;}
+    if ((unsigned int)type >= VECTOR_DISPATCH_DTYPES) { return NULL;}
+    return vector_unary_kernels[op][type];
+}
+
+vector_status_t vec_prepare_binary(vector_binary_plan_t *plan, vector_binary_op_t op, const vector_t *vec1,
+                                   const vector_t *vec2, const vector_t *result, const unsigned int shift_amount) {
+    if (!plan || !vec1 || !vec2 || !result) { return VECTOR_NULL;}
+    if ((unsigned int)op >= VECTOR_BINARY_OP_COUNT) { return VECTOR_INVALID_ARGUMENT;}
+    if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    if ((unsigned int)vec1->type >= VECTOR_DISPATCH_DTYPES) { return VECTOR_ERROR;}
+
+    if (op == VECTOR_OP_MUL) {
+        switch (vec1->type) {
+            case DTYPE_INT8:
+            case DTYPE_UINT8:   if (shift_amount > 7)  { return VECTOR_INVALID_ARGUMENT;} break;
+            case DTYPE_INT16:
+            case DTYPE_UINT16:  if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;} break;
+            case DTYPE_INT32:
+            case DTYPE_UINT32:  if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;} break;
+            default:            break;                                                      // Ignored for FLOAT32
+        }
+    } else if (shift_amount) {
+        return VECTOR_INVALID_ARGUMENT;
+    }
+
+    vector_binary_kernel_t kernel = vector_binary_kernels[op][vec1->type];
+    if (!kernel) { return VECTOR_NOT_IMPLEMENTED;}
+
+    plan->kernel = kernel;
+    plan->type = vec1->type;
+    plan->size = vec1->size;
+    plan->shift_amount = shift_amount;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vec_prepare_unary(vector_unary_plan_t *plan, vector_unary_op_t op, const vector_t *vec1, const vector_t *result) {
+    if (!plan || !vec1 || !result) { return VECTOR_NULL;}
+    if ((unsigned int)op >= VECTOR_UNARY_OP_COUNT) { return VECTOR_INVALID_ARGUMENT;}
+    if (vec1->size != result->size) { return VECTOR_SIZE_MISMATCH;}
+    if (vec1->type != result->type) { return VECTOR_TYPE_MISMATCH;}
+    if ((unsigned int)vec1->type >= VECTOR_DISPATCH_DTYPES) { return VECTOR_ERROR;}
+
+    vector_unary_kernel_t kernel = vector_unary_kernels[op][vec1->type];
+    if (!kernel) { return VECTOR_NOT_IMPLEMENTED;}
+
+    plan->kernel = kernel;
+    plan->type = vec1->type;
+    plan->size = vec1->size;
+    return VECTOR_SUCCESS;
+}
@@ -0,0 +1,127 @@
+#ifndef VECTOR_DISPATCH_TABLE_H
+#define VECTOR_DISPATCH_TABLE_H
+
+#include "vector_dispatch.h"
+#include "simd_functions.h"
+#include <stdalign.h>
+#include <string.h>
+
+/**
+ * Internal dispatch tables, defined in vector_dispatch.c. A NULL entry means the op has no
+ * kernel for that dtype.
+ */
+extern const vector_binary_kernel_t vector_binary_kernels[VECTOR_BINARY_OP_COUNT][VECTOR_DISPATCH_DTYPES];
+extern const vector_unary_kernel_t vector_unary_kernels[VECTOR_UNARY_OP_COUNT][VECTOR_DISPATCH_DTYPES];
+
+/**
+ * Reduction kernel with the sum and dot product kernels' shape; @p b is NULL for sums and @p result
+ * points to an int32_t, uint32_t or float, or an int64_t for the wide kernels (@p wide set below).
+ */
+typedef int (*vector_reduce_kernel_t)(const void *a, const void *b, void *result, size_t size);
+
+/**
+ * Unaligned paths, defined in vector_unaligned.c. The elements before the result's (or for
+ * reductions, the first input's) first 16-byte boundary are peeled through an aligned buffer. The
+ * body then runs in place on operands sharing that alignment, and other operands are realigned
+ * tile by tile with simd_realign_u8. Pointers must still be aligned to the element size. Non-wide
+ * INT32 sums are not peeled: the whole input is realigned under one vector_sum_i32_t (below).
+ */
+vector_status_t vector_binary_unaligned(vector_binary_kernel_t kernel, const void *a, const void *b, void *result,
+                                        unsigned int shift_amount, size_t size, size_t elem);
+vector_status_t vector_unary_unaligned(vector_unary_kernel_t kernel, const void *a, void *result, size_t size, size_t elem);
+vector_status_t vector_reduce_unaligned(vector_reduce_kernel_t kernel, const void *a, const void *b, void *result, size_t size, dtype type, bool wide);
+
+/**
+ * simd_sum_i32 run piece by piece. Its four lanes saturate, so adding per-piece sums modulo 2^32
+ * is not the same as one call over the whole vector; the paths that reduce a vector in pieces
+ * carry the lanes across instead. Every piece but the last must hold a multiple of 4 elements,
+ * and every piece must be 16-byte aligned.
+ */
+typedef struct {
+    alignas(16) int32_t lanes[4];
+    uint32_t tail;                                                                          // Elements after the last full block, not saturated
+} vector_sum_i32_t;
+
+static inline void vector_sum_i32_begin(vector_sum_i32_t *sum) {
+    memset(sum, 0, sizeof(*sum));
+}
+
+static inline int vector_sum_i32_add(vector_sum_i32_t *sum, const int32_t *a, size_t size) {
+    const size_t body = size & ~(size_t)3;
+    for (size_t i = body; i < size; i++) {
+        sum->tail += (uint32_t)a[i];
+    }
+    return simd_sum_lanes_i32(a, sum->lanes, body);
+}
+
+static inline int32_t vector_sum_i32_end(const vector_sum_i32_t *sum) {
+    return (int32_t)((uint32_t)sum->lanes[0] + (uint32_t)sum->lanes[1] + (uint32_t)sum->lanes[2] + (uint32_t)sum->lanes[3] + sum->tail);
+}
+
+/**
+ * Parallel mode, defined in vector_parallel.c. vector_parallel_min_size is 0 while parallel mode is
+ * off; otherwise the dispatch helpers hand vectors of at least that many elements to the split
+ * paths below, which run one half on the worker and fall back to the calling core when it is busy.
+ */
+extern volatile size_t vector_parallel_min_size;
+
+vector_status_t vector_parallel_binary(vector_binary_kernel_t kernel, const void *a, const void *b, void *result,
+                                       unsigned int shift_amount, size_t size, size_t elem);
+vector_status_t vector_parallel_unary(vector_unary_kernel_t kernel, const void *a, void *result, size_t size, size_t elem);
+vector_status_t vector_parallel_reduce(vector_reduce_kernel_t kernel, const void *a, const void *b, void *result, size_t size, dtype type, bool wide);
+
+static inline bool vector_parallel_wanted(size_t size) {
+    size_t min_size = vector_parallel_min_size;
+    return min_size && size >= min_size;
+}
+
+// True if any of the OR-ed addresses is not 16-byte aligned
+static inline bool vector_misaligned(uintptr_t addresses) {
+    return (addresses & 0xF) != 0;
+}
+
+// Shared tail of the element-wise wrappers, called once size and type have been checked
+static inline vector_status_t vector_dispatch_binary(vector_binary_op_t op, const vector_t *vec1, const vector_t *vec2, vector_t *result, const unsigned int shift_amount) {
+    if ((unsigned int)vec1->type >= VECTOR_DISPATCH_DTYPES) { return VECTOR_ERROR;}
+    vector_binary_kernel_t kernel = vector_binary_kernels[op][vec1->type];
+    if (!kernel) { return VECTOR_NOT_IMPLEMENTED;}
+    if (vector_parallel_wanted(vec1->size)) {
+        return vector_parallel_binary(kernel, vec1->data, vec2->data, result->data, shift_amount, vec1->size, sizeof_dtype(vec1->type));
+    }
+    if (vector_misaligned((uintptr_t)vec1->data | (uintptr_t)vec2->data | (uintptr_t)result->data)) {
+        return vector_binary_unaligned(kernel, vec1->data, vec2->data, result->data, shift_amount, vec1->size, sizeof_dtype(vec1->type));
+    }
+    return (vector_status_t)kernel(vec1->data, vec2->data, result->data, shift_amount, vec1->size);
+}
+
+static inline vector_status_t vector_dispatch_unary(vector_unary_op_t op, const vector_t *vec1, vector_t *result) {
+    if ((unsigned int)vec1->type >= VECTOR_DISPATCH_DTYPES) { return VECTOR_ERROR;}
+    vector_unary_kernel_t kernel = vector_unary_kernels[op][vec1->type];
+    if (!kernel) { return VECTOR_NOT_IMPLEMENTED;}
+    if (vector_parallel_wanted(vec1->size)) {
+        return vector_parallel_unary(kernel, vec1->data, result->data, vec1->size, sizeof_dtype(vec1->type));
+    }
+    if (vector_misaligned((uintptr_t)vec1->data | (uintptr_t)result->data)) {
+        return vector_unary_unaligned(kernel, vec1->data, result->data, vec1->size, sizeof_dtype(vec1->type));
+    }
+    return (vector_status_t)kernel(vec1->data, result->data, vec1->size);
+}
+
+// Shared tail of the reduction wrappers; @p vec2 is NULL for sums, @p wide is set for kernels with an int64_t result
+static inline vector_status_t vector_dispatch_reduce_ex(vector_reduce_kernel_t kernel, const vector_t *vec1, const vector_t *vec2,
+                                                        void *result, bool wide) {
+    const void *b = vec2 ? vec2->data : NULL;
+    if (vector_parallel_wanted(vec1->size)) {
+        return vector_parallel_reduce(kernel, vec1->data, b, result, vec1->size, vec1->type, wide);
+    }
+    if (vector_misaligned((uintptr_t)vec1->data | (uintptr_t)b)) {
+        return vector_reduce_unaligned(kernel, vec1->data, b, result, vec1->size, vec1->type, wide);
+    }
+    return (vector_status_t)kernel(vec1->data, b, result, vec1->size);
+}
+
+static inline vector_status_t vector_dispatch_reduce(vector_reduce_kernel_t kernel, const vector_t *vec1, const vector_t *vec2, void *result) {
+    return vector_dispatch_reduce_ex(kernel, vec1, vec2, result, false);
+}
+
+#endif
@@ -0,0 +1,346 @@
+#include "vector_expr.h"
+#include "simd_functions.h"
+#include "vector_dispatch_table.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+typedef enum {
+    EXPR_EVAL,                          // Materialize one root into a vector
+    EXPR_SUM,                           // Sum-reduce one root
+    EXPR_DOTP,                          // Dot product of two roots
+} expr_mode_t;
+
+typedef union {
+    int32_t i;
+    float f;
+    vector_sum_i32_t lanes;             // INT32 sums carry simd_sum_i32's saturating lanes across tiles
+} expr_acc_t;
+
+// Latches the first error; every later builder call becomes a no-op
+static int expr_fail(vector_expr_t *expr, vector_status_t status) {
+    if (expr->status == VECTOR_SUCCESS) { expr->status = status;}
+    return -1;
+}
+
+static bool expr_node_valid(const vector_expr_t *expr, int node) {
+    return node >= 0 && (size_t)node < expr->count;
+}
+
+// Common checks of every builder that takes operand nodes; returns the new node or NULL
+static vector_expr_node_t *expr_push(vector_expr_t *expr, vector_expr_kind_t kind, int a, int b) {
+    if (expr->status != VECTOR_SUCCESS) { return NULL;}
+    if (!expr_node_valid(expr, a) || (b != -1 && !expr_node_valid(expr, b))) { expr_fail(expr, VECTOR_INVALID_ARGUMENT); return NULL;}
+    if (expr->count == VECTOR_EXPR_MAX_NODES) { expr_fail(expr, VECTOR_INVALID_ARGUMENT); return NULL;}
+
+    vector_expr_node_t *node = &expr->nodes[expr->count];
+    memset(node, 0, sizeof(*node));
+    node->kind = kind;
+    node->a = a;
+    node->b = b;
+    return node;
+}
+
+// Size-1 stand-in with the expression's dtype, for reusing the vec_prepare_* checks
+static vector_t expr_template(const vector_expr_t *expr) {
+    vector_t tmpl = { .data = NULL, .type = expr->type, .size = 1, .owns_data = false };
+    return tmpl;
+}
+
+void vec_expr_init(vector_expr_t *expr) {
+    memset(expr, 0, sizeof(*expr));
+    expr->status = VECTOR_SUCCESS;
+}
+
+int vec_expr_input(vector_expr_t *expr, const vector_t *vec) {
+    if (!expr) { return -1;}
+    if (expr->status != VECTOR_SUCCESS) { return -1;}
+    if (!vec || !vec->data) { return expr_fail(expr, VECTOR_NULL);}
+    if (vec->type > DTYPE_UINT32) { return expr_fail(expr, VECTOR_ERROR);}
+    if ((uintptr_t)vec->data & 0xF) { return expr_fail(expr, VECTOR_UNALIGNED_DATA);}        // Tiles are read in place
+    if (expr->count == VECTOR_EXPR_MAX_NODES) { return expr_fail(expr, VECTOR_INVALID_ARGUMENT);}
+    if (expr->count == 0) {                                                                 // First input fixes dtype and size
+        expr->type = vec->type;
+        expr->size = vec->size;
+    } else {
+        if (vec->type != expr->type) { return expr_fail(expr, VECTOR_TYPE_MISMATCH);}
+        if (vec->size != expr->size) { return expr_fail(expr, VECTOR_SIZE_MISMATCH);}
+    }
+
+    vector_expr_node_t *node = &expr->nodes[expr->count];
+    memset(node, 0, sizeof(*node));
+    node->kind = VECTOR_EXPR_INPUT;
+    node->a = -1;
+    node->b = -1;
+    node->op.input = vec;
+    return (int)expr->count++;
+}
+
+int vec_expr_binary(vector_expr_t *expr, vector_binary_op_t op, int a, int b, unsigned int shift_amount) {
+    if (!expr) { return -1;}
+    vector_expr_node_t *node = expr_push(expr, VECTOR_EXPR_BINARY, a, b);
+    if (!node) { return -1;}
+
+    vector_t tmpl = expr_template(expr);
+    vector_binary_plan_t plan;
+    vector_status_t status = vec_prepare_binary(&plan, op, &tmpl, &tmpl, &tmpl, shift_amount);
+    if (status != VECTOR_SUCCESS) { return expr_fail(expr, status);}
+
+    node->op.binary = plan.kernel;
+    node->shift_amount = plan.shift_amount;
+    return (int)expr->count++;
+}
+
+int vec_expr_unary(vector_expr_t *expr, vector_unary_op_t op, int a) {
+    if (!expr) { return -1;}
+    vector_expr_node_t *node = expr_push(expr, VECTOR_EXPR_UNARY, a, -1);
+    if (!node) { return -1;}
+
+    vector_t tmpl = expr_template(expr);
+    vector_unary_plan_t plan;
+    vector_status_t status = vec_prepare_unary(&plan, op, &tmpl, &tmpl);
+    if (status != VECTOR_SUCCESS) { return expr_fail(expr, status);}
+
+    node->op.unary = plan.kernel;
+    return (int)expr->count++;
+}
+
+// Range check of an integer scalar against the expression's dtype, as vec_add_scalar/vec_mul_scalar do
+static vector_status_t expr_int_scalar(const vector_expr_t *expr, int value) {
+    switch (expr->type) {
+        case DTYPE_INT8:    return (value < INT8_MIN || value > INT8_MAX) ? VECTOR_INVALID_ARGUMENT : VECTOR_SUCCESS;
+        case DTYPE_INT16:   return (value < INT16_MIN || value > INT16_MAX) ? VECTOR_INVALID_ARGUMENT : VECTOR_SUCCESS;
+        case DTYPE_INT32:   return VECTOR_SUCCESS;
+        default:            return VECTOR_UNSUPPORTED_OPERATION;                            // FLOAT32 and unsigned types
+    }
+}
+
+int vec_expr_add_scalar(vector_expr_t *expr, int a, int value) {
+    if (!expr) { return -1;}
+    vector_expr_node_t *node = expr_push(expr, VECTOR_EXPR_ADD_SCALAR, a, -1);
+    if (!node) { return -1;}
+    vector_status_t status = expr_int_scalar(expr, value);
+    if (status != VECTOR_SUCCESS) { return expr_fail(expr, status);}
+
+    node->scalar.i = value;
+    return (int)expr->count++;
+}
+
+int vec_expr_add_scalar_f32(vector_expr_t *expr, int a, float value) {
+    if (!expr) { return -1;}
+    vector_expr_node_t *node = expr_push(expr, VECTOR_EXPR_ADD_SCALAR, a, -1);
+    if (!node) { return -1;}
+    if (expr->type != DTYPE_FLOAT32) { return expr_fail(expr, VECTOR_UNSUPPORTED_OPERATION);}
+
+    node->scalar.f = value;
+    return (int)expr->count++;
+}
+
+int vec_expr_mul_scalar(vector_expr_t *expr, int a, int value, unsigned int shift_amount) {
+    if (!expr) { return -1;}
+    vector_expr_node_t *node = expr_push(expr, VECTOR_EXPR_MUL_SCALAR, a, -1);
+    if (!node) { return -1;}
+    vector_status_t status = expr_int_scalar(expr, value);
+    if (status != VECTOR_SUCCESS) { return expr_fail(expr, status);}
+    if (shift_amount >= 8 * sizeof_dtype(expr->type)) { return expr_fail(expr, VECTOR_INVALID_ARGUMENT);}
+
+    node->scalar.i = value;
+    node->shift_amount = shift_amount;
+    return (int)expr->count++;
+}
+
+int vec_expr_mul_scalar_f32(vector_expr_t *expr, int a, float value) {
+    if (!expr) { return -1;}
+    vector_expr_node_t *node = expr_push(expr, VECTOR_EXPR_MUL_SCALAR, a, -1);
+    if (!node) { return -1;}
+    if (expr->type != DTYPE_FLOAT32) { return expr_fail(expr, VECTOR_UNSUPPORTED_OPERATION);}
+
+    node->scalar.f = value;
+    return (int)expr->count++;
+}
+
+static int expr_add_scalar_tile(dtype type, const vector_expr_node_t *node, const void *src, void *dst, size_t count) {
+    switch (type) {
+        case DTYPE_INT8:    { int8_t val = (int8_t)node->scalar.i;   return simd_add_scalar_i8(src, &val, dst, count);}
+        case DTYPE_INT16:   { int16_t val = (int16_t)node->scalar.i; return simd_add_scalar_i16(src, &val, dst, count);}
+        case DTYPE_INT32:   return simd_add_scalar_i32(src, &node->scalar.i, dst, count);
+        case DTYPE_FLOAT32: return simd_add_scalar_f32(src, &node->scalar.f, dst, count);
+        default:            return VECTOR_ERROR;
+    }
+}
+
+static int expr_mul_scalar_tile(dtype type, const vector_expr_node_t *node, const void *src, void *dst, size_t count) {
+    switch (type) {
+        case DTYPE_INT8:    { int8_t val = (int8_t)node->scalar.i;   return simd_mul_scalar_i8(src, &val, dst, node->shift_amount, count);}
+        case DTYPE_INT16:   { int16_t val = (int16_t)node->scalar.i; return simd_mul_scalar_i16(src, &val, dst, node->shift_amount, count);}
+        case DTYPE_INT32:   return simd_mul_scalar_i32(src, &node->scalar.i, dst, node->shift_amount, count);
+        case DTYPE_FLOAT32: return simd_mul_scalar_f32(src, &node->scalar.f, dst, count);
+        default:            return VECTOR_ERROR;
+    }
+}
+
+// Partial reductions of one tile, combined across tiles in acc
+static int expr_reduce_tile(dtype type, expr_mode_t mode, const void *a, const void *b, size_t count, expr_acc_t *acc) {
+    int32_t part_i = 0;
+    float part_f = 0.0f;
+    int status;
+    switch (type) {
+        case DTYPE_INT8:    status = (mode == EXPR_SUM) ? simd_sum_i8(a, &part_i, count) : simd_dotp_i8(a, b, &part_i, count);    break;
+        case DTYPE_INT16:   status = (mode == EXPR_SUM) ? simd_sum_i16(a, &part_i, count) : simd_dotp_i16(a, b, &part_i, count);  break;
+        case DTYPE_INT32:
+            if (mode == EXPR_SUM) { return vector_sum_i32_add(&acc->lanes, a, count);}      // Tiles are aligned, VECTOR_EXPR_TILE a multiple of 4
+            status = simd_dotp_i32(a, b, &part_i, count);
+            break;
+        case DTYPE_FLOAT32: status = (mode == EXPR_SUM) ? simd_sum_f32(a, &part_f, count) : simd_dotp_f32(a, b, &part_f, count);  break;
+        default:            return VECTOR_ERROR;
+    }
+    if (type == DTYPE_FLOAT32) {
+        acc->f += part_f;
+    } else {
+        acc->i = (int32_t)((uint32_t)acc->i + (uint32_t)part_i);                            // Wraps like the 32-bit accumulators
+    }
+    return status;
+}
+
+/**
+ * Runs the nodes the roots depend on, tile by tile. Each computed node gets a scratch tile, and a
+ * tile is handed back as soon as its last consumer has run, so a linear chain needs at most two
+ * tiles whatever its length. In EXPR_EVAL mode the root writes straight into the result vector.
+ */
+static vector_status_t expr_run(vector_expr_t *expr, expr_mode_t mode, int root_a, int root_b, vector_t *result, expr_acc_t *acc) {
+    if (!expr) { return VECTOR_NULL;}
+    if (expr->status != VECTOR_SUCCESS) { return expr->status;}
+    if (!expr_node_valid(expr, root_a) || !expr_node_valid(expr, root_b)) { return VECTOR_INVALID_ARGUMENT;}
+
+    const size_t count = expr->count;
+    const size_t elem = sizeof_dtype(expr->type);
+    bool live[VECTOR_EXPR_MAX_NODES] = { false };
+    int last_use[VECTOR_EXPR_MAX_NODES];
+    int slot[VECTOR_EXPR_MAX_NODES];
+
+    live[root_a] = true;                                                                    // Operands always precede their users,
+    live[root_b] = true;                                                                    // so one backward sweep marks every dependency
+    for (size_t n = count; n-- > 0;) {
+        if (!live[n] || expr->nodes[n].kind == VECTOR_EXPR_INPUT) { continue;}
+        live[expr->nodes[n].a] = true;
+        if (expr->nodes[n].b >= 0) { live[expr->nodes[n].b] = true;}
+    }
+    for (size_t n = 0; n < count; n++) {
+        last_use[n] = (n == (size_t)root_a || n == (size_t)root_b) ? (int)count : -1;      // Roots are read after the last node
+        slot[n] = -1;
+    }
+    for (size_t n = 0; n < count; n++) {
+        if (!live[n] || expr->nodes[n].kind == VECTOR_EXPR_INPUT) { continue;}
+        if (last_use[expr->nodes[n].a] < (int)n) { last_use[expr->nodes[n].a] = (int)n;}
+        if (expr->nodes[n].b >= 0 && last_use[expr->nodes[n].b] < (int)n) { last_use[expr->nodes[n].b] = (int)n;}
+    }
+
+    // Tile assignment. The kernels allow the result to alias an input, so a node may reuse the tile of
+    // an operand it is the last reader of.
+    bool slot_busy[VECTOR_EXPR_MAX_NODES] = { false };
+    size_t slots = 0;
+    for (size_t n = 0; n < count; n++) {
+        const vector_expr_node_t *node = &expr->nodes[n];
+        if (!live[n] || node->kind == VECTOR_EXPR_INPUT) { continue;}
+        if (slot[node->a] >= 0 && last_use[node->a] == (int)n) { slot_busy[slot[node->a]] = false;}
+        if (node->b >= 0 && slot[node->b] >= 0 && last_use[node->b] == (int)n) { slot_busy[slot[node->b]] = false;}
+        if (mode == EXPR_EVAL && n == (size_t)root_a) { continue;}                         // Written to the result instead
+        size_t s = 0;
+        while (slot_busy[s]) { s++;}
+        slot_busy[s] = true;
+        slot[n] = (int)s;
+        if (s + 1 > slots) { slots = s + 1;}
+    }
+
+    uint8_t *scratch = NULL;
+    if (slots) {
+        scratch = heap_caps_aligned_alloc(16, slots * VECTOR_EXPR_TILE * elem, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!scratch) { return VECTOR_ERROR;}
+    }
+
+    vector_status_t status = VECTOR_SUCCESS;
+    const void *ptr[VECTOR_EXPR_MAX_NODES];
+    vector_unary_kernel_t copy = vec_unary_kernel(VECTOR_OP_COPY, expr->type);
+    for (size_t off = 0; off < expr->size && status == VECTOR_SUCCESS; off += VECTOR_EXPR_TILE) {
+        const size_t n_tile = (expr->size - off < VECTOR_EXPR_TILE) ? expr->size - off : VECTOR_EXPR_TILE;
+        for (size_t n = 0; n < count && status == VECTOR_SUCCESS; n++) {
+            const vector_expr_node_t *node = &expr->nodes[n];
+            if (!live[n]) { continue;}
+            if (node->kind == VECTOR_EXPR_INPUT) {
+                ptr[n] = (const uint8_t*)node->op.input->data + off * elem;                 // Inputs are read in place
+                continue;
+            }
+            void *dst = (slot[n] >= 0) ? scratch + (size_t)slot[n] * VECTOR_EXPR_TILE * elem
+                                       : (uint8_t*)result->data + off * elem;
+            switch (node->kind) {
+                case VECTOR_EXPR_BINARY:     status = node->op.binary(ptr[node->a], ptr[node->b], dst, node->shift_amount, n_tile);  break;
+                case VECTOR_EXPR_UNARY:      status = node->op.unary(ptr[node->a], dst, n_tile);                                     break;
+                case VECTOR_EXPR_ADD_SCALAR: status = expr_add_scalar_tile(expr->type, node, ptr[node->a], dst, n_tile);            break;
+                case VECTOR_EXPR_MUL_SCALAR: status = expr_mul_scalar_tile(expr->type, node, ptr[node->a], dst, n_tile);            break;
+                default:                     status = VECTOR_ERROR;                                                                  break;
+            }
+            ptr[n] = dst;
+        }
+        if (status != VECTOR_SUCCESS) { break;}
+
+        if (mode == EXPR_EVAL) {
+            if (expr->nodes[root_a].kind == VECTOR_EXPR_INPUT) {                            // Bare input: plain copy
+                status = copy(ptr[root_a], (uint8_t*)result->data + off * elem, n_tile);
+            }
+        } else {
+            status = expr_reduce_tile(expr->type, mode, ptr[root_a], ptr[root_b], n_tile, acc);
+        }
+    }
+
+    if (scratch) { heap_caps_free(scratch);}
+    return status;
+}
+
+vector_status_t vec_expr_eval(vector_expr_t *expr, int node, vector_t *result) {
+    if (!expr || !result) { return VECTOR_NULL;}
+    if (expr->status != VECTOR_SUCCESS) { return expr->status;}
+    if (result->size != expr->size) { return VECTOR_SIZE_MISMATCH;}
+    if (result->type != expr->type) { return VECTOR_TYPE_MISMATCH;}
+    if ((uintptr_t)result->data & 0xF) { return VECTOR_UNALIGNED_DATA;}
+    return expr_run(expr, EXPR_EVAL, node, node, result, NULL);
+}
+
+vector_status_t vec_expr_sum(vector_expr_t *expr, int node, int32_t *result) {
+    if (!expr || !result) { return VECTOR_NULL;}
+    if (expr->status != VECTOR_SUCCESS) { return expr->status;}
+    if (expr->type != DTYPE_INT8 && expr->type != DTYPE_INT16 && expr->type != DTYPE_INT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    expr_acc_t acc = { .i = 0 };
+    if (expr->type == DTYPE_INT32) { vector_sum_i32_begin(&acc.lanes);}
+    vector_status_t status = expr_run(expr, EXPR_SUM, node, node, NULL, &acc);
+    if (status == VECTOR_SUCCESS) { *result = (expr->type == DTYPE_INT32) ? vector_sum_i32_end(&acc.lanes) : acc.i;}
+    return status;
+}
+
+vector_status_t vec_expr_sum_f32(vector_expr_t *expr, int node, float *result) {
+    if (!expr || !result) { return VECTOR_NULL;}
+    if (expr->status != VECTOR_SUCCESS) { return expr->status;}
+    if (expr->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    expr_acc_t acc = { .f = 0.0f };
+    vector_status_t status = expr_run(expr, EXPR_SUM, node, node, NULL, &acc);
+    if (status == VECTOR_SUCCESS) { *result = acc.f;}
+    return status;
+}
+
+vector_status_t vec_expr_dotp(vector_expr_t *expr, int a, int b, int32_t *result) {
+    if (!expr || !result) { return VECTOR_NULL;}
+    if (expr->status != VECTOR_SUCCESS) { return expr->status;}
+    if (expr->type != DTYPE_INT8 && expr->type != DTYPE_INT16 && expr->type != DTYPE_INT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    expr_acc_t acc = { .i = 0 };
+    vector_status_t status = expr_run(expr, EXPR_DOTP, a, b, NULL, &acc);
+    if (status == VECTOR_SUCCESS) { *result = acc.i;}
+    return status;
+}
+
+vector_status_t vec_expr_dotp_f32(vector_expr_t *expr, int a, int b, float *result) {
+    if (!expr || !result) { return VECTOR_NULL;}
+    if (expr->status != VECTOR_SUCCESS) { return expr->status;}
+    if (expr->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    expr_acc_t acc = { .f = 0.0f };
+    vector_status_t status = expr_run(expr, EXPR_DOTP, a, b, NULL, &acc);
+    if (status == VECTOR_SUCCESS) { *result = acc.f;}
+    return status;
+}
@@ -0,0 +1,287 @@
+#include "vector_fft.h"
+#include "simd_functions.h"
+#include "esp_heap_caps.h"
+#include <math.h>
+#include <stdalign.h>
+#include <string.h>
+
+#define FFT_PI 3.14159265358979323846
+
+static void *fft_tables[2][VECTOR_FFT_MAX_LOG2 + 1];                                        // [INT16, FLOAT32][log2 n]
+
+static int fft_log2(size_t n) {
+    for (int log = 1; log <= VECTOR_FFT_MAX_LOG2; log++) {
+        if (n == ((size_t)1 << log)) { return log;}
+    }
+    return -1;
+}
+
+static int16_t fft_sat(int32_t val) {
+    if (val > INT16_MAX) { return INT16_MAX;}
+    if (val < INT16_MIN) { return INT16_MIN;}
+    return (int16_t)val;
+}
+
+// e^(-i pi j / half), exact at the quarter turns
+static void fft_twiddle(size_t j, size_t half, double *re, double *im) {
+    if (j == 0) { *re = 1.0; *im = 0.0; return;}
+    if (2 * j == half) { *re = 0.0; *im = -1.0; return;}
+    *re = cos(FFT_PI * (double)j / (double)half);
+    *im = -sin(FFT_PI * (double)j / (double)half);
+}
+
+/**
+ * Twiddle table of an n point transform. The twiddles of the stage with half-size h are the h
+ * complex entries starting at entry h (entry 0 is unused), so each stage reads them contiguously
+ * and every stage of 4 or more butterflies starts 16-byte aligned for INT16.
+ */
+static const void *fft_twiddles(size_t n, dtype type) {
+    void **slot = &fft_tables[type == DTYPE_INT16 ? 0 : 1][fft_log2(n)];
+    if (*slot) { return *slot;}
+
+    void *table = heap_caps_aligned_alloc(16, 2 * n * sizeof_dtype(type), MALLOC_CAP_DEFAULT);
+    if (!table) { return NULL;}
+    memset(table, 0, 2 * n * sizeof_dtype(type));
+    for (size_t half = 1; half < n; half <<= 1) {
+        for (size_t j = 0; j < half; j++) {
+            double re, im;
+            fft_twiddle(j, half, &re, &im);
+            const size_t k = 2 * (half + j);
+            if (type == DTYPE_INT16) {
+                ((int16_t*)table)[k] = fft_sat((int32_t)lround(re * 32768.0));          // Q15; 1.0 saturates to 32767
+                ((int16_t*)table)[k + 1] = fft_sat((int32_t)lround(im * 32768.0));
+            } else {
+                ((float*)table)[k] = (float)re;
+                ((float*)table)[k + 1] = (float)im;
+            }
+        }
+    }
+    *slot = table;
+    return table;
+}
+
+vector_status_t vector_fft_init(size_t n, dtype type) {
+    if (type != DTYPE_INT16 && type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (fft_log2(n) < 0) { return VECTOR_INVALID_ARGUMENT;}
+    if (!fft_twiddles(n, type)) { return VECTOR_ERROR;}
+    if (n >= 4 && !fft_twiddles(n / 2, type)) { return VECTOR_ERROR;}
+    return VECTOR_SUCCESS;
+}
+
+void vector_fft_deinit(void) {
+    for (size_t t = 0; t < 2; t++) {
+        for (size_t log = 0; log <= VECTOR_FFT_MAX_LOG2; log++) {
+            if (fft_tables[t][log]) { heap_caps_free(fft_tables[t][log]);}
+            fft_tables[t][log] = NULL;
+        }
+    }
+}
+
+static void fft_bit_reverse(uint8_t *data, size_t n, size_t elem) {
+    const size_t bytes = 2 * elem;                                                          // One complex sample
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) { j ^= bit;}
+        j ^= bit;
+        if (i < j) {
+            uint8_t tmp[8];
+            memcpy(tmp, data + i * bytes, bytes);
+            memcpy(data + i * bytes, data + j * bytes, bytes);
+            memcpy(data + j * bytes, tmp, bytes);
+        }
+    }
+}
+
+static int32_t fft_peak(const int16_t *data, size_t count) {
+    int32_t peak = 0;
+    for (size_t i = 0; i < count; i++) {
+        int32_t v = data[i] < 0 ? -(int32_t)data[i] : data[i];
+        if (v > peak) { peak = v;}
+    }
+    return peak;
+}
+
+/**
+ * Block floating point: shifts the block right so that a stage (growth below 1 + sqrt(2) per
+ * component) cannot overflow from a peak below 2^13.
+ */
+static void fft_rescale(int16_t *data, size_t count, int32_t peak, int *exponent) {
+    const unsigned int shift = (peak >= (1 << 14)) ? 2 : (peak >= (1 << 13)) ? 1 : 0;
+    if (!shift) { return;}
+    const int16_t one = 1;
+    simd_mul_scalar_i16(data, &one, data, shift, count);
+    *exponent += shift;
+}
+
+// The stages with 1 and 2 butterflies per group, whose twiddles are 1 and -j; returns the output peak
+static int32_t fft_trivial_stage_i16(int16_t *data, size_t n, size_t half) {
+    int32_t peak = 0;
+    for (size_t g = 0; g < n; g += 2 * half) {
+        for (size_t j = 0; j < half; j++) {
+            int16_t *a = data + 2 * (g + j);
+            int16_t *b = a + 2 * half;
+            int32_t tr = b[0], ti = b[1];
+            if (j == 1) { tr = b[1]; ti = -(int32_t)b[0];}                                  // B * -j
+            const int16_t out[4] = {fft_sat(a[0] + tr), fft_sat(a[1] + ti), fft_sat(a[0] - tr), fft_sat(a[1] - ti)};
+            a[0] = out[0];
+            a[1] = out[1];
+            b[0] = out[2];
+            b[1] = out[3];
+            int32_t p = fft_peak(out, 4);
+            if (p > peak) { peak = p;}
+        }
+    }
+    return peak;
+}
+
+static vector_status_t fft_run(void *data, size_t n, dtype type, int *exponent) {
+    const void *twiddles = fft_twiddles(n, type);
+    if (!twiddles) { return VECTOR_ERROR;}
+    fft_bit_reverse(data, n, sizeof_dtype(type));
+
+    if (type == DTYPE_FLOAT32) {
+        for (size_t half = 1; half < n; half <<= 1) {
+            simd_fft_r2_f32(data, (const float*)twiddles + 2 * half, n / (2 * half), half);
+        }
+        return VECTOR_SUCCESS;
+    }
+
+    int16_t *d = data;
+    alignas(16) int16_t lanes[16];
+    int32_t peak = fft_peak(d, 2 * n);
+    *exponent = 0;
+    for (size_t half = 1; half < n; half <<= 1) {
+        fft_rescale(d, 2 * n, peak, exponent);
+        if (half < 4) {
+            peak = fft_trivial_stage_i16(d, n, half);
+        } else {
+            simd_fft_r2_i16(d, (const int16_t*)twiddles + 2 * half, n / (2 * half), half, lanes);
+            peak = 0;
+            for (size_t l = 0; l < 8; l++) {
+                if (lanes[l] > peak) { peak = lanes[l];}
+                if (-(int32_t)lanes[8 + l] > peak) { peak = -(int32_t)lanes[8 + l];}
+            }
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+static vector_status_t fft_check(const vector_t *data, const int *exponent) {
+    if (!data || !data->data) { return VECTOR_NULL;}
+    if (data->type != DTYPE_INT16 && data->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (data->type == DTYPE_INT16 && !exponent) { return VECTOR_NULL;}
+    if ((uintptr_t)data->data & 0xF) { return VECTOR_UNALIGNED_DATA;}
+    return VECTOR_SUCCESS;
+}
+
+static void fft_conjugate(void *data, size_t n, dtype type) {
+    if (type == DTYPE_INT16) {
+        int16_t *d = data;
+        for (size_t i = 0; i < n; i++) { d[2 * i + 1] = fft_sat(-(int32_t)d[2 * i + 1]);}
+    } else {
+        float *d = data;
+        for (size_t i = 0; i < n; i++) { d[2 * i + 1] = -d[2 * i + 1];}
+    }
+}
+
+vector_status_t vec_fft(vector_t *data, int *exponent) {
+    vector_status_t status = fft_check(data, exponent);
+    if (status != VECTOR_SUCCESS) { return status;}
+    if (data->size % 2 || fft_log2(data->size / 2) < 0) { return VECTOR_INVALID_ARGUMENT;}
+    return fft_run(data->data, data->size / 2, data->type, exponent);
+}
+
+vector_status_t vec_ifft(vector_t *data, int *exponent) {
+    vector_status_t status = fft_check(data, exponent);
+    if (status != VECTOR_SUCCESS) { return status;}
+    const size_t n = data->size / 2;
+    if (data->size % 2 || fft_log2(n) < 0) { return VECTOR_INVALID_ARGUMENT;}
+
+    fft_conjugate(data->data, n, data->type);
+    status = fft_run(data->data, n, data->type, exponent);
+    fft_conjugate(data->data, n, data->type);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    if (data->type == DTYPE_INT16) {
+        *exponent -= fft_log2(n);
+    } else {
+        const float scale = 1.0f / (float)n;
+        simd_mul_scalar_f32(data->data, &scale, data->data, data->size);
+    }
+    return VECTOR_SUCCESS;
+}
+
+/**
+ * Turns the m point spectrum Z of z[t] = x[2t] + i x[2t + 1] into bins 0..m of the 2m point real
+ * spectrum X, in place. With E = (Z[k] + conj Z[m-k]) / 2, O = -i (Z[k] - conj Z[m-k]) / 2 and
+ * W = e^(-i pi k / m), X[k] = E + W O and X[m-k] = conj(E - W O).
+ */
+static void rfft_split_i16(int16_t *d, size_t m, const int16_t *w) {
+    const int16_t z0r = d[0], z0i = d[1];
+    d[2 * m] = fft_sat(z0r - z0i);
+    d[2 * m + 1] = 0;
+    d[0] = fft_sat(z0r + z0i);
+    d[1] = 0;
+    for (size_t k = 1; 2 * k <= m; k++) {
+        int16_t *zk = d + 2 * k, *zm = d + 2 * (m - k);
+        const int32_t er = zk[0] + zm[0], ei = zk[1] - zm[1];                               // 2 E
+        const int32_t orr = zk[1] + zm[1], oi = zm[0] - zk[0];                              // 2 O
+        const int64_t wr = w[2 * k], wi = w[2 * k + 1];
+        const int32_t tr = (int32_t)((orr * wr - oi * wi) >> 15);                            // 2 W O
+        const int32_t ti = (int32_t)((orr * wi + oi * wr) >> 15);
+        zk[0] = fft_sat((er + tr) >> 1);
+        zk[1] = fft_sat((ei + ti) >> 1);
+        if (zm != zk) {
+            zm[0] = fft_sat((er - tr) >> 1);
+            zm[1] = fft_sat((ti - ei) >> 1);
+        }
+    }
+}
+
+static void rfft_split_f32(float *d, size_t m, const float *w) {
+    const float z0r = d[0], z0i = d[1];
+    d[2 * m] = z0r - z0i;
+    d[2 * m + 1] = 0.0f;
+    d[0] = z0r + z0i;
+    d[1] = 0.0f;
+    for (size_t k = 1; 2 * k <= m; k++) {
+        float *zk = d + 2 * k, *zm = d + 2 * (m - k);
+        const float er = 0.5f * (zk[0] + zm[0]), ei = 0.5f * (zk[1] - zm[1]);
+        const float orr = 0.5f * (zk[1] + zm[1]), oi = 0.5f * (zm[0] - zk[0]);
+        const float wr = w[2 * k], wi = w[2 * k + 1];
+        const float tr = orr * wr - oi * wi;
+        const float ti = orr * wi + oi * wr;
+        zk[0] = er + tr;
+        zk[1] = ei + ti;
+        if (zm != zk) {
+            zm[0] = er - tr;
+            zm[1] = ti - ei;
+        }
+    }
+}
+
+vector_status_t vec_rfft(const vector_t *input, vector_t *output, int *exponent) {
+    if (!input || !input->data) { return VECTOR_NULL;}
+    vector_status_t status = fft_check(output, exponent);
+    if (status != VECTOR_SUCCESS) { return status;}
+    if (input->type != output->type) { return VECTOR_TYPE_MISMATCH;}
+    const size_t n = input->size;
+    if (n < 4 || fft_log2(n) < 0) { return VECTOR_INVALID_ARGUMENT;}
+    if (output->size != n + 2) { return VECTOR_SIZE_MISMATCH;}
+
+    const void *twiddles = fft_twiddles(n, input->type);                                    // Stage n / 2 holds e^(-2 pi i k / n)
+    if (!twiddles) { return VECTOR_ERROR;}
+    const size_t m = n / 2;
+    memmove(output->data, input->data, n * sizeof_dtype(input->type));
+    status = fft_run(output->data, m, input->type, exponent);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    if (input->type == DTYPE_INT16) {
+        int16_t *d = output->data;
+        fft_rescale(d, n, fft_peak(d, n), exponent);                                        // The split grows like a stage
+        rfft_split_i16(d, m, (const int16_t*)twiddles + 2 * m);
+    } else {
+        rfft_split_f32(output->data, m, (const float*)twiddles + 2 * m);
+    }
+    return VECTOR_SUCCESS;
+}
@@ -0,0 +1,254 @@
+#include "vector_filter.h"
+#include "simd_functions.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+// Taps per 16-byte kernel block
+static size_t fir_block(dtype type) {
+    return 16 / sizeof_dtype(type);
+}
+
+vector_status_t vector_fir_init(vector_fir_state_t *state, size_t ntaps, dtype type) {
+    if (!state) { return VECTOR_NULL;}
+    if (type != DTYPE_INT16 && type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (ntaps == 0 || (type == DTYPE_INT16 && ntaps > VECTOR_FIR_MAX_TAPS_I16)) { return VECTOR_INVALID_ARGUMENT;}
+    memset(state, 0, sizeof(*state));
+
+    const size_t block = fir_block(type);
+    const size_t elem = sizeof_dtype(type);
+    state->type = type;
+    state->ntaps = ntaps;
+    state->padded = (ntaps + block - 1) / block * block;
+    state->taps = heap_caps_aligned_alloc(16, state->padded * elem, MALLOC_CAP_DEFAULT);
+    state->work = heap_caps_aligned_alloc(16, (state->padded - 1 + VECTOR_FIR_TILE) * elem + 16, MALLOC_CAP_DEFAULT);
+    if (!state->taps || !state->work) {
+        vector_fir_deinit(state);
+        return VECTOR_ERROR;
+    }
+    memset(state->taps, 0, state->padded * elem);
+    memset(state->work, 0, (state->padded - 1 + VECTOR_FIR_TILE) * elem + 16);              // The slack is read, never used
+    return VECTOR_SUCCESS;
+}
+
+void vector_fir_deinit(vector_fir_state_t *state) {
+    if (!state) { return;}
+    if (state->taps) { heap_caps_free(state->taps);}
+    if (state->work) { heap_caps_free(state->work);}
+    state->taps = NULL;
+    state->work = NULL;
+}
+
+void vector_fir_reset(vector_fir_state_t *state) {
+    if (!state || !state->work) { return;}
+    memset(state->work, 0, (state->padded - 1) * sizeof_dtype(state->type));
+}
+
+// Copies the taps reversed behind the zero padding, so the kernels walk taps and window forwards together
+static void fir_load_taps(vector_fir_state_t *state, const vector_t *taps) {
+    const size_t lead = state->padded - state->ntaps;
+    if (state->type == DTYPE_INT16) {
+        int16_t *dst = (int16_t*)state->taps + lead;
+        const int16_t *src = taps->data;
+        for (size_t k = 0; k < state->ntaps; k++) { dst[k] = src[state->ntaps - 1 - k];}
+    } else {
+        float *dst = (float*)state->taps + lead;
+        const float *src = taps->data;
+        for (size_t k = 0; k < state->ntaps; k++) { dst[k] = src[state->ntaps - 1 - k];}
+    }
+}
+
+vector_status_t vec_fir(const vector_t *input, const vector_t *taps, vector_fir_state_t *state, vector_t *output) {
+    if (!input || !taps || !state || !output || !input->data || !taps->data || !output->data || !state->work) { return VECTOR_NULL;}
+    if (input->type != state->type || taps->type != state->type || output->type != state->type) { return VECTOR_TYPE_MISMATCH;}
+    if (input->size != output->size || taps->size != state->ntaps) { return VECTOR_SIZE_MISMATCH;}
+    const size_t elem = sizeof_dtype(state->type);
+    if (((uintptr_t)input->data | (uintptr_t)taps->data | (uintptr_t)output->data) & (elem - 1)) { return VECTOR_UNALIGNED_DATA;}
+
+    fir_load_taps(state, taps);
+
+    const size_t history = (state->padded - 1) * elem;
+    uint8_t *work = state->work;
+    const uint8_t *in = input->data;
+    uint8_t *out = output->data;
+    for (size_t off = 0; off < input->size; off += VECTOR_FIR_TILE) {
+        const size_t count = (input->size - off < VECTOR_FIR_TILE) ? input->size - off : VECTOR_FIR_TILE;
+        memcpy(work + history, in + off * elem, count * elem);                              // Before the output is written, so in-place works
+        if (state->type == DTYPE_INT16) {
+            simd_fir_i16((const int16_t*)work, state->taps, (int16_t*)(out + off * elem), state->padded, count);
+        } else {
+            simd_fir_f32((const float*)work, state->taps, (float*)(out + off * elem), state->padded, count);
+        }
+        memmove(work, work + count * elem, history);                                        // Slide the delay line
+    }
+    return VECTOR_SUCCESS;
+}
+
+// Coefficient table entries per stage: 5 broadcast to the lanes for INT16, 5 scalars for FLOAT32
+static size_t biquad_coeff_elems(const vector_biquad_state_t *state) {
+    return (state->type == DTYPE_INT16) ? 5 * state->lanes : 5;
+}
+
+static size_t biquad_groups(const vector_biquad_state_t *state) {
+    return (state->channels + state->lanes - 1) / state->lanes;
+}
+
+static size_t biquad_delay_bytes(const vector_biquad_state_t *state) {
+    return biquad_groups(state) * state->stages * 4 * state->lanes * sizeof_dtype(state->type);
+}
+
+vector_status_t vector_biquad_init(vector_biquad_state_t *state, size_t stages, size_t channels, dtype type) {
+    if (!state) { return VECTOR_NULL;}
+    if (type != DTYPE_INT16 && type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (stages == 0 || channels == 0) { return VECTOR_INVALID_ARGUMENT;}
+    memset(state, 0, sizeof(*state));
+
+    const size_t elem = sizeof_dtype(type);
+    state->type = type;
+    state->stages = stages;
+    state->channels = channels;
+    state->lanes = 16 / elem;
+    state->coeffs = heap_caps_aligned_alloc(16, stages * biquad_coeff_elems(state) * elem, MALLOC_CAP_DEFAULT);
+    state->delay = heap_caps_aligned_alloc(16, biquad_delay_bytes(state), MALLOC_CAP_DEFAULT);
+    state->work = heap_caps_aligned_alloc(16, VECTOR_BIQUAD_TILE * 16, MALLOC_CAP_DEFAULT);
+    if (!state->coeffs || !state->delay || !state->work) {
+        vector_biquad_deinit(state);
+        return VECTOR_ERROR;
+    }
+    memset(state->delay, 0, biquad_delay_bytes(state));
+    return VECTOR_SUCCESS;
+}
+
+void vector_biquad_deinit(vector_biquad_state_t *state) {
+    if (!state) { return;}
+    if (state->coeffs) { heap_caps_free(state->coeffs);}
+    if (state->delay) { heap_caps_free(state->delay);}
+    if (state->work) { heap_caps_free(state->work);}
+    state->coeffs = NULL;
+    state->delay = NULL;
+    state->work = NULL;
+}
+
+void vector_biquad_reset(vector_biquad_state_t *state) {
+    if (!state || !state->delay) { return;}
+    memset(state->delay, 0, biquad_delay_bytes(state));
+}
+
+// Lays out the coefficients for the kernels, with a1 and a2 negated so every term is accumulated
+static void biquad_load_coeffs(vector_biquad_state_t *state, const vector_t *coeffs) {
+    if (state->type == DTYPE_INT16) {
+        const int16_t *src = coeffs->data;
+        int16_t *dst = state->coeffs;
+        for (size_t i = 0; i < 5 * state->stages; i++) {
+            int16_t c = src[i];
+            if (i % 5 >= 3) { c = (c == INT16_MIN) ? INT16_MAX : (int16_t)-c;}
+            for (size_t l = 0; l < state->lanes; l++) { dst[i * state->lanes + l] = c;}
+        }
+    } else {
+        const float *src = coeffs->data;
+        float *dst = state->coeffs;
+        for (size_t i = 0; i < 5 * state->stages; i++) {
+            dst[i] = (i % 5 >= 3) ? -src[i] : src[i];
+        }
+    }
+}
+
+static void biquad_kernel(vector_biquad_state_t *state, void *frames, size_t group, size_t count) {
+    const size_t delay_elems = state->stages * 4 * state->lanes;
+    if (state->type == DTYPE_INT16) {
+        simd_biquad_i16(frames, state->coeffs, (int16_t*)state->delay + group * delay_elems, state->stages, count);
+    } else {
+        simd_biquad_f32(frames, state->coeffs, (float*)state->delay + group * delay_elems, state->stages, count);
+    }
+}
+
+vector_status_t vec_biquad_cascade(const vector_t *input, const vector_t *coeffs, vector_biquad_state_t *state, vector_t *output) {
+    if (!input || !coeffs || !state || !output || !input->data || !coeffs->data || !output->data || !state->delay) { return VECTOR_NULL;}
+    if (input->type != state->type || coeffs->type != state->type || output->type != state->type) { return VECTOR_TYPE_MISMATCH;}
+    if (input->size != output->size || coeffs->size != 5 * state->stages || input->size % state->channels) { return VECTOR_SIZE_MISMATCH;}
+    const size_t elem = sizeof_dtype(state->type);
+    if (((uintptr_t)input->data | (uintptr_t)coeffs->data | (uintptr_t)output->data) & (elem - 1)) { return VECTOR_UNALIGNED_DATA;}
+
+    biquad_load_coeffs(state, coeffs);
+    const size_t frames = input->size / state->channels;
+
+    if (state->channels == state->lanes && (((uintptr_t)input->data | (uintptr_t)output->data) & 0xF) == 0) {
+        if (output->data != input->data) { memmove(output->data, input->data, input->size * elem);}
+        biquad_kernel(state, output->data, 0, frames);                                      // Already one group of whole frames
+        return VECTOR_SUCCESS;
+    }
+
+    const size_t in_frame = state->channels * elem;
+    const uint8_t *in = input->data;
+    uint8_t *out = output->data;
+    uint8_t *work = state->work;
+    for (size_t group = 0; group < biquad_groups(state); group++) {
+        const size_t first = group * state->lanes;
+        const size_t width = (state->channels - first < state->lanes) ? state->channels - first : state->lanes;
+        for (size_t off = 0; off < frames; off += VECTOR_BIQUAD_TILE) {
+            const size_t count = (frames - off < VECTOR_BIQUAD_TILE) ? frames - off : VECTOR_BIQUAD_TILE;
+            for (size_t f = 0; f < count; f++) {                                            // Gather the group's channels
+                memcpy(work + f * 16, in + (off + f) * in_frame + first * elem, width * elem);
+                memset(work + f * 16 + width * elem, 0, 16 - width * elem);                 // Padding lanes of a partial group
+            }
+            biquad_kernel(state, work, group, count);
+            for (size_t f = 0; f < count; f++) {
+                memcpy(out + (off + f) * in_frame + first * elem, work + f * 16, width * elem);
+            }
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+static size_t round_up(size_t val, size_t multiple) {
+    return (val + multiple - 1) / multiple * multiple;
+}
+
+// Copies an INT8 or INT16 sequence as int16_t
+static void xcorr_stage_i16(int16_t *dst, const vector_t *vec) {
+    if (vec->type == DTYPE_INT16) {
+        memcpy(dst, vec->data, vec->size * sizeof(int16_t));
+        return;
+    }
+    const int8_t *src = vec->data;
+    for (size_t i = 0; i < vec->size; i++) { dst[i] = src[i];}
+}
+
+vector_status_t vec_xcorr(const vector_t *vec1, const vector_t *vec2, size_t max_lag, vector_t *result) {
+    if (!vec1 || !vec2 || !result || !vec1->data || !vec2->data || !result->data) { return VECTOR_NULL;}
+    if (vec1->type != vec2->type) { return VECTOR_TYPE_MISMATCH;}
+    if (vec1->type != DTYPE_INT8 && vec1->type != DTYPE_INT16 && vec1->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (result->type != (vec1->type == DTYPE_FLOAT32 ? DTYPE_FLOAT32 : DTYPE_INT32)) { return VECTOR_TYPE_MISMATCH;}
+    if (vec1->size != vec2->size || result->size != max_lag + 1) { return VECTOR_SIZE_MISMATCH;}
+    if (max_lag >= vec1->size) { return VECTOR_INVALID_ARGUMENT;}
+    const size_t elem = sizeof_dtype(vec1->type);
+    if ((((uintptr_t)vec1->data | (uintptr_t)vec2->data) & (elem - 1)) || ((uintptr_t)result->data & 3)) { return VECTOR_UNALIGNED_DATA;}
+
+    const bool f32 = vec1->type == DTYPE_FLOAT32;
+    const size_t size = vec1->size;
+    const size_t lags = round_up(max_lag + 1, f32 ? 4 : 8);
+    const size_t padded = round_up(size + 16, 8);                                           // Covers both kernels' overreads
+    const size_t staged = f32 ? sizeof(float) : sizeof(int16_t);
+    uint8_t *scratch = heap_caps_aligned_alloc(16, 2 * padded * staged + lags * 4, MALLOC_CAP_DEFAULT);
+    if (!scratch) { return VECTOR_ERROR;}
+    memset(scratch, 0, 2 * padded * staged);
+    uint8_t *a = scratch;                                                                   // Both sequences zero-padded, then every lag
+    uint8_t *b = a + padded * staged;
+    uint8_t *out = b + padded * staged;
+
+    if (f32) {
+        memcpy(a, vec1->data, size * sizeof(float));
+        memcpy(b, vec2->data, size * sizeof(float));
+        simd_xcorr_f32((const float*)a, (const float*)b, (float*)out, size, lags);
+    } else {
+        xcorr_stage_i16((int16_t*)a, vec1);
+        xcorr_stage_i16((int16_t*)b, vec2);
+        simd_xcorr_i16((const int16_t*)a, (const int16_t*)b, (int32_t*)out, size, lags);
+    }
+    memcpy(result->data, out, (max_lag + 1) * 4);
+    heap_caps_free(scratch);
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vec_autocorr(const vector_t *vec1, size_t max_lag, vector_t *result) {
+    return vec_xcorr(vec1, vec1, max_lag, result);
+}
@@ -0,0 +1,324 @@
+#include "vector_parallel.h"
+#include "vector_dispatch_table.h"
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#else
+#include <pthread.h>
+#endif
+
+#define PARALLEL_STACK 3072                                                                 // Worker stack in bytes; the unaligned paths keep two 256-byte tiles on it
+
+volatile size_t vector_parallel_min_size = 0;
+
+typedef enum {
+    JOB_BINARY,
+    JOB_UNARY,
+    JOB_REDUCE
+} parallel_kind_t;
+
+// One half of a split op
+typedef struct {
+    parallel_kind_t kind;
+    vector_binary_kernel_t binary;
+    vector_unary_kernel_t unary;
+    vector_reduce_kernel_t reduce;
+    const uint8_t *a;
+    const uint8_t *b;                                                                       // NULL for unary ops and sums
+    void *result;                                                                           // Output data, or the parallel_acc_t partials of a reduction
+    unsigned int shift_amount;
+    size_t size;
+    size_t elem;
+    dtype type;
+    bool wide;                                                                              // Reduction into int64_t partials
+    vector_status_t status;
+} parallel_job_t;
+
+typedef union {
+    uint32_t u;                                                                             // Integer partials, combined modulo 2^32
+    uint64_t w;                                                                             // Wide partials, combined modulo 2^64
+    float f;
+} parallel_acc_t;
+
+// Runs a job on the current core, taking the unaligned path exactly as the serial dispatch would
+static vector_status_t run_job(const parallel_job_t *job) {
+    switch (job->kind) {
+        case JOB_BINARY:
+            if (vector_misaligned((uintptr_t)job->a | (uintptr_t)job->b | (uintptr_t)job->result)) {
+                return vector_binary_unaligned(job->binary, job->a, job->b, job->result, job->shift_amount, job->size, job->elem);
+            }
+            return (vector_status_t)job->binary(job->a, job->b, job->result, job->shift_amount, job->size);
+        case JOB_UNARY:
+            if (vector_misaligned((uintptr_t)job->a | (uintptr_t)job->result)) {
+                return vector_unary_unaligned(job->unary, job->a, job->result, job->size, job->elem);
+            }
+            return (vector_status_t)job->unary(job->a, job->result, job->size);
+        case JOB_REDUCE:
+            if (vector_misaligned((uintptr_t)job->a | (uintptr_t)job->b)) {
+                return vector_reduce_unaligned(job->reduce, job->a, job->b, job->result, job->size, job->type, job->wide);
+            }
+            return (vector_status_t)job->reduce(job->a, job->b, job->result, job->size);
+        default:
+            return VECTOR_ERROR;
+    }
+}
+
+/**
+ * Worker plumbing. worker_try_acquire() claims the worker for one split op without blocking,
+ * worker_post() hands it a job, worker_wait() blocks until that job is done and releases the worker.
+ */
+#if defined(ESP_PLATFORM)
+
+static TaskHandle_t worker_task = NULL;
+static SemaphoreHandle_t worker_lock = NULL;                                                // Held by the caller of the split op in flight
+static SemaphoreHandle_t worker_done = NULL;
+static parallel_job_t *volatile worker_job = NULL;                                          // NULL asks the worker to exit
+
+static void worker_main(void *arg) {
+    (void)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        parallel_job_t *job = worker_job;
+        if (!job) { break;}
+        job->status = run_job(job);
+        xSemaphoreGive(worker_done);
+    }
+    xSemaphoreGive(worker_done);                                                            // Acknowledge the exit
+    vTaskDelete(NULL);
+}
+
+static bool worker_running(void) {
+    return worker_task != NULL;
+}
+
+static vector_status_t worker_start(void) {
+    worker_lock = xSemaphoreCreateMutex();
+    worker_done = xSemaphoreCreateBinary();
+    if (worker_lock && worker_done) {
+        BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;                                    // Pin to the core the caller is not on
+        if (xTaskCreatePinnedToCore(worker_main, "vec_parallel", PARALLEL_STACK, NULL,
+                                    uxTaskPriorityGet(NULL), &worker_task, core) == pdPASS) {
+            return VECTOR_SUCCESS;
+        }
+    }
+    if (worker_lock) { vSemaphoreDelete(worker_lock);}
+    if (worker_done) { vSemaphoreDelete(worker_done);}
+    worker_lock = NULL;
+    worker_done = NULL;
+    worker_task = NULL;
+    return VECTOR_ERROR;
+}
+
+static void worker_stop(void) {
+    xSemaphoreTake(worker_lock, portMAX_DELAY);                                             // Let a split op in flight finish
+    worker_job = NULL;
+    xTaskNotifyGive(worker_task);
+    xSemaphoreTake(worker_done, portMAX_DELAY);
+    vSemaphoreDelete(worker_lock);
+    vSemaphoreDelete(worker_done);
+    worker_lock = NULL;
+    worker_done = NULL;
+    worker_task = NULL;
+}
+
+static bool worker_try_acquire(void) {
+    return worker_lock && xSemaphoreTake(worker_lock, 0) == pdTRUE;
+}
+
+static void worker_post(parallel_job_t *job) {
+    worker_job = job;
+    xTaskNotifyGive(worker_task);
+}
+
+static void worker_wait(void) {
+    xSemaphoreTake(worker_done, portMAX_DELAY);
+    xSemaphoreGive(worker_lock);
+}
+
+#else
+
+static pthread_t worker_thread;
+static bool worker_started = false;
+static pthread_mutex_t worker_lock = PTHREAD_MUTEX_INITIALIZER;                             // Held by the caller of the split op in flight
+static pthread_mutex_t worker_mutex = PTHREAD_MUTEX_INITIALIZER;                            // Guards the fields below
+static pthread_cond_t worker_cond = PTHREAD_COND_INITIALIZER;
+static parallel_job_t *worker_job = NULL;                                                   // Posted and not yet done
+static bool worker_exit = false;
+
+static void *worker_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&worker_mutex);
+    for (;;) {
+        while (!worker_job && !worker_exit) {
+            pthread_cond_wait(&worker_cond, &worker_mutex);
+        }
+        if (!worker_job) { break;}
+        parallel_job_t *job = worker_job;
+        pthread_mutex_unlock(&worker_mutex);
+        job->status = run_job(job);
+        pthread_mutex_lock(&worker_mutex);
+        worker_job = NULL;
+        pthread_cond_broadcast(&worker_cond);
+    }
+    pthread_mutex_unlock(&worker_mutex);
+    return NULL;
+}
+
+static bool worker_running(void) {
+    return worker_started;
+}
+
+static vector_status_t worker_start(void) {
+    worker_exit = false;
+    if (pthread_create(&worker_thread, NULL, worker_main, NULL) != 0) { return VECTOR_ERROR;}
+    worker_started = true;
+    return VECTOR_SUCCESS;
+}
+
+static void worker_stop(void) {
+    pthread_mutex_lock(&worker_lock);                                                       // Let a split op in flight finish
+    pthread_mutex_lock(&worker_mutex);
+    worker_exit = true;
+    pthread_cond_broadcast(&worker_cond);
+    pthread_mutex_unlock(&worker_mutex);
+    pthread_join(worker_thread, NULL);
+    worker_started = false;
+    pthread_mutex_unlock(&worker_lock);
+}
+
+static bool worker_try_acquire(void) {
+    if (pthread_mutex_trylock(&worker_lock) != 0) { return false;}
+    if (!worker_started) {                                                                  // Stopped since the threshold was read
+        pthread_mutex_unlock(&worker_lock);
+        return false;
+    }
+    return true;
+}
+
+static void worker_post(parallel_job_t *job) {
+    pthread_mutex_lock(&worker_mutex);
+    worker_job = job;
+    pthread_cond_broadcast(&worker_cond);
+    pthread_mutex_unlock(&worker_mutex);
+}
+
+static void worker_wait(void) {
+    pthread_mutex_lock(&worker_mutex);
+    while (worker_job) {
+        pthread_cond_wait(&worker_cond, &worker_mutex);
+    }
+    pthread_mutex_unlock(&worker_mutex);
+    pthread_mutex_unlock(&worker_lock);
+}
+
+#endif
+
+vector_status_t vector_parallel_init(size_t min_size) {
+    if (!worker_running()) {
+        vector_status_t status = worker_start();
+        if (status != VECTOR_SUCCESS) { return status;}
+    }
+    vector_parallel_min_size = min_size ? min_size : VECTOR_PARALLEL_MIN_SIZE;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_parallel_set_min_size(size_t min_size) {
+    if (!worker_running()) { return VECTOR_ERROR;}
+    vector_parallel_min_size = min_size;
+    return VECTOR_SUCCESS;
+}
+
+void vector_parallel_deinit(void) {
+    vector_parallel_min_size = 0;
+    if (worker_running()) { worker_stop();}
+}
+
+/**
+ * Splits job into the first half, kept in job, and the second half, returned in tail. The split
+ * point is a multiple of 16 bytes, so both halves keep the alignment of the whole. A reduction's
+ * result points to two partials, one per half. Returns false, leaving job whole, if the vector is
+ * too short to give both halves at least one 16-byte block, or for an INT32 sum: simd_sum_i32's
+ * lanes saturate, so two half sums do not add up to the whole.
+ */
+static bool split_job(parallel_job_t *job, parallel_job_t *tail) {
+    if (job->kind == JOB_REDUCE && job->type == DTYPE_INT32 && !job->b && !job->wide) { return false;}
+    const size_t block = 16 / job->elem;
+    const size_t split = (job->size / 2) & ~(block - 1);
+    if (split == 0) { return false;}
+
+    *tail = *job;
+    tail->a = job->a + split * job->elem;
+    if (job->b) { tail->b = job->b + split * job->elem;}
+    if (job->kind == JOB_REDUCE) {
+        tail->result = (parallel_acc_t*)job->result + 1;
+    } else {
+        tail->result = (uint8_t*)job->result + split * job->elem;
+    }
+    tail->size = job->size - split;
+    job->size = split;
+    return true;
+}
+
+/**
+ * Runs job split across both cores when the worker is free, otherwise whole on the calling core.
+ * On return tail->size is 0 if the op was not split.
+ */
+static vector_status_t run_split(parallel_job_t *job, parallel_job_t *tail) {
+    tail->size = 0;
+    if (!split_job(job, tail)) { return run_job(job);}
+    if (!worker_try_acquire()) {                                                            // Busy: another task holds the worker
+        job->size += tail->size;
+        tail->size = 0;
+        return run_job(job);
+    }
+    worker_post(tail);
+    vector_status_t status = run_job(job);
+    worker_wait();
+    return status != VECTOR_SUCCESS ? status : tail->status;
+}
+
+vector_status_t vector_parallel_binary(vector_binary_kernel_t kernel, const void *a, const void *b, void *result,
+                                       unsigned int shift_amount, size_t size, size_t elem) {
+    parallel_job_t job = {
+        .kind = JOB_BINARY, .binary = kernel, .a = a, .b = b, .result = result,
+        .shift_amount = shift_amount, .size = size, .elem = elem
+    };
+    parallel_job_t tail;
+    return run_split(&job, &tail);
+}
+
+vector_status_t vector_parallel_unary(vector_unary_kernel_t kernel, const void *a, void *result, size_t size, size_t elem) {
+    parallel_job_t job = {
+        .kind = JOB_UNARY, .unary = kernel, .a = a, .b = NULL, .result = result, .size = size, .elem = elem
+    };
+    parallel_job_t tail;
+    return run_split(&job, &tail);
+}
+
+vector_status_t vector_parallel_reduce(vector_reduce_kernel_t kernel, const void *a, const void *b, void *result, size_t size, dtype type, bool wide) {
+    const size_t elem = sizeof_dtype(type);
+    if (elem == 0) { return VECTOR_ERROR;}
+    parallel_acc_t parts[2];
+    parallel_job_t job = {
+        .kind = JOB_REDUCE, .reduce = kernel, .a = a, .b = b, .result = parts, .size = size, .elem = elem, .type = type,
+        .wide = wide
+    };
+    parallel_job_t tail;
+    vector_status_t status = run_split(&job, &tail);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    if (tail.size) {
+        if (wide) {
+            parts[0].w += parts[1].w;
+        } else if (type == DTYPE_FLOAT32) {
+            parts[0].f += parts[1].f;
+        } else {
+            parts[0].u += parts[1].u;
+        }
+    }
+    memcpy(result, &parts[0], wide ? sizeof(parts[0].w) : sizeof(parts[0].u));              // int32_t, uint32_t and float are all 4 bytes
+    return VECTOR_SUCCESS;
+}
@@ -0,0 +1,210 @@
+#include "vector_pingpong.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#else
+#include <pthread.h>
+#endif
+
+#define PRODUCER_STACK 3072                                                                 // Producer task stack in bytes; drivers read into the block directly
+
+static bool state_cas(volatile uint32_t *state, uint32_t expected, uint32_t desired) {
+    return __atomic_compare_exchange_n(state, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static uint32_t state_load(const volatile uint32_t *state) {
+    return __atomic_load_n(state, __ATOMIC_ACQUIRE);
+}
+
+static void state_store(volatile uint32_t *state, uint32_t value) {
+    __atomic_store_n(state, value, __ATOMIC_RELEASE);
+}
+
+vector_status_t vector_pingpong_init(vector_pingpong_t *pp, size_t size, dtype type, uint32_t placement) {
+    if (!pp) { return VECTOR_NULL;}
+    if (size == 0) { return VECTOR_INVALID_ARGUMENT;}
+    memset(pp, 0, sizeof(*pp));
+
+    for (int i = 0; i < 2; i++) {
+        pp->buffers[i] = vector_create_ex(size, type, placement);
+        if (!pp->buffers[i]) {
+            vector_pingpong_deinit(pp);
+            return VECTOR_ERROR;
+        }
+    }
+    pp->state[0] = VECTOR_PINGPONG_FILLING;
+    pp->state[1] = VECTOR_PINGPONG_FREE;
+    pp->fill = 0;
+    return VECTOR_SUCCESS;
+}
+
+void vector_pingpong_deinit(vector_pingpong_t *pp) {
+    if (!pp) { return;}
+    vector_pingpong_stop_producer(pp);
+    for (int i = 0; i < 2; i++) {
+        if (pp->buffers[i]) { vector_destroy(pp->buffers[i]);}
+        pp->buffers[i] = NULL;
+    }
+}
+
+vector_t *vector_pingpong_fill_buffer(vector_pingpong_t *pp) {
+    return pp ? pp->buffers[pp->fill] : NULL;
+}
+
+vector_status_t vector_pingpong_commit(vector_pingpong_t *pp) {
+    if (!pp) { return VECTOR_NULL;}
+    const uint32_t cur = pp->fill;
+    const uint32_t other = cur ^ 1;
+
+    state_store(&pp->seq[cur], pp->commits++);
+    state_store(&pp->state[cur], VECTOR_PINGPONG_READY);                                     // Publish
+
+    for (;;) {
+        if (state_cas(&pp->state[other], VECTOR_PINGPONG_FREE, VECTOR_PINGPONG_FILLING)) {
+            pp->fill = other;
+            return VECTOR_SUCCESS;
+        }
+        if (state_cas(&pp->state[other], VECTOR_PINGPONG_READY, VECTOR_PINGPONG_FILLING)) {   // Consumer behind: drop the older block
+            pp->fill = other;
+            pp->overruns++;
+            return VECTOR_SUCCESS;
+        }
+        if (state_cas(&pp->state[cur], VECTOR_PINGPONG_READY, VECTOR_PINGPONG_FILLING)) {     // Other block in use: drop this one
+            pp->overruns++;
+            return VECTOR_SUCCESS;
+        }
+        // The consumer took this block and so has released the other one; take that
+    }
+}
+
+vector_t *vector_pingpong_acquire(vector_pingpong_t *pp) {
+    if (!pp) { return NULL;}
+    if (state_load(&pp->state[0]) == VECTOR_PINGPONG_PROCESSING ||
+        state_load(&pp->state[1]) == VECTOR_PINGPONG_PROCESSING) { return NULL;}             // One block at a time
+
+    uint32_t first = ((int32_t)(state_load(&pp->seq[1]) - state_load(&pp->seq[0])) < 0) ? 1 : 0;  // Older commit first
+    for (uint32_t k = 0; k < 2; k++) {
+        uint32_t i = first ^ k;
+        if (state_cas(&pp->state[i], VECTOR_PINGPONG_READY, VECTOR_PINGPONG_PROCESSING)) {
+            return pp->buffers[i];
+        }
+    }
+    return NULL;
+}
+
+vector_status_t vector_pingpong_release(vector_pingpong_t *pp, vector_t *buffer) {
+    if (!pp || !buffer) { return VECTOR_NULL;}
+    for (int i = 0; i < 2; i++) {
+        if (pp->buffers[i] == buffer) {
+            if (!state_cas(&pp->state[i], VECTOR_PINGPONG_PROCESSING, VECTOR_PINGPONG_FREE)) { return VECTOR_INVALID_ARGUMENT;}
+            pp->processed++;
+            return VECTOR_SUCCESS;
+        }
+    }
+    return VECTOR_INVALID_ARGUMENT;
+}
+
+vector_status_t vector_pingpong_process(vector_pingpong_t *pp, vector_pingpong_consumer_t fn, void *ctx) {
+    if (!pp || !fn) { return VECTOR_NULL;}
+    vector_t *buffer = vector_pingpong_acquire(pp);
+    if (!buffer) { return VECTOR_SUCCESS;}
+    vector_status_t status = fn(buffer, ctx);
+    vector_pingpong_release(pp, buffer);
+    return status;
+}
+
+/**
+ * Producer task. The loop body is the same on both platforms; only task creation and the exit
+ * handshake differ.
+ */
+typedef struct {
+    vector_pingpong_t *pp;
+    vector_pingpong_producer_t fn;
+    void *ctx;
+    volatile uint32_t stop;                                                                 // Stop request, through state_store / state_load
+#if defined(ESP_PLATFORM)
+    SemaphoreHandle_t exited;
+#else
+    pthread_t thread;
+#endif
+} producer_t;
+
+static void producer_loop(producer_t *producer) {
+    while (!state_load(&producer->stop)) {
+        if (producer->fn(vector_pingpong_fill_buffer(producer->pp), producer->ctx) != VECTOR_SUCCESS) { break;}
+        if (state_load(&producer->stop)) { break;}                                          // Stopped mid-block: do not publish it
+        vector_pingpong_commit(producer->pp);
+    }
+}
+
+#if defined(ESP_PLATFORM)
+
+static void producer_main(void *arg) {
+    producer_t *producer = arg;
+    producer_loop(producer);
+    xSemaphoreGive(producer->exited);
+    vTaskDelete(NULL);
+}
+
+static vector_status_t producer_start(producer_t *producer) {
+    producer->exited = xSemaphoreCreateBinary();
+    if (!producer->exited) { return VECTOR_ERROR;}
+    if (xTaskCreate(producer_main, "vec_pingpong", PRODUCER_STACK, producer, uxTaskPriorityGet(NULL), NULL) != pdPASS) {
+        vSemaphoreDelete(producer->exited);
+        return VECTOR_ERROR;
+    }
+    return VECTOR_SUCCESS;
+}
+
+static void producer_join(producer_t *producer) {
+    xSemaphoreTake(producer->exited, portMAX_DELAY);
+    vSemaphoreDelete(producer->exited);
+}
+
+#else
+
+static void *producer_main(void *arg) {
+    producer_loop(arg);
+    return NULL;
+}
+
+static vector_status_t producer_start(producer_t *producer) {
+    return pthread_create(&producer->thread, NULL, producer_main, producer) == 0 ? VECTOR_SUCCESS : VECTOR_ERROR;
+}
+
+static void producer_join(producer_t *producer) {
+    pthread_join(producer->thread, NULL);
+}
+
+#endif
+
+vector_status_t vector_pingpong_start_producer(vector_pingpong_t *pp, vector_pingpong_producer_t fn, void *ctx) {
+    if (!pp || !fn) { return VECTOR_NULL;}
+    if (pp->producer) { return VECTOR_INVALID_ARGUMENT;}
+
+    producer_t *producer = heap_caps_malloc(sizeof(producer_t), MALLOC_CAP_DEFAULT);
+    if (!producer) { return VECTOR_ERROR;}
+    producer->pp = pp;
+    producer->fn = fn;
+    producer->ctx = ctx;
+    producer->stop = 0;
+    if (producer_start(producer) != VECTOR_SUCCESS) {
+        heap_caps_free(producer);
+        return VECTOR_ERROR;
+    }
+    pp->producer = producer;
+    return VECTOR_SUCCESS;
+}
+
+void vector_pingpong_stop_producer(vector_pingpong_t *pp) {
+    if (!pp || !pp->producer) { return;}
+    producer_t *producer = pp->producer;
+    state_store(&producer->stop, 1);
+    producer_join(producer);
+    heap_caps_free(producer);
+    pp->producer = NULL;
+}
@@ -0,0 +1,235 @@
+#include "vector_stream.h"
+#include "vector_basic_functions.h"
+#include "vector_compare_functions.h"
+#include "vector_dispatch.h"
+#include "simd_functions.h"
+#include <math.h>
+#include <string.h>
+
+#define STREAM_STATS (VECTOR_STREAM_SUM | VECTOR_STREAM_DOTP | VECTOR_STREAM_MINMAX)
+
+// Longest UINT8 / UINT16 slice whose vec_sum_unsigned cannot wrap: 255 * 2^24 and 65535 * 2^16 are below 2^32
+#define STREAM_SLICE_U8     ((size_t)1 << 24)
+#define STREAM_SLICE_U16    ((size_t)1 << 16)
+
+static bool dtype_unsigned(dtype type) {
+    return type == DTYPE_UINT8 || type == DTYPE_UINT16 || type == DTYPE_UINT32;
+}
+
+// Element i of an integer buffer, widened
+static int64_t load_int(const uint8_t *p, size_t i, dtype type) {
+    switch (type) {
+        case DTYPE_INT8:   { int8_t v;   memcpy(&v, p + i * sizeof(v), sizeof(v)); return v;}
+        case DTYPE_INT16:  { int16_t v;  memcpy(&v, p + i * sizeof(v), sizeof(v)); return v;}
+        case DTYPE_INT32:  { int32_t v;  memcpy(&v, p + i * sizeof(v), sizeof(v)); return v;}
+        case DTYPE_UINT8:  { uint8_t v;  memcpy(&v, p + i * sizeof(v), sizeof(v)); return v;}
+        case DTYPE_UINT16: { uint16_t v; memcpy(&v, p + i * sizeof(v), sizeof(v)); return v;}
+        case DTYPE_UINT32: { uint32_t v; memcpy(&v, p + i * sizeof(v), sizeof(v)); return v;}
+        default: return 0;
+    }
+}
+
+// Fills a lane buffer with the identity of min (high) or max (!high)
+static void fill_identity(uint8_t *lanes, dtype type, bool high) {
+    const size_t elem = sizeof_dtype(type);
+    for (size_t i = 0; i < VECTOR_STREAM_LANES / elem; i++) {
+        switch (type) {
+            case DTYPE_INT8:    { int8_t v = high ? INT8_MAX : INT8_MIN;        memcpy(lanes + i * elem, &v, elem); break;}
+            case DTYPE_INT16:   { int16_t v = high ? INT16_MAX : INT16_MIN;     memcpy(lanes + i * elem, &v, elem); break;}
+            case DTYPE_INT32:   { int32_t v = high ? INT32_MAX : INT32_MIN;     memcpy(lanes + i * elem, &v, elem); break;}
+            case DTYPE_FLOAT32: { float v = high ? INFINITY : -INFINITY;        memcpy(lanes + i * elem, &v, elem); break;}
+            case DTYPE_UINT8:   { uint8_t v = high ? UINT8_MAX : 0;             memcpy(lanes + i * elem, &v, elem); break;}
+            case DTYPE_UINT16:  { uint16_t v = high ? UINT16_MAX : 0;           memcpy(lanes + i * elem, &v, elem); break;}
+            case DTYPE_UINT32:  { uint32_t v = high ? UINT32_MAX : 0;           memcpy(lanes + i * elem, &v, elem); break;}
+            default: break;
+        }
+    }
+}
+
+vector_status_t vector_stream_begin(vector_stream_t *stream, dtype type, uint32_t stats) {
+    if (!stream) { return VECTOR_NULL;}
+    if (stats == 0 || (stats & ~STREAM_STATS)) { return VECTOR_INVALID_ARGUMENT;}
+    if (type < DTYPE_INT8 || type > DTYPE_UINT32) { return VECTOR_TYPE_MISMATCH;}
+    if ((uintptr_t)stream & 0xF) { return VECTOR_UNALIGNED_DATA;}                           // The lanes are kernel operands
+    if ((stats & VECTOR_STREAM_DOTP) && dtype_unsigned(type)) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if ((stats & VECTOR_STREAM_MINMAX) && (!vec_binary_kernel(VECTOR_OP_MIN, type) || !vec_binary_kernel(VECTOR_OP_MAX, type))) {
+        return VECTOR_NOT_IMPLEMENTED;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    stream->type = type;
+    stream->stats = stats;
+    if (stats & VECTOR_STREAM_MINMAX) {
+        fill_identity(stream->lane_min, type, true);
+        fill_identity(stream->lane_max, type, false);
+    }
+    return VECTOR_SUCCESS;
+}
+
+// Folds n elements at a into the min/max lanes, VECTOR_STREAM_LANES bytes at a time
+static vector_status_t stream_minmax(vector_stream_t *stream, void *a, size_t n) {
+    const size_t lane_elems = VECTOR_STREAM_LANES / sizeof_dtype(stream->type);
+    const size_t elem = sizeof_dtype(stream->type);
+    vector_t piece, lane_min, lane_max;
+    vector_status_t status = VECTOR_SUCCESS;
+
+    for (size_t off = 0; off < n && status == VECTOR_SUCCESS; off += lane_elems) {
+        size_t m = (n - off < lane_elems) ? n - off : lane_elems;
+        vector_set_unaligned(&piece, (uint8_t*)a + off * elem, m, stream->type);
+        vector_set_unaligned(&lane_min, stream->lane_min, m, stream->type);
+        vector_set_unaligned(&lane_max, stream->lane_max, m, stream->type);
+        status = vec_min(&piece, &lane_min, &lane_min);
+        if (status == VECTOR_SUCCESS) { status = vec_max(&piece, &lane_max, &lane_max);}
+    }
+    return status;
+}
+
+// Exact sum of n unsigned elements at a. UINT8 / UINT16 run through vec_sum_unsigned in slices that
+// cannot wrap; UINT32 has no such slice length, so it is widened element by element
+static vector_status_t stream_sum_unsigned(vector_stream_t *stream, void *a, size_t n) {
+    if (stream->type == DTYPE_UINT32) {
+        uint64_t part;
+        vector_status_t status = (vector_status_t)simd_sum_wide_u32(a, &part, n);          // Plain C, needs only element alignment
+        stream->sum += (int64_t)part;
+        return status;
+    }
+
+    const size_t slice = (stream->type == DTYPE_UINT8) ? STREAM_SLICE_U8 : STREAM_SLICE_U16;
+    const size_t elem = sizeof_dtype(stream->type);
+    vector_t piece;
+    for (size_t off = 0; off < n; off += slice) {
+        uint32_t part;
+        size_t m = (n - off < slice) ? n - off : slice;
+        vector_status_t status = vector_set_unaligned(&piece, (uint8_t*)a + off * elem, m, stream->type);
+        if (status == VECTOR_SUCCESS) { status = vec_sum_unsigned(&piece, &part);}
+        if (status != VECTOR_SUCCESS) { return status;}
+        stream->sum += part;
+    }
+    return VECTOR_SUCCESS;
+}
+
+// Reduces n elements of each input with the vec_* kernels and adds the partials to the stream
+static vector_status_t stream_reduce(vector_stream_t *stream, void *a, void *b, size_t n) {
+    vector_t va, vb;
+    vector_status_t status = vector_set_unaligned(&va, a, n, stream->type);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    if (stream->stats & VECTOR_STREAM_SUM) {
+        if (stream->type == DTYPE_FLOAT32) {
+            float part;
+            status = vec_sum_f32(&va, &part);
+            stream->sum_f32 += part;
+        } else if (dtype_unsigned(stream->type)) {
+            status = stream_sum_unsigned(stream, a, n);
+        } else {
+            int64_t part;
+            status = vec_sum_i64(&va, &part);
+            stream->sum += part;
+        }
+        if (status != VECTOR_SUCCESS) { return status;}
+    }
+
+    if (stream->stats & VECTOR_STREAM_DOTP) {
+        status = vector_set_unaligned(&vb, b, n, stream->type);
+        if (status != VECTOR_SUCCESS) { return status;}
+        if (stream->type == DTYPE_FLOAT32) {
+            float part;
+            status = vec_dotp_f32(&va, &vb, &part);
+            stream->dotp_f32 += part;
+        } else {
+            int64_t part;
+            status = vec_dotp_i64(&va, &vb, &part);
+            stream->dotp += part;
+        }
+        if (status != VECTOR_SUCCESS) { return status;}
+    }
+
+    if (stream->stats & VECTOR_STREAM_MINMAX) {
+        status = stream_minmax(stream, a, n);
+    }
+    return status;
+}
+
+vector_status_t vector_stream_update(vector_stream_t *stream, const vector_t *a, const vector_t *b) {
+    if (!stream || !a || !a->data) { return VECTOR_NULL;}
+    const bool paired = stream->stats & VECTOR_STREAM_DOTP;
+    if (paired && (!b || !b->data)) { return VECTOR_NULL;}
+    if (a->type != stream->type || (paired && b->type != stream->type)) { return VECTOR_TYPE_MISMATCH;}
+    if (paired && a->size != b->size) { return VECTOR_SIZE_MISMATCH;}
+
+    const size_t elem = sizeof_dtype(stream->type);
+    const size_t block = 16 / elem;
+    if (((uintptr_t)a->data | (paired ? (uintptr_t)b->data : 0)) & (elem - 1)) { return VECTOR_UNALIGNED_DATA;}
+    uint8_t *pa = a->data;
+    uint8_t *pb = paired ? b->data : NULL;
+    size_t n = a->size;
+    vector_status_t status;
+
+    if (stream->carry) {                                                                    // Complete the held-back block first
+        size_t take = block - stream->carry;
+        if (take > n) { take = n;}
+        memcpy(stream->carry_a + stream->carry * elem, pa, take * elem);
+        if (pb) { memcpy(stream->carry_b + stream->carry * elem, pb, take * elem);}
+        stream->carry += take;
+        stream->count += take;
+        pa += take * elem;
+        if (pb) { pb += take * elem;}
+        n -= take;
+        if (stream->carry < block) { return VECTOR_SUCCESS;}
+        status = stream_reduce(stream, stream->carry_a, stream->carry_b, block);
+        if (status != VECTOR_SUCCESS) { return status;}
+        stream->carry = 0;
+    }
+
+    const size_t body = n - n % block;
+    if (body) {
+        status = stream_reduce(stream, pa, pb, body);
+        if (status != VECTOR_SUCCESS) { return status;}
+        stream->count += body;
+    }
+
+    const size_t rest = n - body;                                                           // Hold back the partial block
+    memcpy(stream->carry_a, pa + body * elem, rest * elem);
+    if (pb) { memcpy(stream->carry_b, pb + body * elem, rest * elem);}
+    stream->carry = rest;
+    stream->count += rest;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_stream_finish(vector_stream_t *stream) {
+    if (!stream) { return VECTOR_NULL;}
+    if (stream->carry) {
+        vector_status_t status = stream_reduce(stream, stream->carry_a, stream->carry_b, stream->carry);
+        if (status != VECTOR_SUCCESS) { return status;}
+        stream->carry = 0;
+    }
+    if (!(stream->stats & VECTOR_STREAM_MINMAX) || stream->count == 0) { return VECTOR_SUCCESS;}
+
+    const size_t lanes = VECTOR_STREAM_LANES / sizeof_dtype(stream->type);
+    if (stream->type == DTYPE_FLOAT32) {
+        float lo, hi;
+        memcpy(&lo, stream->lane_min, sizeof(lo));
+        memcpy(&hi, stream->lane_max, sizeof(hi));
+        for (size_t i = 1; i < lanes; i++) {                                                // NaN propagates, as in simd_min_f32 / simd_max_f32
+            float v;
+            memcpy(&v, stream->lane_min + i * sizeof(v), sizeof(v));
+            if (v < lo || isnan(v)) { lo = v;}
+            memcpy(&v, stream->lane_max + i * sizeof(v), sizeof(v));
+            if (v > hi || isnan(v)) { hi = v;}
+        }
+        stream->min_f32 = lo;
+        stream->max_f32 = hi;
+    } else {
+        int64_t lo = load_int(stream->lane_min, 0, stream->type);
+        int64_t hi = load_int(stream->lane_max, 0, stream->type);
+        for (size_t i = 1; i < lanes; i++) {
+            int64_t v = load_int(stream->lane_min, i, stream->type);
+            if (v < lo) { lo = v;}
+            v = load_int(stream->lane_max, i, stream->type);
+            if (v > hi) { hi = v;}
+        }
+        stream->min = lo;
+        stream->max = hi;
+    }
+    return VECTOR_SUCCESS;
+}
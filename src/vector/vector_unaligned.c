@@ -0,0 +1,161 @@
+#include "vector_dispatch_table.h"
+#include "simd_functions.h"
+#include <stdalign.h>
+#include <string.h>
+
+#define UNALIGNED_TILE 256                                                                  // Bytes per realigned tile, a multiple of 16
+
+// Elements before the first 16-byte boundary at or after ptr, at most size
+static size_t head_elems(const void *ptr, size_t size, size_t elem) {
+    size_t head = ((16 - ((uintptr_t)ptr & 0xF)) & 0xF) / elem;
+    return head < size ? head : size;
+}
+
+// ptr itself if aligned, otherwise tile filled with its first bytes
+static const void *realign(const void *ptr, uint8_t *tile, size_t bytes) {
+    if (!vector_misaligned((uintptr_t)ptr)) { return ptr;}
+    simd_realign_u8(ptr, tile, bytes);
+    return tile;
+}
+
+vector_status_t vector_binary_unaligned(vector_binary_kernel_t kernel, const void *a, const void *b, void *result,
+                                        unsigned int shift_amount, size_t size, size_t elem) {
+    if (((uintptr_t)a | (uintptr_t)b | (uintptr_t)result) & (elem - 1)) { return VECTOR_UNALIGNED_DATA;}  // Scalar loads need natural alignment
+    alignas(16) uint8_t tile_a[UNALIGNED_TILE];
+    alignas(16) uint8_t tile_b[UNALIGNED_TILE];
+    const uint8_t *pa = a;
+    const uint8_t *pb = b;
+    uint8_t *pr = result;
+    int status;
+
+    size_t head = head_elems(pr, size, elem);                                               // Peel up to the result's boundary
+    if (head) {
+        alignas(16) uint8_t tile_r[16];
+        memcpy(tile_a, pa, head * elem);
+        memcpy(tile_b, pb, head * elem);
+        status = kernel(tile_a, tile_b, tile_r, shift_amount, head);
+        if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+        memcpy(pr, tile_r, head * elem);
+        pa += head * elem;
+        pb += head * elem;
+        pr += head * elem;
+        size -= head;
+    }
+
+    if (!vector_misaligned((uintptr_t)pa | (uintptr_t)pb)) {                                // Same misalignment: body runs in place
+        return (vector_status_t)kernel(pa, pb, pr, shift_amount, size);
+    }
+    const size_t tile_elems = UNALIGNED_TILE / elem;
+    for (size_t off = 0; off < size; off += tile_elems) {
+        size_t n = (size - off < tile_elems) ? size - off : tile_elems;
+        size_t bytes = off * elem;
+        status = kernel(realign(pa + bytes, tile_a, n * elem), realign(pb + bytes, tile_b, n * elem), pr + bytes, shift_amount, n);
+        if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+    }
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_unary_unaligned(vector_unary_kernel_t kernel, const void *a, void *result, size_t size, size_t elem) {
+    if (((uintptr_t)a | (uintptr_t)result) & (elem - 1)) { return VECTOR_UNALIGNED_DATA;}
+    alignas(16) uint8_t tile_a[UNALIGNED_TILE];
+    const uint8_t *pa = a;
+    uint8_t *pr = result;
+    int status;
+
+    size_t head = head_elems(pr, size, elem);
+    if (head) {
+        alignas(16) uint8_t tile_r[16];
+        memcpy(tile_a, pa, head * elem);
+        status = kernel(tile_a, tile_r, head);
+        if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+        memcpy(pr, tile_r, head * elem);
+        pa += head * elem;
+        pr += head * elem;
+        size -= head;
+    }
+
+    if (!vector_misaligned((uintptr_t)pa)) {
+        return (vector_status_t)kernel(pa, pr, size);
+    }
+    const size_t tile_elems = UNALIGNED_TILE / elem;
+    for (size_t off = 0; off < size; off += tile_elems) {
+        size_t n = (size - off < tile_elems) ? size - off : tile_elems;
+        status = kernel(realign(pa + off * elem, tile_a, n * elem), pr + off * elem, n);
+        if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+    }
+    return VECTOR_SUCCESS;
+}
+
+typedef union {
+    uint32_t u;                                                                             // Integer partials, combined modulo 2^32
+    uint64_t w;                                                                             // Wide partials, combined modulo 2^64
+    float f;
+} reduce_acc_t;
+
+static void reduce_combine(reduce_acc_t *acc, const reduce_acc_t *part, dtype type, bool wide) {
+    if (wide) {
+        acc->w += part->w;
+    } else if (type == DTYPE_FLOAT32) {
+        acc->f += part->f;
+    } else {
+        acc->u += part->u;
+    }
+}
+
+// INT32 sum: the whole input goes through the aligned tile under one lane state, never peeled
+static vector_status_t sum_i32_unaligned(const int32_t *a, int32_t *result, size_t size) {
+    alignas(16) uint8_t tile[UNALIGNED_TILE];
+    const size_t tile_elems = UNALIGNED_TILE / sizeof(int32_t);
+    vector_sum_i32_t sum;
+    vector_sum_i32_begin(&sum);
+    for (size_t off = 0; off < size; off += tile_elems) {
+        size_t n = (size - off < tile_elems) ? size - off : tile_elems;
+        int status = vector_sum_i32_add(&sum, realign(a + off, tile, n * sizeof(int32_t)), n);
+        if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+    }
+    *result = vector_sum_i32_end(&sum);
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_reduce_unaligned(vector_reduce_kernel_t kernel, const void *a, const void *b, void *result, size_t size, dtype type, bool wide) {
+    const size_t elem = sizeof_dtype(type);
+    if (elem == 0) { return VECTOR_ERROR;}
+    if (((uintptr_t)a | (uintptr_t)b) & (elem - 1)) { return VECTOR_UNALIGNED_DATA;}
+    if (type == DTYPE_INT32 && !b && !wide) { return sum_i32_unaligned(a, result, size);}  // simd_sum_i32 saturates per lane
+    alignas(16) uint8_t tile_a[16];
+    alignas(16) uint8_t tile_b[UNALIGNED_TILE];
+    const uint8_t *pa = a;
+    const uint8_t *pb = b;
+    reduce_acc_t acc = { .w = 0 };
+    reduce_acc_t part;
+    int status;
+    if (type == DTYPE_FLOAT32) { acc.f = 0.0f;}
+
+    size_t head = head_elems(pa, size, elem);                                               // Peel up to the first input's boundary
+    if (head) {
+        memcpy(tile_a, pa, head * elem);
+        if (pb) { memcpy(tile_b, pb, head * elem);}
+        status = kernel(tile_a, pb ? tile_b : NULL, &part, head);
+        if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+        reduce_combine(&acc, &part, type, wide);
+        pa += head * elem;
+        if (pb) { pb += head * elem;}
+        size -= head;
+    }
+
+    if (!pb || !vector_misaligned((uintptr_t)pb)) {                                         // Body runs in place
+        status = kernel(pa, pb, &part, size);
+        if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+        reduce_combine(&acc, &part, type, wide);
+    } else {
+        const size_t tile_elems = UNALIGNED_TILE / elem;
+        for (size_t off = 0; off < size; off += tile_elems) {
+            size_t n = (size - off < tile_elems) ? size - off : tile_elems;
+            status = kernel(pa + off * elem, realign(pb + off * elem, tile_b, n * elem), &part, n);
+            if (status != VECTOR_SUCCESS) { return (vector_status_t)status;}
+            reduce_combine(&acc, &part, type, wide);
+        }
+    }
+    memcpy(result, &acc, wide ? sizeof(acc.w) : sizeof(acc.u));                             // int32_t, uint32_t and float are all 4 bytes
+    return VECTOR_SUCCESS;
+}
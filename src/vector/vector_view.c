@@ -0,0 +1,317 @@
+#include "vector_view.h"
+#include "vector_basic_functions.h"
+#include "vector_dispatch_table.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+typedef union {
+    uint32_t u;                     // Integer partials, combined modulo 2^32
+    float f;
+} view_acc_t;
+
+// Reduction over one tile, one of the vec_sum/vec_dotp wrappers; b is NULL for sums
+typedef vector_status_t (*view_reduce_fn_t)(const vector_t *a, const vector_t *b, void *result);
+
+/**
+ * Copies count elements between a strided view and a dense tile. Strides 2, 3 and 4 (stereo, xyz,
+ * quad channels) get their own loops so the element offsets are compile-time constants and the
+ * fixed-size memcpy becomes a single load and store.
+ */
+#define VIEW_GATHER(E, S)   for (size_t i = 0; i < count; i++) { memcpy(dst + i * (E), src + i * (S) * (E), (E));}
+#define VIEW_SCATTER(E, S)  for (size_t i = 0; i < count; i++) { memcpy(dst + i * (S) * (E), src + i * (E), (E));}
+
+#define VIEW_STRIDES(MOVE, E)                   \
+    switch (stride) {                           \
+        case 2:  MOVE(E, 2); break;             \
+        case 3:  MOVE(E, 3); break;             \
+        case 4:  MOVE(E, 4); break;             \
+        default: MOVE(E, stride); break;        \
+    }
+
+#define VIEW_ELEMS(MOVE)                        \
+    switch (elem) {                             \
+        case 1:  VIEW_STRIDES(MOVE, 1); break;  \
+        case 2:  VIEW_STRIDES(MOVE, 2); break;  \
+        default: VIEW_STRIDES(MOVE, 4); break;  \
+    }
+
+static void view_gather(uint8_t *dst, const uint8_t *src, size_t stride, size_t count, size_t elem) {
+    if (stride == 1) { memcpy(dst, src, count * elem); return;}
+    VIEW_ELEMS(VIEW_GATHER)
+}
+
+static void view_scatter(uint8_t *dst, const uint8_t *src, size_t stride, size_t count, size_t elem) {
+    if (stride == 1) { memcpy(dst, src, count * elem); return;}
+    VIEW_ELEMS(VIEW_SCATTER)
+}
+
+static inline bool aligned16(const void *ptr) {
+    return ((uintptr_t)ptr & 0xF) == 0;
+}
+
+static vector_status_t view_ok(const vector_view_t *view) {
+    if (!view || !view->data) { return VECTOR_NULL;}
+    if (view->stride == 0) { return VECTOR_INVALID_ARGUMENT;}
+    if (view->type < DTYPE_INT8 || view->type > DTYPE_UINT32) { return VECTOR_TYPE_MISMATCH;}
+    if ((uintptr_t)view->data & (sizeof_dtype(view->type) - 1)) { return VECTOR_UNALIGNED_DATA;}
+    return VECTOR_SUCCESS;
+}
+
+// Template vector over the view's first element, for validation with the vec_prepare_* functions
+static vector_t view_template(const vector_view_t *view) {
+    return (vector_t){ .data = view->data, .type = view->type, .size = view->size, .owns_data = false };
+}
+
+// VECTOR_VIEW_TILE elements each for a, b and result; only strided runs need it
+static uint8_t *view_scratch(size_t elem) {
+    return heap_caps_aligned_alloc(16, 3 * VECTOR_VIEW_TILE * elem, MALLOC_CAP_DEFAULT);
+}
+
+// Tile i of a view: the view itself when it is dense and aligned, otherwise its scratch tile
+static const uint8_t *view_load(const vector_view_t *view, size_t i, size_t count, uint8_t *tile, size_t elem) {
+    const uint8_t *p = (const uint8_t*)view->data + i * view->stride * elem;
+    if (view->stride == 1 && aligned16(p)) { return p;}
+    view_gather(tile, p, view->stride, count, elem);
+    return tile;
+}
+
+vector_status_t vector_view(const vector_t *vec, size_t offset, size_t length, size_t stride, vector_view_t *out) {
+    if (!vec || !out || !vec->data) { return VECTOR_NULL;}
+    if (vec->type < DTYPE_INT8 || vec->type > DTYPE_UINT32) { return VECTOR_TYPE_MISMATCH;}
+    if (length == 0 || stride == 0 || offset >= vec->size) { return VECTOR_INVALID_ARGUMENT;}
+    if ((length - 1) > (vec->size - 1 - offset) / stride) { return VECTOR_INVALID_ARGUMENT;}   // Last element past the end
+
+    out->data = (uint8_t*)vec->data + offset * sizeof_dtype(vec->type);
+    out->type = vec->type;
+    out->size = length;
+    out->stride = stride;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_view_deinterleave(const vector_t *vec, size_t channels, vector_view_t *views) {
+    if (!vec || !views || !vec->data) { return VECTOR_NULL;}
+    if (channels == 0) { return VECTOR_INVALID_ARGUMENT;}
+    if (vec->size == 0 || vec->size % channels != 0) { return VECTOR_SIZE_MISMATCH;}
+    for (size_t c = 0; c < channels; c++) {
+        vector_status_t status = vector_view(vec, c, vec->size / channels, channels, &views[c]);
+        if (status != VECTOR_SUCCESS) { return status;}
+    }
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vector_view_as_vector(const vector_view_t *view, vector_t *out) {
+    if (!view || !out) { return VECTOR_NULL;}
+    if (view->stride != 1) { return VECTOR_INVALID_ARGUMENT;}
+    return vector_set_unaligned(out, view->data, view->size, view->type);
+}
+
+// Shared checks of gather and scatter
+static vector_status_t view_copy_ok(const vector_view_t *view, const vector_t *dense) {
+    vector_status_t status = view_ok(view);
+    if (status != VECTOR_SUCCESS) { return status;}
+    if (!dense || !dense->data) { return VECTOR_NULL;}
+    if (view->size != dense->size) { return VECTOR_SIZE_MISMATCH;}
+    if (view->type != dense->type) { return VECTOR_TYPE_MISMATCH;}
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vec_view_gather(const vector_view_t *view, vector_t *dense) {
+    vector_status_t status = view_copy_ok(view, dense);
+    if (status != VECTOR_SUCCESS) { return status;}
+    view_gather(dense->data, view->data, view->stride, view->size, sizeof_dtype(view->type));
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vec_view_scatter(const vector_t *dense, const vector_view_t *view) {
+    vector_status_t status = view_copy_ok(view, dense);
+    if (status != VECTOR_SUCCESS) { return status;}
+    view_scatter(view->data, dense->data, view->stride, view->size, sizeof_dtype(view->type));
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t vec_view_binary(vector_binary_op_t op, const vector_view_t *a, const vector_view_t *b,
+                                const vector_view_t *result, unsigned int shift_amount) {
+    vector_status_t status;
+    if ((status = view_ok(a)) != VECTOR_SUCCESS) { return status;}
+    if ((status = view_ok(b)) != VECTOR_SUCCESS) { return status;}
+    if ((status = view_ok(result)) != VECTOR_SUCCESS) { return status;}
+
+    // Validates op, sizes, dtypes and shift exactly as the vec_* wrappers do
+    vector_t tmpl_a = view_template(a);
+    vector_t tmpl_b = view_template(b);
+    vector_t tmpl_r = view_template(result);
+    vector_binary_plan_t plan;
+    status = vec_prepare_binary(&plan, op, &tmpl_a, &tmpl_b, &tmpl_r, shift_amount);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    const size_t elem = sizeof_dtype(result->type);
+    if (a->stride == 1 && b->stride == 1 && result->stride == 1) {                         // Dense: no staging at all
+        if (vector_misaligned((uintptr_t)a->data | (uintptr_t)b->data | (uintptr_t)result->data)) {
+            return vector_binary_unaligned(plan.kernel, a->data, b->data, result->data, plan.shift_amount, plan.size, elem);
+        }
+        return (vector_status_t)plan.kernel(a->data, b->data, result->data, plan.shift_amount, plan.size);
+    }
+
+    uint8_t *scratch = view_scratch(elem);
+    if (!scratch) { return VECTOR_ERROR;}
+    uint8_t *sa = scratch;
+    uint8_t *sb = sa + VECTOR_VIEW_TILE * elem;
+    uint8_t *sr = sb + VECTOR_VIEW_TILE * elem;
+
+    for (size_t i = 0; i < plan.size && status == VECTOR_SUCCESS; i += VECTOR_VIEW_TILE) {
+        const size_t count = (plan.size - i < VECTOR_VIEW_TILE) ? plan.size - i : VECTOR_VIEW_TILE;
+        uint8_t *pr = (uint8_t*)result->data + i * result->stride * elem;
+        const bool direct_r = result->stride == 1 && aligned16(pr);
+        status = (vector_status_t)plan.kernel(view_load(a, i, count, sa, elem), view_load(b, i, count, sb, elem),
+                                              direct_r ? pr : sr, plan.shift_amount, count);
+        if (status == VECTOR_SUCCESS && !direct_r) { view_scatter(pr, sr, result->stride, count, elem);}
+    }
+
+    heap_caps_free(scratch);
+    return status;
+}
+
+vector_status_t vec_view_unary(vector_unary_op_t op, const vector_view_t *a, const vector_view_t *result) {
+    vector_status_t status;
+    if ((status = view_ok(a)) != VECTOR_SUCCESS) { return status;}
+    if ((status = view_ok(result)) != VECTOR_SUCCESS) { return status;}
+
+    vector_t tmpl_a = view_template(a);
+    vector_t tmpl_r = view_template(result);
+    vector_unary_plan_t plan;
+    status = vec_prepare_unary(&plan, op, &tmpl_a, &tmpl_r);
+    if (status != VECTOR_SUCCESS) { return status;}
+
+    const size_t elem = sizeof_dtype(result->type);
+    if (a->stride == 1 && result->stride == 1) {
+        if (vector_misaligned((uintptr_t)a->data | (uintptr_t)result->data)) {
+            return vector_unary_unaligned(plan.kernel, a->data, result->data, plan.size, elem);
+        }
+        return (vector_status_t)plan.kernel(a->data, result->data, plan.size);
+    }
+
+    uint8_t *scratch = view_scratch(elem);
+    if (!scratch) { return VECTOR_ERROR;}
+    uint8_t *sa = scratch;
+    uint8_t *sr = sa + 2 * VECTOR_VIEW_TILE * elem;
+
+    for (size_t i = 0; i < plan.size && status == VECTOR_SUCCESS; i += VECTOR_VIEW_TILE) {
+        const size_t count = (plan.size - i < VECTOR_VIEW_TILE) ? plan.size - i : VECTOR_VIEW_TILE;
+        uint8_t *pr = (uint8_t*)result->data + i * result->stride * elem;
+        const bool direct_r = result->stride == 1 && aligned16(pr);
+        status = (vector_status_t)plan.kernel(view_load(a, i, count, sa, elem), direct_r ? pr : sr, count);
+        if (status == VECTOR_SUCCESS && !direct_r) { view_scatter(pr, sr, result->stride, count, elem);}
+    }
+
+    heap_caps_free(scratch);
+    return status;
+}
+
+static vector_status_t sum_tile(const vector_t *a, const vector_t *b, void *result);
+
+/**
+ * Runs fn over the view once if it is dense, otherwise tile by tile, combining the per-tile
+ * results like the unaligned reductions: integers modulo 2^32, floats with a float add. INT32
+ * sums instead carry the saturating lanes of simd_sum_i32 from tile to tile, so the result
+ * matches vec_sum() on a dense copy.
+ */
+static vector_status_t view_reduce(view_reduce_fn_t fn, const vector_view_t *a, const vector_view_t *b, void *result) {
+    vector_status_t status;
+    if (!result) { return VECTOR_NULL;}
+    if ((status = view_ok(a)) != VECTOR_SUCCESS) { return status;}
+    if (b) {
+        if ((status = view_ok(b)) != VECTOR_SUCCESS) { return status;}
+        if (a->size != b->size) { return VECTOR_SIZE_MISMATCH;}
+        if (a->type != b->type) { return VECTOR_TYPE_MISMATCH;}
+    }
+
+    vector_t va = view_template(a);
+    vector_t vb = b ? view_template(b) : va;
+    if (a->stride == 1 && (!b || b->stride == 1)) {
+        return fn(&va, b ? &vb : NULL, result);
+    }
+
+    const size_t elem = sizeof_dtype(a->type);
+    uint8_t *scratch = view_scratch(elem);
+    if (!scratch) { return VECTOR_ERROR;}
+    uint8_t *sa = scratch;
+    uint8_t *sb = sa + VECTOR_VIEW_TILE * elem;
+
+    view_acc_t acc = { .u = 0 };
+    view_acc_t part;
+    if (a->type == DTYPE_FLOAT32) { acc.f = 0.0f;}
+    const bool sum_i32 = fn == sum_tile && a->type == DTYPE_INT32;
+    vector_sum_i32_t lanes;
+    vector_sum_i32_begin(&lanes);
+    for (size_t i = 0; i < a->size; i += VECTOR_VIEW_TILE) {
+        const size_t count = (a->size - i < VECTOR_VIEW_TILE) ? a->size - i : VECTOR_VIEW_TILE;
+        va.data = (void*)view_load(a, i, count, sa, elem);
+        va.size = count;
+        if (b) {
+            vb.data = (void*)view_load(b, i, count, sb, elem);
+            vb.size = count;
+        }
+        if (sum_i32) {                                                                      // Gathered tiles are aligned, VECTOR_VIEW_TILE a multiple of 4
+            status = (vector_status_t)vector_sum_i32_add(&lanes, va.data, count);
+            if (status != VECTOR_SUCCESS) { break;}
+            continue;
+        }
+        status = fn(&va, b ? &vb : NULL, &part);
+        if (status != VECTOR_SUCCESS) { break;}
+        if (a->type == DTYPE_FLOAT32) {
+            acc.f += part.f;
+        } else {
+            acc.u += part.u;
+        }
+    }
+
+    heap_caps_free(scratch);
+    if (sum_i32) { acc.u = (uint32_t)vector_sum_i32_end(&lanes);}
+    if (status == VECTOR_SUCCESS) { memcpy(result, &acc, sizeof(acc));}                      // int32_t, uint32_t and float are all 4 bytes
+    return status;
+}
+
+static vector_status_t sum_tile(const vector_t *a, const vector_t *b, void *result) {
+    (void)b;
+    return vec_sum(a, result);
+}
+
+static vector_status_t sum_f32_tile(const vector_t *a, const vector_t *b, void *result) {
+    (void)b;
+    return vec_sum_f32(a, result);
+}
+
+static vector_status_t sum_unsigned_tile(const vector_t *a, const vector_t *b, void *result) {
+    (void)b;
+    return vec_sum_unsigned(a, result);
+}
+
+static vector_status_t dotp_tile(const vector_t *a, const vector_t *b, void *result) {
+    return vec_dotp(a, b, result);
+}
+
+static vector_status_t dotp_f32_tile(const vector_t *a, const vector_t *b, void *result) {
+    return vec_dotp_f32(a, b, result);
+}
+
+vector_status_t vec_view_sum(const vector_view_t *view, int32_t *result) {
+    return view_reduce(sum_tile, view, NULL, result);
+}
+
+vector_status_t vec_view_sum_f32(const vector_view_t *view, float *result) {
+    return view_reduce(sum_f32_tile, view, NULL, result);
+}
+
+vector_status_t vec_view_sum_unsigned(const vector_view_t *view, uint32_t *result) {
+    return view_reduce(sum_unsigned_tile, view, NULL, result);
+}
+
+vector_status_t vec_view_dotp(const vector_view_t *a, const vector_view_t *b, int32_t *result) {
+    if (!b) { return VECTOR_NULL;}
+    return view_reduce(dotp_tile, a, b, result);
+}
+
+vector_status_t vec_view_dotp_f32(const vector_view_t *a, const vector_view_t *b, float *result) {
+    if (!b) { return VECTOR_NULL;}
+    return view_reduce(dotp_f32_tile, a, b, result);
+}
@@ -0,0 +1,119 @@
+#ifndef SIMD_X86_H
+#define SIMD_X86_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <immintrin.h>
+#include "simd_portable.h"
+
+/**
+ * Shared helpers for the x86 backend.
+ *
+ * The x86 backend replaces the hot portable kernels (add, sub, mul_shift, sum, dotp, min/max,
+ * compares and bitwise ops) with SSE4.1 or AVX2 intrinsics. Results are bit-identical to the
+ * PIE assembly: saturating instructions are used where ee.vadds/ee.vsubs saturate, products are
+ * truncated the same way ee.vmul does after the SAR shift, and reductions wrap in 32 bits.
+ *
+ * Kernels are written once against the X86_* macros below, which map to 256-bit AVX2 when the
+ * compiler targets it and to 128-bit SSE4.1 otherwise. Loads and stores are unaligned so host
+ * buffers need not follow the 16-byte rule enforced on target. Tails use the portable helpers.
+ */
+
+#if defined(__AVX2__)
+
+typedef __m256i x86_vec_t;
+#define X86_VEC_BYTES           32
+#define X86_OP(op)              _mm256_##op
+#define X86_LOAD(p)             _mm256_loadu_si256((const __m256i *)(p))
+#define X86_STORE(p, v)         _mm256_storeu_si256((__m256i *)(p), (v))
+#define X86_ZERO()              _mm256_setzero_si256()
+#define X86_ONES()              _mm256_set1_epi32(-1)
+#define X86_AND(a, b)           _mm256_and_si256((a), (b))
+#define X86_OR(a, b)            _mm256_or_si256((a), (b))
+#define X86_XOR(a, b)           _mm256_xor_si256((a), (b))
+
+// Loads X86_VEC_BYTES / 2 bytes and sign-extends each int8_t to int16_t
+static inline x86_vec_t x86_load_widen_i8(const int8_t *p) {
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)p));
+}
+
+// Stores the low byte of each int16_t lane (X86_VEC_BYTES / 2 bytes)
+static inline void x86_store_narrow_i16(int8_t *p, x86_vec_t v) {
+    v = _mm256_and_si256(v, _mm256_set1_epi16(0x00FF));
+    v = _mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), 0x08);                  // packus works per 128-bit half
+    _mm_storeu_si128((__m128i *)p, _mm256_castsi256_si128(v));
+}
+
+// Stores each int16_t lane saturated to int8_t (X86_VEC_BYTES / 2 bytes)
+static inline void x86_store_sat_i16(int8_t *p, x86_vec_t v) {
+    v = _mm256_permute4x64_epi64(_mm256_packs_epi16(v, v), 0x08);
+    _mm_storeu_si128((__m128i *)p, _mm256_castsi256_si128(v));
+}
+
+static inline int32_t x86_hsum_i32(x86_vec_t v) {
+    __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+    return _mm_cvtsi128_si32(acc);
+}
+
+#else
+
+typedef __m128i x86_vec_t;
+#define X86_VEC_BYTES           16
+#define X86_OP(op)              _mm_##op
+#define X86_LOAD(p)             _mm_loadu_si128((const __m128i *)(p))
+#define X86_STORE(p, v)         _mm_storeu_si128((__m128i *)(p), (v))
+#define X86_ZERO()              _mm_setzero_si128()
+#define X86_ONES()              _mm_set1_epi32(-1)
+#define X86_AND(a, b)           _mm_and_si128((a), (b))
+#define X86_OR(a, b)            _mm_or_si128((a), (b))
+#define X86_XOR(a, b)           _mm_xor_si128((a), (b))
+
+static inline x86_vec_t x86_load_widen_i8(const int8_t *p) {
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i *)p));
+}
+
+static inline void x86_store_narrow_i16(int8_t *p, x86_vec_t v) {
+    v = _mm_and_si128(v, _mm_set1_epi16(0x00FF));
+    _mm_storel_epi64((__m128i *)p, _mm_packus_epi16(v, v));
+}
+
+static inline void x86_store_sat_i16(int8_t *p, x86_vec_t v) {
+    _mm_storel_epi64((__m128i *)p, _mm_packs_epi16(v, v));
+}
+
+static inline int32_t x86_hsum_i32(x86_vec_t v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+    return _mm_cvtsi128_si32(v);
+}
+
+#endif
+
+#define X86_LANES(type)         (X86_VEC_BYTES / sizeof(type))
+
+// Shift counts for the sra/srl/sll family are passed in the low 64 bits of an xmm register
+static inline __m128i x86_shift_count(unsigned int shift_amount) {
+    return _mm_cvtsi32_si128((int)shift_amount);
+}
+
+/**
+ * Saturating int32_t add/sub. x86 has no saturating 32-bit instruction, so overflow is detected
+ * from the sign bits and replaced with INT32_MAX or INT32_MIN, as ee.vadds.s32/ee.vsubs.s32 produce.
+ */
+static inline x86_vec_t x86_adds_epi32(x86_vec_t a, x86_vec_t b) {
+    x86_vec_t sum = X86_OP(add_epi32)(a, b);
+    x86_vec_t overflow = X86_OP(srai_epi32)(X86_AND(X86_XOR(a, sum), X86_XOR(b, sum)), 31);
+    x86_vec_t sat = X86_XOR(X86_OP(srai_epi32)(a, 31), X86_OP(set1_epi32)(INT32_MAX));
+    return X86_OP(blendv_epi8)(sum, sat, overflow);
+}
+
+static inline x86_vec_t x86_subs_epi32(x86_vec_t a, x86_vec_t b) {
+    x86_vec_t diff = X86_OP(sub_epi32)(a, b);
+    x86_vec_t overflow = X86_OP(srai_epi32)(X86_AND(X86_XOR(a, b), X86_XOR(a, diff)), 31);
+    x86_vec_t sat = X86_XOR(X86_OP(srai_epi32)(a, 31), X86_OP(set1_epi32)(INT32_MAX));
+    return X86_OP(blendv_epi8)(diff, sat, overflow);
+}
+
+#endif
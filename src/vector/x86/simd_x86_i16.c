@@ -0,0 +1,193 @@
+#include "simd_functions.h"
+#include "simd_x86.h"
+
+/**
+ * x86 int16_t kernels. Each kernel runs X86_LANES(int16_t) elements per iteration and finishes
+ * the remainder with the same scalar code as the portable backend.
+ */
+
+int simd_add_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OP(adds_epi16)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));  // Saturating, as ee.vadds.s16
+    }
+    for (; i < size; i++) {
+        result[i] = sat_i16((int32_t)a[i] + (int32_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OP(subs_epi16)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = sat_i16((int32_t)a[i] - (int32_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_i16(const int16_t *a, const int16_t *b, int16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    const __m128i count_lo = x86_shift_count(shift_amount);
+    const __m128i count_hi = x86_shift_count(16 - shift_amount);                        // A count of 16 clears the lane
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        x86_vec_t va = X86_LOAD(&a[i]);
+        x86_vec_t vb = X86_LOAD(&b[i]);
+        x86_vec_t lo = X86_OP(mullo_epi16)(va, vb);                                     // Low and high halves of the 32-bit product
+        x86_vec_t hi = X86_OP(mulhi_epi16)(va, vb);
+        X86_STORE(&result[i], X86_OR(X86_OP(srl_epi16)(lo, count_lo), X86_OP(sll_epi16)(hi, count_hi)));
+    }
+    for (; i < size; i++) {
+        result[i] = (int16_t)(wrap_mul_i32(a[i], b[i]) >> shift_amount);                // Low half-word after the SAR shift, as ee.vmul.s16
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_i16(const int16_t *a, const int16_t *b, const int16_t *c, int16_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+    const __m128i count_lo = x86_shift_count(shift_amount);
+    const __m128i count_hi = x86_shift_count(16 - shift_amount);
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        x86_vec_t va = X86_LOAD(&a[i]);
+        x86_vec_t vb = X86_LOAD(&b[i]);
+        x86_vec_t prod = X86_OR(X86_OP(srl_epi16)(X86_OP(mullo_epi16)(va, vb), count_lo), X86_OP(sll_epi16)(X86_OP(mulhi_epi16)(va, vb), count_hi));
+        X86_STORE(&result[i], X86_OP(adds_epi16)(prod, X86_LOAD(&c[i])));
+    }
+    for (; i < size; i++) {
+        int16_t prod = (int16_t)(wrap_mul_i32(a[i], b[i]) >> shift_amount);
+        result[i] = sat_i16((int32_t)prod + (int32_t)c[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_i16(const int16_t *a, int32_t *result, const size_t size) {
+    const x86_vec_t ones = X86_OP(set1_epi16)(1);
+    x86_vec_t acc = X86_ZERO();
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        acc = X86_OP(add_epi32)(acc, X86_OP(madd_epi16)(X86_LOAD(&a[i]), ones));
+    }
+    int32_t sum = x86_hsum_i32(acc);
+    for (; i < size; i++) {
+        sum = wrap_add_i32(sum, a[i]);
+    }
+    *result = sum;
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_i16(const int16_t *a, const int16_t *b, int32_t *result, const size_t size) {
+    x86_vec_t acc = X86_ZERO();
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        acc = X86_OP(add_epi32)(acc, X86_OP(madd_epi16)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    int32_t sum = x86_hsum_i32(acc);                                                    // madd/add wrap modulo 2^32, as the low word of QACC
+    for (; i < size; i++) {
+        sum = wrap_add_i32(sum, (int32_t)a[i] * (int32_t)b[i]);
+    }
+    *result = sum;
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OP(max_epi16)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OP(min_epi16)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_eq_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OP(cmpeq_epi16)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] == b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OP(cmpgt_epi16)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] > b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OP(cmpgt_epi16)(X86_LOAD(&b[i]), X86_LOAD(&a[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] < b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_and_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_AND(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] & b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_or_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_OR(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] | b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xor_i16(const int16_t *a, const int16_t *b, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_XOR(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] ^ b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_not_i16(const int16_t *a, int16_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int16_t) <= size; i += X86_LANES(int16_t)) {
+        X86_STORE(&result[i], X86_XOR(X86_LOAD(&a[i]), X86_ONES()));
+    }
+    for (; i < size; i++) {
+        result[i] = ~a[i];
+    }
+    return VECTOR_SUCCESS;
+}
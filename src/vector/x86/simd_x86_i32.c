@@ -0,0 +1,206 @@
+#include "simd_functions.h"
+#include "simd_x86.h"
+
+/**
+ * x86 int32_t kernels. Each kernel runs X86_LANES(int32_t) elements per iteration and finishes
+ * the remainder with the same scalar code as the portable backend.
+ */
+
+int simd_add_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], x86_adds_epi32(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = sat_i32((int64_t)a[i] + (int64_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], x86_subs_epi32(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = sat_i32((int64_t)a[i] - (int64_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_i32(const int32_t *a, const int32_t *b, int32_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    const __m128i count = x86_shift_count(shift_amount);
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        x86_vec_t va = X86_LOAD(&a[i]);
+        x86_vec_t vb = X86_LOAD(&b[i]);
+        // 64-bit products of the even and odd lanes. Only the low word of (product >> shift) is
+        // kept, so a logical 64-bit shift gives the same bits as the arithmetic SAR funnel shift.
+        x86_vec_t even = X86_OP(srl_epi64)(X86_OP(mul_epi32)(va, vb), count);
+        x86_vec_t odd = X86_OP(srl_epi64)(X86_OP(mul_epi32)(X86_OP(srli_epi64)(va, 32), X86_OP(srli_epi64)(vb, 32)), count);
+        X86_STORE(&result[i], X86_OP(blend_epi16)(even, X86_OP(slli_epi64)(odd, 32), 0xCC));
+    }
+    for (; i < size; i++) {
+        result[i] = (int32_t)(((int64_t)a[i] * (int64_t)b[i]) >> shift_amount);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_i32(const int32_t *a, const int32_t *b, const int32_t *c, int32_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+    const __m128i count = x86_shift_count(shift_amount);
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        x86_vec_t va = X86_LOAD(&a[i]);
+        x86_vec_t vb = X86_LOAD(&b[i]);
+        x86_vec_t even = X86_OP(srl_epi64)(X86_OP(mul_epi32)(va, vb), count);           // As simd_mul_shift_i32
+        x86_vec_t odd = X86_OP(srl_epi64)(X86_OP(mul_epi32)(X86_OP(srli_epi64)(va, 32), X86_OP(srli_epi64)(vb, 32)), count);
+        x86_vec_t prod = X86_OP(blend_epi16)(even, X86_OP(slli_epi64)(odd, 32), 0xCC);
+        X86_STORE(&result[i], x86_adds_epi32(prod, X86_LOAD(&c[i])));
+    }
+    for (; i < size; i++) {
+        int32_t prod = (int32_t)(((int64_t)a[i] * (int64_t)b[i]) >> shift_amount);
+        result[i] = sat_i32((int64_t)prod + (int64_t)c[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+/**
+ * The PIE kernel accumulates full 4-element blocks into four saturating lanes of q0, so the
+ * accumulator stays 128 bits wide even with AVX2; wider blocks are folded in 4 lanes at a time.
+ */
+static inline __m128i adds_epi32_x4(__m128i a, __m128i b) {
+    __m128i sum = _mm_add_epi32(a, b);
+    __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(a, sum), _mm_xor_si128(b, sum)), 31);
+    __m128i sat = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(INT32_MAX));
+    return _mm_blendv_epi8(sum, sat, overflow);
+}
+
+int simd_sum_i32(const int32_t *a, int32_t *result, const size_t size) {
+    __m128i lanes = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        lanes = adds_epi32_x4(lanes, _mm_loadu_si128((const __m128i *)&a[i]));
+    }
+    int32_t acc = wrap_add_i32(wrap_add_i32(_mm_extract_epi32(lanes, 0), _mm_extract_epi32(lanes, 1)),
+                               wrap_add_i32(_mm_extract_epi32(lanes, 2), _mm_extract_epi32(lanes, 3)));
+    for (; i < size; i++) {                                                             // Tail accumulates without saturation
+        acc = wrap_add_i32(acc, a[i]);
+    }
+    *result = acc;
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    x86_vec_t acc = X86_ZERO();
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        acc = X86_OP(add_epi32)(acc, X86_OP(mullo_epi32)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));   // Low 32 bits, as mull
+    }
+    int32_t sum = x86_hsum_i32(acc);
+    for (; i < size; i++) {
+        sum = wrap_add_i32(sum, wrap_mul_i32(a[i], b[i]));
+    }
+    *result = sum;
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_OP(max_epi32)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_OP(min_epi32)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_eq_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_OP(cmpeq_epi32)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] == b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_OP(cmpgt_epi32)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] > b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_OP(cmpgt_epi32)(X86_LOAD(&b[i]), X86_LOAD(&a[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] < b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_and_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_AND(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] & b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_or_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_OR(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] | b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xor_i32(const int32_t *a, const int32_t *b, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_XOR(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] ^ b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_not_i32(const int32_t *a, int32_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int32_t) <= size; i += X86_LANES(int32_t)) {
+        X86_STORE(&result[i], X86_XOR(X86_LOAD(&a[i]), X86_ONES()));
+    }
+    for (; i < size; i++) {
+        result[i] = ~a[i];
+    }
+    return VECTOR_SUCCESS;
+}
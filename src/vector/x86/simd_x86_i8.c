@@ -0,0 +1,229 @@
+#include "simd_functions.h"
+#include "simd_x86.h"
+
+/**
+ * x86 int8_t kernels. Each kernel runs X86_LANES(int8_t) elements per iteration and finishes
+ * the remainder with the same scalar code as the portable backend.
+ */
+
+int simd_add_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OP(adds_epi8)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));  // Saturating, as ee.vadds.s8
+    }
+    for (; i < size; i++) {
+        result[i] = sat_i8((int32_t)a[i] + (int32_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sub_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OP(subs_epi8)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = sat_i8((int32_t)a[i] - (int32_t)b[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_mul_shift_i8(const int8_t *a, const int8_t *b, int8_t *result, const int shift_amount, const size_t size) {
+    if ((unsigned int)shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+    const __m128i count = x86_shift_count((unsigned int)shift_amount);
+    const size_t step = X86_LANES(int16_t);                                             // Products are formed in int16_t lanes
+    size_t i = 0;
+    for (; i + step <= size; i += step) {
+        x86_vec_t prod = X86_OP(mullo_epi16)(x86_load_widen_i8(&a[i]), x86_load_widen_i8(&b[i]));
+        x86_store_narrow_i16(&result[i], X86_OP(sra_epi16)(prod, count));               // Keeps the low byte, as ee.vmul.s8
+    }
+    for (; i < size; i++) {
+        result[i] = (int8_t)(((int32_t)a[i] * (int32_t)b[i]) >> shift_amount);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_fma_i8(const int8_t *a, const int8_t *b, const int8_t *c, int8_t *result, const unsigned int shift_amount, const size_t size) {
+    if (shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+    const __m128i count = x86_shift_count(shift_amount);
+    const size_t step = X86_LANES(int16_t);                                             // Products are formed in int16_t lanes
+    size_t i = 0;
+    for (; i + step <= size; i += step) {
+        x86_vec_t prod = X86_OP(sra_epi16)(X86_OP(mullo_epi16)(x86_load_widen_i8(&a[i]), x86_load_widen_i8(&b[i])), count);
+        prod = X86_OP(srai_epi16)(X86_OP(slli_epi16)(prod, 8), 8);                      // Low byte, sign-extended, as ee.vmul.s8
+        x86_store_sat_i16(&result[i], X86_OP(add_epi16)(prod, x86_load_widen_i8(&c[i])));
+    }
+    for (; i < size; i++) {
+        int8_t prod = (int8_t)(((int32_t)a[i] * (int32_t)b[i]) >> shift_amount);
+        result[i] = sat_i8((int32_t)prod + (int32_t)c[i]);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_sum_i8(const int8_t *a, int32_t *result, const size_t size) {
+    const x86_vec_t ones = X86_OP(set1_epi16)(1);
+    x86_vec_t acc = X86_ZERO();
+    const size_t step = X86_LANES(int16_t);
+    size_t i = 0;
+    for (; i + step <= size; i += step) {
+        acc = X86_OP(add_epi32)(acc, X86_OP(madd_epi16)(x86_load_widen_i8(&a[i]), ones));
+    }
+    int32_t sum = x86_hsum_i32(acc);
+    for (; i < size; i++) {
+        sum = wrap_add_i32(sum, a[i]);
+    }
+    *result = sum;
+    return VECTOR_SUCCESS;
+}
+
+int simd_dotp_i8(const int8_t *a, const int8_t *b, int32_t *result, const size_t size) {
+    x86_vec_t acc = X86_ZERO();
+    const size_t step = X86_LANES(int16_t);
+    size_t i = 0;
+    for (; i + step <= size; i += step) {
+        acc = X86_OP(add_epi32)(acc, X86_OP(madd_epi16)(x86_load_widen_i8(&a[i]), x86_load_widen_i8(&b[i])));
+    }
+    int32_t sum = x86_hsum_i32(acc);                                                    // Wraps in 32 bits, as the low word of QACC
+    for (; i < size; i++) {
+        sum = wrap_add_i32(sum, (int32_t)a[i] * (int32_t)b[i]);
+    }
+    *result = sum;
+    return VECTOR_SUCCESS;
+}
+
+// Four weight rows per pass; each widened block of x is loaded once and reused for all four
+int simd_gemv_i8(const int8_t *w, const int8_t *x, int32_t *result, const size_t rows, const size_t cols, const size_t stride) {
+    const size_t step = X86_LANES(int16_t);
+    size_t r = 0;
+    for (; r + 4 <= rows; r += 4) {
+        const int8_t *w0 = w + r * stride;
+        const int8_t *w1 = w0 + stride;
+        const int8_t *w2 = w1 + stride;
+        const int8_t *w3 = w2 + stride;
+        x86_vec_t acc0 = X86_ZERO(), acc1 = X86_ZERO(), acc2 = X86_ZERO(), acc3 = X86_ZERO();
+        size_t i = 0;
+        for (; i + step <= cols; i += step) {
+            x86_vec_t xv = x86_load_widen_i8(&x[i]);
+            acc0 = X86_OP(add_epi32)(acc0, X86_OP(madd_epi16)(x86_load_widen_i8(&w0[i]), xv));
+            acc1 = X86_OP(add_epi32)(acc1, X86_OP(madd_epi16)(x86_load_widen_i8(&w1[i]), xv));
+            acc2 = X86_OP(add_epi32)(acc2, X86_OP(madd_epi16)(x86_load_widen_i8(&w2[i]), xv));
+            acc3 = X86_OP(add_epi32)(acc3, X86_OP(madd_epi16)(x86_load_widen_i8(&w3[i]), xv));
+        }
+        int32_t sum0 = x86_hsum_i32(acc0), sum1 = x86_hsum_i32(acc1);
+        int32_t sum2 = x86_hsum_i32(acc2), sum3 = x86_hsum_i32(acc3);
+        for (; i < cols; i++) {
+            int32_t xi = x[i];
+            sum0 = wrap_add_i32(sum0, (int32_t)w0[i] * xi);
+            sum1 = wrap_add_i32(sum1, (int32_t)w1[i] * xi);
+            sum2 = wrap_add_i32(sum2, (int32_t)w2[i] * xi);
+            sum3 = wrap_add_i32(sum3, (int32_t)w3[i] * xi);
+        }
+        result[r] = sum0;
+        result[r + 1] = sum1;
+        result[r + 2] = sum2;
+        result[r + 3] = sum3;
+    }
+    for (; r < rows; r++) {
+        simd_dotp_i8(w + r * stride, x, &result[r], cols);
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_max_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OP(max_epi8)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] > b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_min_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OP(min_epi8)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] < b[i] ? a[i] : b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_eq_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OP(cmpeq_epi8)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] == b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_gt_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OP(cmpgt_epi8)(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] > b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_compare_lt_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OP(cmpgt_epi8)(X86_LOAD(&b[i]), X86_LOAD(&a[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] < b[i] ? -1 : 0;
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_and_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_AND(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] & b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_or_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_OR(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] | b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_xor_i8(const int8_t *a, const int8_t *b, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_XOR(X86_LOAD(&a[i]), X86_LOAD(&b[i])));
+    }
+    for (; i < size; i++) {
+        result[i] = a[i] ^ b[i];
+    }
+    return VECTOR_SUCCESS;
+}
+
+int simd_not_i8(const int8_t *a, int8_t *result, const size_t size) {
+    size_t i = 0;
+    for (; i + X86_LANES(int8_t) <= size; i += X86_LANES(int8_t)) {
+        X86_STORE(&result[i], X86_XOR(X86_LOAD(&a[i]), X86_ONES()));
+    }
+    for (; i < size; i++) {
+        result[i] = ~a[i];
+    }
+    return VECTOR_SUCCESS;
+}
@@ -0,0 +1,192 @@
+#include "matrix.h"
+#include "matrix_functions.h"
+#include "scalar_matrix_functions.h"
+#include "vector_test_helper.h"
+#include "matrix_test.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_DIM 48
+#define MAX_INNER 300                                                   // Exceeds one K block of the blocked GEMM
+
+static dtype accumulator_type(dtype type){
+    return type == DTYPE_FLOAT32 ? DTYPE_FLOAT32 : DTYPE_INT32;
+}
+
+static void fill_test_matrix(matrix_t *mat){
+    for (size_t i = 0; i < mat->rows; i++){
+        vector_t row;
+        assert(matrix_row(mat, i, &row) == VECTOR_SUCCESS);
+        fill_test_vector(&row);
+    }
+}
+
+static bool matrix_assert_eq(const matrix_t *mat1, const matrix_t *mat2){
+    if (mat1->rows != mat2->rows) { ESP_LOGE("matrix_assert_eq", "row mismatch"); return false;}
+    for (size_t i = 0; i < mat1->rows; i++){
+        vector_t row1, row2;
+        matrix_row(mat1, i, &row1);
+        matrix_row(mat2, i, &row2);
+        if (!vector_assert_eq(&row1, &row2)) { return false;}
+    }
+    return true;
+}
+
+// Transposed copy of src, as the [out][in] layout mat_mul_bt() expects
+static matrix_t *transpose_test_matrix(const matrix_t *src){
+    matrix_t *dst = matrix_create(src->cols, src->rows, src->type);
+    assert(dst);
+    size_t elem = sizeof_dtype(src->type);
+    for (size_t i = 0; i < src->rows; i++){
+        for (size_t j = 0; j < src->cols; j++){
+            memcpy((uint8_t*)dst->data + (j * dst->stride + i) * elem, (uint8_t*)src->data + (i * src->stride + j) * elem, elem);
+        }
+    }
+    return dst;
+}
+
+static void matrix_test_gemm(bool verbose, dtype type, bool transposed){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t mat_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+
+    for (int run_num = 0; run_num < TEST_RUNS / 4; run_num++){
+        size_t m = 1 + rand() % MAX_DIM;                                // Random matrix shapes
+        size_t k = 1 + rand() % MAX_INNER;
+        size_t n = 1 + rand() % MAX_DIM;
+        matrix_t *a = matrix_create(m, k, type);                        // Allocating the test matrices
+        matrix_t *b = matrix_create(k, n, type);
+        matrix_t *mat_result = matrix_create(m, n, accumulator_type(type));
+        matrix_t *scalar_result = matrix_create(m, n, accumulator_type(type));
+
+        assert(a);                                                      // Check if valid
+        assert(b);
+        assert(mat_result);
+        assert(scalar_result);
+        assert(matrix_ok(a) == VECTOR_SUCCESS);
+        assert(matrix_ok(mat_result) == VECTOR_SUCCESS);
+
+        fill_test_matrix(a);                                            // Fill with random values in range
+        fill_test_matrix(b);
+        matrix_t *bt = transpose_test_matrix(b);
+
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_mat_mul(a, b, scalar_result) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        if (transposed){
+            assert(mat_mul_bt(a, bt, mat_result) == VECTOR_SUCCESS);
+        } else {
+            assert(mat_mul(a, b, mat_result) == VECTOR_SUCCESS);
+        }
+        timer_end(&mat_time);
+
+        matrix_assert_eq(mat_result, scalar_result);                    // Check results
+
+        matrix_t wrong_shape = *mat_result;                             // Argument checks
+        wrong_shape.rows = m + 1;
+        assert(mat_mul(a, b, &wrong_shape) == VECTOR_SIZE_MISMATCH);
+        if (type != DTYPE_FLOAT32){
+            matrix_t wrong_type = *mat_result;
+            wrong_type.type = type;
+            assert(mat_mul(a, b, &wrong_type) == VECTOR_TYPE_MISMATCH);
+        }
+
+        matrix_destroy(a);                                              // Free resources
+        matrix_destroy(b);
+        matrix_destroy(bt);
+        matrix_destroy(mat_result);
+        matrix_destroy(scalar_result);
+    }
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI(transposed ? "matrix_test_mul_bt" : "matrix_test_mul", "matrix_time: %d", (int)mat_time);
+            ESP_LOGI(transposed ? "matrix_test_mul_bt" : "matrix_test_mul", "scalar_time: %d", (int)scalar_time);
+    }
+}
+
+void matrix_test_mul(bool verbose, dtype type){
+    matrix_test_gemm(verbose, type, false);
+}
+
+void matrix_test_mul_bt(bool verbose, dtype type){
+    matrix_test_gemm(verbose, type, true);
+}
+
+/**
+ * vec_gemv_requant() into a @p type result against the scalar reference, with and without bias.
+ * INT32 results also exercise vec_gemv(), which must match the unbiased, unshifted case.
+ */
+void matrix_test_gemv(bool verbose, dtype type){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t gemv_time = 0;                                             // Runtime logs
+    uint32_t scalar_time = 0;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        size_t n = 1 + rand() % MAX_DIM;                                // Random layer shapes
+        size_t k = 1 + rand() % MAX_INNER;
+        unsigned int shift_amount = (type == DTYPE_INT32) ? rand() % 32 : 4 + rand() % 12;
+        matrix_t *weights = matrix_create(n, k, DTYPE_INT8);            // Allocating the test operands
+        vector_t *input = create_test_vector(k, DTYPE_INT8);
+        vector_t *bias = create_test_vector(n, DTYPE_INT32);
+        vector_t *gemv_result = create_test_vector(n, type);
+        vector_t *scalar_result = create_test_vector(n, type);
+
+        assert(weights);                                                // Check if valid
+        assert(input);
+        assert(bias);
+        assert(gemv_result);
+        assert(scalar_result);
+
+        fill_test_matrix(weights);                                      // Fill with random values in range
+        fill_test_vector(input);
+        fill_test_vector(bias);
+
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_gemv_requant(weights, input, bias, scalar_result, shift_amount) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_gemv_requant(weights, input, bias, gemv_result, shift_amount) == VECTOR_SUCCESS);
+        timer_end(&gemv_time);
+
+        vector_assert_eq(gemv_result, scalar_result);                   // Check results
+        vector_check_canary(gemv_result);                               // Check modification of canary region
+
+        assert(scalar_gemv_requant(weights, input, NULL, scalar_result, shift_amount) == VECTOR_SUCCESS);
+        assert(vec_gemv_requant(weights, input, NULL, gemv_result, shift_amount) == VECTOR_SUCCESS);
+        vector_assert_eq(gemv_result, scalar_result);
+
+        if (type == DTYPE_INT32){
+            assert(scalar_gemv_requant(weights, input, NULL, scalar_result, 0) == VECTOR_SUCCESS);
+            assert(vec_gemv(weights, input, gemv_result) == VECTOR_SUCCESS);
+            vector_assert_eq(gemv_result, scalar_result);
+            vector_check_canary(gemv_result);
+        } else {
+            assert(vec_gemv(weights, input, gemv_result) == VECTOR_TYPE_MISMATCH);
+        }
+
+        vector_t wrong_size = *input;                                   // Argument checks
+        wrong_size.size = k + 1;
+        assert(vec_gemv_requant(weights, &wrong_size, bias, gemv_result, shift_amount) == VECTOR_SIZE_MISMATCH);
+        assert(vec_gemv_requant(weights, input, bias, gemv_result, 32) == VECTOR_INVALID_ARGUMENT);
+        assert(vec_gemv_requant(weights, input, input, gemv_result, shift_amount) != VECTOR_SUCCESS);
+
+        matrix_destroy(weights);                                        // Free resources
+        vector_destroy(input);
+        vector_destroy(bias);
+        vector_destroy(gemv_result);
+        vector_destroy(scalar_result);
+    }
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("matrix_test_gemv", "gemv_time: %d", (int)gemv_time);
+            ESP_LOGI("matrix_test_gemv", "scalar_time: %d", (int)scalar_time);
+    }
+}
@@ -0,0 +1,5 @@
+#include "matrix.h"
+
+void matrix_test_mul(bool verbose, dtype type);
+void matrix_test_mul_bt(bool verbose, dtype type);
+void matrix_test_gemv(bool verbose, dtype type);
@@ -2,6 +2,7 @@
 #define SCALAR_BASIC_FUNCTIONS_H
 
 #include "vector.h" 
+#include <math.h>
 #include <string.h>
 
 
@@ -45,6 +46,42 @@ vector_status_t scalar_add(const vector_t *vec1, const vector_t *vec2, vector_t
             }
             return VECTOR_SUCCESS;
         }
+        case DTYPE_UINT8: {
+            uint8_t* vec1_data = (uint8_t*)(vec1->data);
+            uint8_t* vec2_data = (uint8_t*)(vec2->data); 
+            uint8_t* result_data = (uint8_t*)(result->data); 
+            for (int i = 0; i < vec1->size; i++){
+                int64_t intermediate = (int64_t)vec1_data[i] + (int64_t)vec2_data[i];
+                intermediate = intermediate > UINT8_MAX ? UINT8_MAX : intermediate; 
+                intermediate = intermediate < 0 ? 0 : intermediate; 
+                result_data[i] = (uint8_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT16: {
+            uint16_t* vec1_data = (uint16_t*)(vec1->data);
+            uint16_t* vec2_data = (uint16_t*)(vec2->data); 
+            uint16_t* result_data = (uint16_t*)(result->data); 
+            for (int i = 0; i < vec1->size; i++){
+                int64_t intermediate = (int64_t)vec1_data[i] + (int64_t)vec2_data[i];
+                intermediate = intermediate > UINT16_MAX ? UINT16_MAX : intermediate; 
+                intermediate = intermediate < 0 ? 0 : intermediate; 
+                result_data[i] = (uint16_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT32: {
+            uint32_t* vec1_data = (uint32_t*)(vec1->data);
+            uint32_t* vec2_data = (uint32_t*)(vec2->data); 
+            uint32_t* result_data = (uint32_t*)(result->data); 
+            for (int i = 0; i < vec1->size; i++){
+                int64_t intermediate = (int64_t)vec1_data[i] + (int64_t)vec2_data[i];
+                intermediate = intermediate > UINT32_MAX ? UINT32_MAX : intermediate; 
+                intermediate = intermediate < 0 ? 0 : intermediate; 
+                result_data[i] = (uint32_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
         case DTYPE_FLOAT32: {
             float* vec1_data = (float*)(vec1->data);
             float* vec2_data = (float*)(vec2->data); 
@@ -100,6 +137,42 @@ vector_status_t scalar_sub(const vector_t *vec1, const vector_t *vec2, vector_t
             }
             return VECTOR_SUCCESS;
         }
+        case DTYPE_UINT8: {
+            uint8_t* vec1_data = (uint8_t*)(vec1->data);
+            uint8_t* vec2_data = (uint8_t*)(vec2->data); 
+            uint8_t* result_data = (uint8_t*)(result->data); 
+            for (int i = 0; i < vec1->size; i++){
+                int64_t intermediate = (int64_t)vec1_data[i] - (int64_t)vec2_data[i];
+                intermediate = intermediate > UINT8_MAX ? UINT8_MAX : intermediate; 
+                intermediate = intermediate < 0 ? 0 : intermediate; 
+                result_data[i] = (uint8_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT16: {
+            uint16_t* vec1_data = (uint16_t*)(vec1->data);
+            uint16_t* vec2_data = (uint16_t*)(vec2->data); 
+            uint16_t* result_data = (uint16_t*)(result->data); 
+            for (int i = 0; i < vec1->size; i++){
+                int64_t intermediate = (int64_t)vec1_data[i] - (int64_t)vec2_data[i];
+                intermediate = intermediate > UINT16_MAX ? UINT16_MAX : intermediate; 
+                intermediate = intermediate < 0 ? 0 : intermediate; 
+                result_data[i] = (uint16_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT32: {
+            uint32_t* vec1_data = (uint32_t*)(vec1->data);
+            uint32_t* vec2_data = (uint32_t*)(vec2->data); 
+            uint32_t* result_data = (uint32_t*)(result->data); 
+            for (int i = 0; i < vec1->size; i++){
+                int64_t intermediate = (int64_t)vec1_data[i] - (int64_t)vec2_data[i];
+                intermediate = intermediate > UINT32_MAX ? UINT32_MAX : intermediate; 
+                intermediate = intermediate < 0 ? 0 : intermediate; 
+                result_data[i] = (uint32_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
         case DTYPE_FLOAT32: {
             float* vec1_data = (float*)(vec1->data);
             float* vec2_data = (float*)(vec2->data); 
@@ -226,6 +299,42 @@ vector_status_t scalar_mul(const vector_t *vec1, const vector_t *vec2, vector_t
             }  
             return VECTOR_SUCCESS;
         }
+        case DTYPE_UINT8: { 
+            if (shift_amount > 7) { return VECTOR_INVALID_ARGUMENT;}
+            uint8_t* vec1_data = (uint8_t*)(vec1->data);
+            uint8_t* vec2_data = (uint8_t*)(vec2->data);
+            uint8_t* result_data = (uint8_t*)(result->data);
+            for (int i = 0; i < vec1->size; i++){
+                uint64_t intermediate = (uint64_t)vec1_data[i] * (uint64_t)vec2_data[i];
+                intermediate = intermediate >> shift_amount;
+                result_data[i] = (uint8_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT16: { 
+            if (shift_amount > 15) { return VECTOR_INVALID_ARGUMENT;}
+            uint16_t* vec1_data = (uint16_t*)(vec1->data);
+            uint16_t* vec2_data = (uint16_t*)(vec2->data);
+            uint16_t* result_data = (uint16_t*)(result->data);
+            for (int i = 0; i < vec1->size; i++){
+                uint64_t intermediate = (uint64_t)vec1_data[i] * (uint64_t)vec2_data[i];
+                intermediate = intermediate >> shift_amount;
+                result_data[i] = (uint16_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT32: { 
+            if (shift_amount > 31) { return VECTOR_INVALID_ARGUMENT;}
+            uint32_t* vec1_data = (uint32_t*)(vec1->data);
+            uint32_t* vec2_data = (uint32_t*)(vec2->data);
+            uint32_t* result_data = (uint32_t*)(result->data);
+            for (int i = 0; i < vec1->size; i++){
+                uint64_t intermediate = (uint64_t)vec1_data[i] * (uint64_t)vec2_data[i];
+                intermediate = intermediate >> shift_amount;
+                result_data[i] = (uint32_t)intermediate;
+            }
+            return VECTOR_SUCCESS;
+        }
         case DTYPE_FLOAT32: { 
             float* vec1_data = (float*)(vec1->data);
             float* vec2_data = (float*)(vec2->data);
@@ -242,6 +351,46 @@ vector_status_t scalar_mul(const vector_t *vec1, const vector_t *vec2, vector_t
     }  
 }
 
+// Two-pass reference: the product is rounded to the element type before the addition
+vector_status_t scalar_fma(const vector_t *vec1, const vector_t *vec2, const vector_t *vec3, vector_t *result, const unsigned int shift_amount) { 
+    if (vec1->size != vec3->size){ return VECTOR_SIZE_MISMATCH;}  
+    if (vec1->type != vec3->type){ return VECTOR_TYPE_MISMATCH;}  
+    vector_status_t status = scalar_mul(vec1, vec2, result, shift_amount);
+    if (status != VECTOR_SUCCESS){ return status;}
+    return scalar_add(result, vec3, result);
+}
+
+static inline vector_status_t scalar_load_i64(const vector_t *vec1, int i, int64_t *val) {
+    switch (vec1->type){
+        case DTYPE_INT8:  *val = ((int8_t*)vec1->data)[i];  return VECTOR_SUCCESS;
+        case DTYPE_INT16: *val = ((int16_t*)vec1->data)[i]; return VECTOR_SUCCESS;
+        case DTYPE_INT32: *val = ((int32_t*)vec1->data)[i]; return VECTOR_SUCCESS;
+        default: return VECTOR_UNSUPPORTED_OPERATION;
+    }
+}
+
+vector_status_t scalar_sum_i64(const vector_t *vec1, int64_t* result) {
+    int64_t output = 0;
+    for (int i = 0; i < vec1->size; i++){
+        int64_t val;
+        if (scalar_load_i64(vec1, i, &val) != VECTOR_SUCCESS) { return VECTOR_UNSUPPORTED_OPERATION;}
+        output += val;
+    }
+    *result = output;
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t scalar_mac_i64(const vector_t *vec1, int64_t* accumulator, const int multiplier) {
+    uint64_t output = (uint64_t)*accumulator;                           // Wraps modulo 2^64 like vec_mac_i64, never UB
+    for (int i = 0; i < vec1->size; i++){
+        int64_t val;
+        if (scalar_load_i64(vec1, i, &val) != VECTOR_SUCCESS) { return VECTOR_UNSUPPORTED_OPERATION;}
+        output += (uint64_t)(val * multiplier);
+    }
+    *accumulator = (int64_t)output;
+    return VECTOR_SUCCESS;
+}
+
 vector_status_t scalar_sum(const vector_t *vec1, int32_t* result) {  
     int32_t output = 0;
     switch (vec1->type) {
@@ -319,6 +468,38 @@ vector_status_t scalar_sum_f32(const vector_t *vec1, float* result) {
     }   
 }
 
+vector_status_t scalar_sum_unsigned(const vector_t *vec1, uint32_t* result) {  
+    uint32_t output = 0;
+    switch (vec1->type) {
+        case DTYPE_UINT8: {
+            uint8_t* vec1_data = (uint8_t*)(vec1->data); 
+            for (int i = 0; i < vec1->size; i++){ 
+                output += vec1_data[i];
+            }
+            *result = output;
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT16: {
+            uint16_t* vec1_data = (uint16_t*)(vec1->data); 
+            for (int i = 0; i < vec1->size; i++){ 
+                output += vec1_data[i];
+            }
+            *result = output;
+            return VECTOR_SUCCESS;
+        }
+        case DTYPE_UINT32: {
+            uint32_t* vec1_data = (uint32_t*)(vec1->data); 
+            for (int i = 0; i < vec1->size; i++){ 
+                output += vec1_data[i];
+            }
+            *result = output;
+            return VECTOR_SUCCESS;
+        }
+        default:
+            return VECTOR_UNSUPPORTED_OPERATION; 
+    }  
+}
+
 vector_status_t scalar_mul_scalar(const vector_t *vec1, const int val, vector_t *result, const unsigned int shift_amount) {
     if (vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}  
     if (vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}  
@@ -439,6 +620,20 @@ vector_status_t scalar_dotp(const vector_t *vec1, const vector_t *vec2, int32_t*
     }
 }
 
+vector_status_t scalar_dotp_i64(const vector_t *vec1, const vector_t *vec2, int64_t* result) {
+    if (vec1->size != vec2->size){ return VECTOR_SIZE_MISMATCH;} 
+    if (vec1->type != vec2->type){ return VECTOR_TYPE_MISMATCH;}
+    uint64_t output = 0;                                                // Wraps modulo 2^64 like the kernels, never UB
+    for (int i = 0; i < vec1->size; i++){
+        int64_t a, b;
+        if (scalar_load_i64(vec1, i, &a) != VECTOR_SUCCESS) { return VECTOR_UNSUPPORTED_OPERATION;}
+        scalar_load_i64(vec2, i, &b);
+        output += (uint64_t)(a * b);
+    }
+    *result = (int64_t)output;
+    return VECTOR_SUCCESS;
+}
+
 vector_status_t scalar_dotp_f32(const vector_t *vec1, const vector_t *vec2, float* result) {
     if (vec1->size != vec2->size ) { return VECTOR_SIZE_MISMATCH;}  
     if (vec1->type != vec2->type) { return VECTOR_TYPE_MISMATCH;}   
@@ -917,7 +1112,7 @@ vector_status_t scalar_convert(const vector_t *vec1, vector_t *result){
                 case DTYPE_INT8: {
                     int8_t* result_data = (int8_t*)(result->data); 
                     for (int i = 0; i < vec1->size; i++){ 
-                        result_data[i] = (int8_t)vec1_data[i];
+                        result_data[i] = (int8_t)(vec1_data[i] > INT8_MAX ? INT8_MAX : (vec1_data[i] < INT8_MIN ? INT8_MIN : vec1_data[i]));
                     }
                     return VECTOR_SUCCESS;
                 }
@@ -945,14 +1140,14 @@ vector_status_t scalar_convert(const vector_t *vec1, vector_t *result){
                 case DTYPE_INT8: {
                     int8_t* result_data = (int8_t*)(result->data);
                     for (int i = 0; i < vec1->size; i++){ 
-                        result_data[i] = (int8_t)vec1_data[i];
+                        result_data[i] = (int8_t)(vec1_data[i] > INT8_MAX ? INT8_MAX : (vec1_data[i] < INT8_MIN ? INT8_MIN : vec1_data[i]));
                     }
                     return VECTOR_SUCCESS;
                 }
                 case DTYPE_INT16: {
                     int16_t* result_data = (int16_t*)(result->data); 
                     for (int i = 0; i < vec1->size; i++){ 
-                        result_data[i] = (int16_t)vec1_data[i];
+                        result_data[i] = (int16_t)(vec1_data[i] > INT16_MAX ? INT16_MAX : (vec1_data[i] < INT16_MIN ? INT16_MIN : vec1_data[i]));
                     }
                     return VECTOR_SUCCESS;
                 }
@@ -973,14 +1168,16 @@ vector_status_t scalar_convert(const vector_t *vec1, vector_t *result){
                 case DTYPE_INT8: {
                     int8_t* result_data = (int8_t*)(result->data); 
                     for (int i = 0; i < vec1->size; i++){ 
-                        result_data[i] = (int8_t)vec1_data[i];
+                        float val = nearbyintf(vec1_data[i]);
+                        result_data[i] = (int8_t)(!(val >= INT8_MIN) ? INT8_MIN : (val > INT8_MAX ? INT8_MAX : val));
                     }
                     return VECTOR_SUCCESS;
                 }
                 case DTYPE_INT16: {
                     int16_t* result_data = (int16_t*)(result->data); 
                     for (int i = 0; i < vec1->size; i++){ 
-                        result_data[i] = (int16_t)vec1_data[i];
+                        float val = nearbyintf(vec1_data[i]);
+                        result_data[i] = (int16_t)(!(val >= INT16_MIN) ? INT16_MIN : (val > INT16_MAX ? INT16_MAX : val));
                     }
                     return VECTOR_SUCCESS;
                 }
@@ -999,4 +1196,59 @@ vector_status_t scalar_convert(const vector_t *vec1, vector_t *result){
             return VECTOR_ERROR;  
     }
 }       
-#endif
\ No newline at end of file
+
+// Narrowing with a rounding right shift: (x + 2^(shift - 1)) >> shift, computed wide, then saturated
+vector_status_t scalar_convert_shift(const vector_t *vec1, vector_t *result, const unsigned int shift_amount){
+    if (vec1->size != result->size) { return VECTOR_SIZE_MISMATCH;}
+    if (vec1->type != DTYPE_INT16 && vec1->type != DTYPE_INT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (result->type != DTYPE_INT8 && result->type != DTYPE_INT16) { return VECTOR_UNSUPPORTED_OPERATION;}
+    const int64_t hi = (result->type == DTYPE_INT8) ? INT8_MAX : INT16_MAX;
+    const int64_t lo = (result->type == DTYPE_INT8) ? INT8_MIN : INT16_MIN;
+    for (int i = 0; i < vec1->size; i++){
+        int64_t val = (vec1->type == DTYPE_INT16) ? ((int16_t*)(vec1->data))[i] : ((int32_t*)(vec1->data))[i];
+        if (shift_amount){
+            val = (val + ((int64_t)1 << (shift_amount - 1))) >> shift_amount;
+        }
+        val = val > hi ? hi : (val < lo ? lo : val);
+        if (result->type == DTYPE_INT8){
+            ((int8_t*)(result->data))[i] = (int8_t)val;
+        } else {
+            ((int16_t*)(result->data))[i] = (int16_t)val;
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+// Affine quantization: round(x * (1 / scale) + zero_point) to nearest even in one fused step, then saturated; NaN -> min
+vector_status_t scalar_quantize(const vector_t *vec1, vector_t *result, const float scale, const int zero_point){
+    if (vec1->size != result->size) { return VECTOR_SIZE_MISMATCH;}
+    if (vec1->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (result->type != DTYPE_INT8 && result->type != DTYPE_INT16) { return VECTOR_UNSUPPORTED_OPERATION;}
+    const float hi = (result->type == DTYPE_INT8) ? INT8_MAX : INT16_MAX;
+    const float lo = (result->type == DTYPE_INT8) ? INT8_MIN : INT16_MIN;
+    const float inv_scale = 1.0f / scale;
+    float* vec1_data = (float*)(vec1->data);
+    for (int i = 0; i < vec1->size; i++){
+        float val = fmaf(vec1_data[i], inv_scale, (float)zero_point);
+        val = !(val >= lo) ? lo : (val > hi ? hi : val);
+        if (result->type == DTYPE_INT8){
+            ((int8_t*)(result->data))[i] = (int8_t)nearbyintf(val);
+        } else {
+            ((int16_t*)(result->data))[i] = (int16_t)nearbyintf(val);
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+vector_status_t scalar_dequantize(const vector_t *vec1, vector_t *result, const float scale, const int zero_point){
+    if (vec1->size != result->size) { return VECTOR_SIZE_MISMATCH;}
+    if (result->type != DTYPE_FLOAT32) { return VECTOR_UNSUPPORTED_OPERATION;}
+    if (vec1->type != DTYPE_INT8 && vec1->type != DTYPE_INT16) { return VECTOR_UNSUPPORTED_OPERATION;}
+    float* result_data = (float*)(result->data);
+    for (int i = 0; i < vec1->size; i++){
+        int32_t val = (vec1->type == DTYPE_INT8) ? ((int8_t*)(vec1->data))[i] : ((int16_t*)(vec1->data))[i];
+        result_data[i] = (float)(val - zero_point) * scale;
+    }
+    return VECTOR_SUCCESS;
+}
+#endif
@@ -0,0 +1,69 @@
+#ifndef SCALAR_COMPARE_FUNCTIONS_H
+#define SCALAR_COMPARE_FUNCTIONS_H
+
+#include "vector.h" 
+#include <math.h>
+#include <string.h>
+
+// Element-wise loop over one integer type; expr sees the inputs as a[i], b[i] and yields the result element
+#define SCALAR_COMPARE_CASE(DT, T, expr)                                                \
+        case DT: {                                                                      \
+            const T* a = (const T*)(vec1->data);                                        \
+            const T* b = (const T*)(vec2->data);                                        \
+            T* result_data = (T*)(result->data);                                        \
+            for (int i = 0; i < vec1->size; i++){                                       \
+                result_data[i] = (T)(expr);                                             \
+            }                                                                           \
+            return VECTOR_SUCCESS;                                                      \
+        }
+
+// FLOAT32 results go through memcpy so mask bit patterns, which are NaNs, are stored unchanged
+#define SCALAR_COMPARE_CASE_F32(f32_expr)                                               \
+        case DTYPE_FLOAT32: {                                                           \
+            const float* a = (const float*)(vec1->data);                                \
+            const float* b = (const float*)(vec2->data);                                \
+            float* result_data = (float*)(result->data);                                \
+            for (int i = 0; i < vec1->size; i++){                                       \
+                const float value = (f32_expr);                                         \
+                memcpy(&result_data[i], &value, sizeof(value));                         \
+            }                                                                           \
+            return VECTOR_SUCCESS;                                                      \
+        }
+
+#define SCALAR_COMPARE_FUNCTION(name, expr, f32_expr)                                   \
+vector_status_t name(const vector_t *vec1, const vector_t *vec2, vector_t *result) {    \
+    if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;} \
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;} \
+    switch (vec1->type) {                                                               \
+        SCALAR_COMPARE_CASE(DTYPE_INT8, int8_t, expr)                                   \
+        SCALAR_COMPARE_CASE(DTYPE_INT16, int16_t, expr)                                 \
+        SCALAR_COMPARE_CASE(DTYPE_INT32, int32_t, expr)                                 \
+        SCALAR_COMPARE_CASE(DTYPE_UINT8, uint8_t, expr)                                 \
+        SCALAR_COMPARE_CASE(DTYPE_UINT16, uint16_t, expr)                               \
+        SCALAR_COMPARE_CASE(DTYPE_UINT32, uint32_t, expr)                               \
+        SCALAR_COMPARE_CASE_F32(f32_expr)                                               \
+        default:                                                                        \
+            return VECTOR_UNSUPPORTED_OPERATION;                                        \
+    }                                                                                   \
+}
+
+static inline float scalar_mask_f32(bool condition){
+    const uint32_t bits = condition ? 0xFFFFFFFFu : 0u;
+    float mask;
+    memcpy(&mask, &bits, sizeof(mask));
+    return mask;
+}
+
+// Comparison masks are all ones (-1 for signed types, the bit pattern 0xFFFFFFFF for FLOAT32) where the
+// condition holds, 0 elsewhere. FLOAT32 follows IEEE 754: NaN compares unordered, so only ne holds, and
+// max / min return NaN if either operand is NaN.
+SCALAR_COMPARE_FUNCTION(scalar_max, a[i] > b[i] ? a[i] : b[i], (isnan(a[i]) || isnan(b[i])) ? NAN : (a[i] < b[i] ? b[i] : a[i]))
+SCALAR_COMPARE_FUNCTION(scalar_min, a[i] < b[i] ? a[i] : b[i], (isnan(a[i]) || isnan(b[i])) ? NAN : (b[i] < a[i] ? b[i] : a[i]))
+SCALAR_COMPARE_FUNCTION(scalar_gt, a[i] > b[i] ? -1 : 0, scalar_mask_f32(a[i] > b[i]))
+SCALAR_COMPARE_FUNCTION(scalar_lt, a[i] < b[i] ? -1 : 0, scalar_mask_f32(a[i] < b[i]))
+SCALAR_COMPARE_FUNCTION(scalar_eq, a[i] == b[i] ? -1 : 0, scalar_mask_f32(a[i] == b[i]))
+SCALAR_COMPARE_FUNCTION(scalar_ge, a[i] >= b[i] ? -1 : 0, scalar_mask_f32(a[i] >= b[i]))
+SCALAR_COMPARE_FUNCTION(scalar_le, a[i] <= b[i] ? -1 : 0, scalar_mask_f32(a[i] <= b[i]))
+SCALAR_COMPARE_FUNCTION(scalar_ne, a[i] != b[i] ? -1 : 0, scalar_mask_f32(a[i] != b[i]))
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef SCALAR_MATRIX_FUNCTIONS_H
+#define SCALAR_MATRIX_FUNCTIONS_H
+
+#include "matrix.h"
+
+static inline const void *scalar_mat_at(const matrix_t *mat, size_t row, size_t col){
+    return (const uint8_t*)mat->data + (row * mat->stride + col) * sizeof_dtype(mat->type);
+}
+
+// Naive triple loop; integer products accumulate with 32-bit wrap-around, as the SIMD dot products do
+vector_status_t scalar_mat_mul(const matrix_t *a, const matrix_t *b, matrix_t *result){
+    if (a->cols != b->rows) { return VECTOR_SIZE_MISMATCH;}
+    if (result->rows != a->rows || result->cols != b->cols) { return VECTOR_SIZE_MISMATCH;}
+    for (size_t i = 0; i < a->rows; i++){
+        for (size_t j = 0; j < b->cols; j++){
+            switch (a->type){
+                case DTYPE_INT8: {
+                    uint32_t acc = 0;
+                    for (size_t k = 0; k < a->cols; k++){
+                        acc += (uint32_t)(*(const int8_t*)scalar_mat_at(a, i, k) * *(const int8_t*)scalar_mat_at(b, k, j));
+                    }
+                    *(int32_t*)scalar_mat_at(result, i, j) = (int32_t)acc;
+                    break;
+                }
+                case DTYPE_INT16: {
+                    uint32_t acc = 0;
+                    for (size_t k = 0; k < a->cols; k++){
+                        acc += (uint32_t)(*(const int16_t*)scalar_mat_at(a, i, k) * *(const int16_t*)scalar_mat_at(b, k, j));
+                    }
+                    *(int32_t*)scalar_mat_at(result, i, j) = (int32_t)acc;
+                    break;
+                }
+                case DTYPE_FLOAT32: {
+                    float acc = 0.0f;
+                    for (size_t k = 0; k < a->cols; k++){
+                        acc += *(const float*)scalar_mat_at(a, i, k) * *(const float*)scalar_mat_at(b, k, j);
+                    }
+                    *(float*)scalar_mat_at(result, i, j) = acc;
+                    break;
+                }
+                default:
+                    return VECTOR_UNSUPPORTED_OPERATION;
+            }
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+// One dot product per row with 32-bit wrap, then bias in 64 bits, arithmetic shift and saturation to the result dtype
+vector_status_t scalar_gemv_requant(const matrix_t *weights, const vector_t *input, const vector_t *bias, vector_t *result, unsigned int shift_amount){
+    if (input->size != weights->cols || result->size != weights->rows) { return VECTOR_SIZE_MISMATCH;}
+    for (size_t r = 0; r < weights->rows; r++){
+        uint32_t acc = 0;
+        for (size_t k = 0; k < weights->cols; k++){
+            acc += (uint32_t)(*(const int8_t*)scalar_mat_at(weights, r, k) * ((const int8_t*)input->data)[k]);
+        }
+        int64_t value = (int64_t)(int32_t)acc + (bias ? ((const int32_t*)bias->data)[r] : 0);
+        value >>= shift_amount;
+        switch (result->type){
+            case DTYPE_INT8:    ((int8_t*)result->data)[r] = (int8_t)(value < INT8_MIN ? INT8_MIN : (value > INT8_MAX ? INT8_MAX : value));         break;
+            case DTYPE_INT16:   ((int16_t*)result->data)[r] = (int16_t)(value < INT16_MIN ? INT16_MIN : (value > INT16_MAX ? INT16_MAX : value));   break;
+            case DTYPE_INT32:   ((int32_t*)result->data)[r] = (int32_t)(value < INT32_MIN ? INT32_MIN : (value > INT32_MAX ? INT32_MAX : value));   break;
+            default:            return VECTOR_UNSUPPORTED_OPERATION;
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,195 @@
+#include "tensor.h"
+#include "tensor_functions.h"
+#include "vector_basic_functions.h"
+#include "vector_test_helper.h"
+#include "tensor_test.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_OUTER 4
+#define MAX_INNER 300                                                   // Exceeds one scratch chunk of tensor_binary()
+
+// Dense copy of t broadcast to shape (ndim axes), in row-major order; the reference operands for vec_*
+static vector_t *materialize(const tensor_t *t, size_t ndim, const size_t *shape){
+    size_t numel = 1;
+    for (size_t i = 0; i < ndim; i++){
+        numel *= shape[i];
+    }
+    vector_t *vec = create_test_vector(numel, t->type);
+    assert(vec);
+
+    size_t elem = sizeof_dtype(t->type);
+    size_t lead = ndim - t->ndim;
+    for (size_t n = 0; n < numel; n++){
+        size_t rem = n;
+        size_t offset = 0;
+        for (size_t j = ndim; j-- > 0;){
+            size_t idx = rem % shape[j];
+            rem /= shape[j];
+            if (j >= lead && t->shape[j - lead] != 1){
+                offset += idx * t->strides[j - lead];
+            }
+        }
+        memcpy((uint8_t*)vec->data + n * elem, (const uint8_t*)t->data + offset * elem, elem);
+    }
+    return vec;
+}
+
+static void fill_test_tensor(tensor_t *t){
+    vector_t whole = { .data = t->data, .type = t->type, .size = tensor_numel(t), .owns_data = false };
+    fill_test_vector(&whole);
+}
+
+static vector_status_t reference_op(vector_binary_op_t op, vector_t *va, vector_t *vb, vector_t *vr, unsigned int shift_amount){
+    switch (op){
+        case VECTOR_OP_ADD: return vec_add(va, vb, vr);
+        case VECTOR_OP_SUB: return vec_sub(va, vb, vr);
+        default:            return vec_mul(va, vb, vr, shift_amount);
+    }
+}
+
+/**
+ * Operand b has random fewer axes and random extent-1 axes, so it is repeated along them.
+ * Result values are compared with vec_* on densely materialized copies of the operands.
+ */
+void tensor_test_broadcast(bool verbose, dtype type){
+    static const vector_binary_op_t ops[] = { VECTOR_OP_ADD, VECTOR_OP_SUB, VECTOR_OP_MUL };
+    set_rand_seed();
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        size_t ndim = 1 + rand() % TENSOR_MAX_DIMS;                     // Random shapes
+        size_t shape[TENSOR_MAX_DIMS];
+        for (size_t i = 0; i < ndim; i++){
+            shape[i] = (i + 1 == ndim) ? 1 + rand() % MAX_INNER : 1 + rand() % MAX_OUTER;
+        }
+        size_t b_ndim = 1 + rand() % ndim;
+        size_t b_shape[TENSOR_MAX_DIMS];
+        for (size_t i = 0; i < b_ndim; i++){
+            b_shape[i] = (rand() % 3 == 0) ? 1 : shape[ndim - b_ndim + i];
+        }
+
+        tensor_t *a = tensor_create(ndim, shape, type);                 // Allocating the test tensors
+        tensor_t *b = tensor_create(b_ndim, b_shape, type);
+        tensor_t *result = tensor_create(ndim, shape, type);
+        assert(a);                                                      // Check if valid
+        assert(b);
+        assert(result);
+        assert(tensor_ok(a) == VECTOR_SUCCESS);
+        assert(tensor_is_contiguous(a));
+
+        fill_test_tensor(a);                                            // Fill with random values in range
+        fill_test_tensor(b);
+
+        vector_binary_op_t op = ops[run_num % 3];
+        unsigned int shift_amount = (op == VECTOR_OP_MUL && type != DTYPE_FLOAT32) ? 1 : 0;
+        assert(tensor_binary(op, a, b, result, shift_amount) == VECTOR_SUCCESS);
+
+        vector_t *va = materialize(a, ndim, shape);                     // Reference through the vector API
+        vector_t *vb = materialize(b, ndim, shape);
+        vector_t *vr = create_test_vector(va->size, type);
+        assert(vr);
+        assert(reference_op(op, va, vb, vr, shift_amount) == VECTOR_SUCCESS);
+        vector_t *vt = materialize(result, ndim, shape);
+        vector_assert_eq(vt, vr);                                       // Check results
+
+        size_t bad_shape[TENSOR_MAX_DIMS];                              // Argument checks
+        memcpy(bad_shape, shape, sizeof(bad_shape));
+        bad_shape[ndim - 1] += 1;
+        tensor_t *bad = tensor_create(ndim, bad_shape, type);
+        assert(bad);
+        assert(tensor_add(a, bad, result) == VECTOR_SIZE_MISMATCH);
+        if (shape[ndim - 1] > 1){                                       // An extent-1 axis of a would broadcast to bad
+            assert(tensor_add(a, b, bad) == VECTOR_SIZE_MISMATCH);
+        }
+
+        tensor_destroy(a);                                              // Free resources
+        tensor_destroy(b);
+        tensor_destroy(result);
+        tensor_destroy(bad);
+        vector_destroy(va);
+        vector_destroy(vb);
+        vector_destroy(vr);
+        vector_destroy(vt);
+    }
+    if (verbose){
+            ESP_LOGI("tensor_test_broadcast", "passed");
+    }
+}
+
+/**
+ * Zero-copy views: a is a step-2 slice (strided runs), the result is an unaligned window of a
+ * larger buffer, and b is a tensor_from_vector() view. Elements outside the result window must
+ * not be touched.
+ */
+void tensor_test_views(bool verbose, dtype type){
+    set_rand_seed();
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        size_t ndim = 1 + rand() % 3;                                   // HWC-like shapes
+        size_t shape[TENSOR_MAX_DIMS];
+        size_t a_parent_shape[TENSOR_MAX_DIMS];
+        size_t r_parent_shape[TENSOR_MAX_DIMS];
+        size_t numel = 1;
+        for (size_t i = 0; i < ndim; i++){
+            shape[i] = (i + 1 == ndim) ? 1 + rand() % MAX_INNER : 1 + rand() % MAX_OUTER;
+            a_parent_shape[i] = shape[i];
+            r_parent_shape[i] = shape[i];
+            numel *= shape[i];
+        }
+        a_parent_shape[ndim - 1] = 2 * shape[ndim - 1];
+        r_parent_shape[ndim - 1] = shape[ndim - 1] + 1;
+
+        tensor_t *a_parent = tensor_create(ndim, a_parent_shape, type);
+        tensor_t *r_parent = tensor_create(ndim, r_parent_shape, type);
+        vector_t *b_vec = create_test_vector(numel, type);
+        assert(a_parent);
+        assert(r_parent);
+        assert(b_vec);
+        fill_test_tensor(a_parent);
+        fill_test_tensor(r_parent);
+        fill_test_vector(b_vec);
+        vector_t *r_before = materialize(r_parent, ndim, r_parent_shape);
+
+        tensor_t a, b, result;
+        assert(tensor_slice(a_parent, ndim - 1, 1, a_parent_shape[ndim - 1], 2, &a) == VECTOR_SUCCESS);
+        assert(tensor_from_vector(b_vec, ndim, shape, &b) == VECTOR_SUCCESS);
+        assert(tensor_slice(r_parent, ndim - 1, 1, r_parent_shape[ndim - 1], 1, &result) == VECTOR_SUCCESS);
+        assert(tensor_is_contiguous(&a) == (numel == 1));               // Only a single element stays dense under step 2
+        assert(tensor_numel(&a) == numel);
+
+        assert(tensor_add(&a, &b, &result) == VECTOR_SUCCESS);
+
+        vector_t *va = materialize(&a, ndim, shape);                    // Reference through the vector API
+        vector_t *vr = create_test_vector(numel, type);
+        assert(vr);
+        assert(vec_add(va, b_vec, vr) == VECTOR_SUCCESS);
+        vector_t *vt = materialize(&result, ndim, shape);
+        vector_assert_eq(vt, vr);                                       // Check results
+
+        tensor_t outside;                                               // Column 0 of the result parent is outside the view
+        assert(tensor_slice(r_parent, ndim - 1, 0, 1, 1, &outside) == VECTOR_SUCCESS);
+        vector_t *after = materialize(&outside, ndim, outside.shape);
+        outside.data = r_before->data;                                  // Same layout in the dense copy taken before the op
+        vector_t *before = materialize(&outside, ndim, outside.shape);
+        vector_assert_eq(after, before);
+
+        assert(tensor_from_vector(b_vec, ndim, r_parent_shape, &b) == VECTOR_SIZE_MISMATCH);  // Argument checks
+        assert(tensor_slice(a_parent, ndim, 0, 1, 1, &a) == VECTOR_INVALID_ARGUMENT);
+        assert(tensor_slice(a_parent, 0, 1, 1, 1, &a) == VECTOR_INVALID_ARGUMENT);
+        assert(tensor_slice(a_parent, 0, 0, 1, 0, &a) == VECTOR_INVALID_ARGUMENT);
+
+        tensor_destroy(a_parent);                                       // Free resources
+        tensor_destroy(r_parent);
+        vector_destroy(b_vec);
+        vector_destroy(r_before);
+        vector_destroy(va);
+        vector_destroy(vr);
+        vector_destroy(vt);
+        vector_destroy(after);
+        vector_destroy(before);
+    }
+    if (verbose){
+            ESP_LOGI("tensor_test_views", "passed");
+    }
+}
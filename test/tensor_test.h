@@ -0,0 +1,4 @@
+#include "tensor.h"
+
+void tensor_test_broadcast(bool verbose, dtype type);
+void tensor_test_views(bool verbose, dtype type);
@@ -0,0 +1,153 @@
+#include "vector.h"
+#include "vector_arena.h"
+#include "vector_basic_functions.h"
+#include "vector_test_helper.h"
+#include "vector_arena_test.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_VECTORS 8                                                 // Temporaries per simulated frame
+#define ARENA_FRAMES 4
+#define POOL_BLOCKS 6
+
+/**
+ * Simulates per-frame temporaries: each frame creates ARENA_VECTORS arena vectors, checks alignment
+ * and vec_add on them against heap vectors, and resets the arena. Timings compare against
+ * vector_create/vector_destroy of the same temporaries.
+ */
+void vector_test_arena(bool verbose, dtype type){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t heap_time = 0;                                             // Runtime logs
+    uint32_t arena_time = 0;
+    const size_t elem = sizeof_dtype(type);
+
+    vector_arena_t arena;
+    assert(vector_arena_init(&arena, (ARENA_VECTORS + 1) * (MAX_SIZE * elem + 2 * sizeof(vector_t) + 16), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) == VECTOR_SUCCESS);
+
+    for (int run_num = 0; run_num < TEST_RUNS / ARENA_FRAMES; run_num++){
+        vector_t *heap[ARENA_VECTORS];
+        timer_start();
+        for (int i = 0; i < ARENA_VECTORS; i++){
+            heap[i] = vector_create(1 + rand() % MAX_SIZE, type);
+        }
+        for (int i = 0; i < ARENA_VECTORS; i++){
+            vector_destroy(heap[i]);
+        }
+        timer_end(&heap_time);
+
+        for (int frame = 0; frame < ARENA_FRAMES; frame++){
+            int test_size = 1 + rand() % MAX_SIZE;
+            vector_t *vecs[ARENA_VECTORS];
+
+            timer_start();
+            for (int i = 0; i < ARENA_VECTORS; i++){
+                vecs[i] = vector_arena_create(&arena, test_size, type);
+            }
+            timer_end(&arena_time);
+
+            for (int i = 0; i < ARENA_VECTORS; i++){
+                assert(vecs[i]);
+                assert(vector_ok(vecs[i]) == VECTOR_SUCCESS);           // Non-NULL, 16-byte aligned
+                assert(!vecs[i]->owns_data);
+                assert(vecs[i]->size == (size_t)test_size);
+                fill_test_vector(vecs[i]);
+            }
+
+            vector_t *vec1 = create_test_vector(test_size, type);       // Heap reference
+            vector_t *vec2 = create_test_vector(test_size, type);
+            vector_t *expected = create_test_vector(test_size, type);
+            memcpy(vec1->data, vecs[0]->data, test_size * elem);
+            memcpy(vec2->data, vecs[1]->data, test_size * elem);
+            assert(vec_add(vec1, vec2, expected) == VECTOR_SUCCESS);
+            assert(vec_add(vecs[0], vecs[1], vecs[2]) == VECTOR_SUCCESS);
+            vector_assert_eq(vecs[2], expected);
+            vector_check_canary(expected);
+            vector_destroy(vec1);
+            vector_destroy(vec2);
+            vector_destroy(expected);
+
+            size_t mark = vector_arena_mark(&arena);                    // Rewind hands out the same memory again
+            vector_t *scoped = vector_arena_create(&arena, test_size, type);
+            assert(scoped);
+            assert(vector_arena_rewind(&arena, mark) == VECTOR_SUCCESS);
+            assert(vector_arena_create(&arena, test_size, type) == scoped);
+
+            vector_arena_reset(&arena);
+            assert(vector_arena_create(&arena, test_size, type) == vecs[0]);
+            vector_arena_reset(&arena);
+        }
+    }
+
+    assert(vector_arena_create(&arena, arena.capacity, type) == NULL);     // Exhaustion
+    assert(vector_arena_create(&arena, 0, type) == NULL);
+    assert(vector_arena_mark(&arena) == 0);                             // Failed creates leave nothing behind
+    assert(vector_arena_rewind(&arena, 16) == VECTOR_INVALID_ARGUMENT);
+    assert(arena.high_water <= arena.capacity);
+
+    vector_arena_deinit(&arena);
+
+    alignas(16) static uint8_t buffer[256 + 8];                         // Caller-provided buffer
+    assert(vector_arena_init_static(&arena, buffer + 8, 256) == VECTOR_UNALIGNED_DATA);
+    assert(vector_arena_init_static(&arena, buffer, sizeof(buffer)) == VECTOR_SUCCESS);
+    assert(arena.capacity == 256);
+    assert(vector_arena_alloc(&arena, 1) == buffer);
+    assert(vector_arena_alloc(&arena, 1) == buffer + 16);
+    vector_arena_deinit(&arena);
+
+    timer_deinit();
+    if (verbose){
+        ESP_LOGI("vector_test_arena", "heap_time: %d", heap_time);
+        ESP_LOGI("vector_test_arena", "arena_time: %d", arena_time);
+    }
+}
+
+// Exhausts, releases and reuses the blocks of a pool in random order
+void vector_test_pool(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+    const size_t elem = sizeof_dtype(type);
+
+    vector_pool_t pool;
+    assert(vector_pool_init(&pool, MAX_SIZE * elem, POOL_BLOCKS, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) == VECTOR_SUCCESS);
+    assert(pool.block_bytes % 16 == 0);
+    assert(vector_pool_create(&pool, MAX_SIZE + 16 / elem, type) == NULL);  // Larger than the size class
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        vector_t *vecs[POOL_BLOCKS];
+        for (int i = 0; i < POOL_BLOCKS; i++){
+            vecs[i] = vector_pool_create(&pool, 1 + rand() % MAX_SIZE, type);
+            assert(vecs[i]);
+            assert(vector_ok(vecs[i]) == VECTOR_SUCCESS);
+            assert(!vecs[i]->owns_data);
+            fill_test_vector(vecs[i]);
+        }
+        assert(pool.free_count == 0);
+        assert(vector_pool_create(&pool, 1, type) == NULL);            // Exhausted
+
+        for (int i = 0; i < POOL_BLOCKS; i++){                          // Blocks do not overlap
+            for (int j = i + 1; j < POOL_BLOCKS; j++){
+                assert(vecs[i]->data != vecs[j]->data);
+            }
+        }
+
+        int victim = rand() % POOL_BLOCKS;
+        void *data = vecs[victim]->data;
+        assert(vector_pool_release(&pool, vecs[victim]) == VECTOR_SUCCESS);
+        assert(vector_pool_release(&pool, vecs[victim]) == VECTOR_INVALID_ARGUMENT);    // Double release
+        vecs[victim] = vector_pool_create(&pool, MAX_SIZE, type);       // LIFO reuse of the released block
+        assert(vecs[victim] && vecs[victim]->data == data);
+
+        for (int i = 0; i < POOL_BLOCKS; i++){
+            assert(vector_pool_release(&pool, vecs[(i + victim) % POOL_BLOCKS]) == VECTOR_SUCCESS);
+        }
+        assert(pool.free_count == POOL_BLOCKS);
+    }
+
+    vector_t stray;
+    assert(vector_pool_release(&pool, &stray) == VECTOR_INVALID_ARGUMENT);
+    vector_pool_deinit(&pool);
+}
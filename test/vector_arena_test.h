@@ -0,0 +1,4 @@
+#include "vector.h"
+
+void vector_test_arena(bool verbose, dtype type);
+void vector_test_pool(bool verbose, dtype type);
@@ -457,8 +457,10 @@ void vector_test_mul_shift(bool verbose, dtype type){
     unsigned int rand_shift_amount;
 
     switch (type) {
-        case DTYPE_INT8:   rand_shift_amount = (rand() % 8);    break;
-        case DTYPE_INT16:  rand_shift_amount = (rand() % 16);   break;
+        case DTYPE_INT8:
+        case DTYPE_UINT8:  rand_shift_amount = (rand() % 8);    break;
+        case DTYPE_INT16:
+        case DTYPE_UINT16: rand_shift_amount = (rand() % 16);   break;
         default:           rand_shift_amount = (rand() % 32);   break;
     }
 
@@ -531,8 +533,10 @@ void vector_test_mul_shift_alias(bool verbose, dtype type){
         unsigned int rand_shift_amount;
 
         switch (type) {
-            case DTYPE_INT8:   rand_shift_amount = (rand() % 8);    break;
-            case DTYPE_INT16:  rand_shift_amount = (rand() % 16);   break;
+            case DTYPE_INT8:
+            case DTYPE_UINT8:  rand_shift_amount = (rand() % 8);    break;
+            case DTYPE_INT16:
+            case DTYPE_UINT16: rand_shift_amount = (rand() % 16);   break;
             default:           rand_shift_amount = (rand() % 32);   break;
         }
 
@@ -579,6 +583,83 @@ void vector_test_mul_shift_alias(bool verbose, dtype type){
     }
 }
 
+void vector_test_fma(bool verbose, dtype type){  
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+    unsigned int rand_shift_amount;
+
+    switch (type) {
+        case DTYPE_INT8:
+        case DTYPE_UINT8:  rand_shift_amount = (rand() % 8);    break;
+        case DTYPE_INT16:
+        case DTYPE_UINT16: rand_shift_amount = (rand() % 16);   break;
+        default:           rand_shift_amount = (rand() % 32);   break;
+    }
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors
+        vector_t *vec2 = create_test_vector(test_size, type);
+        vector_t *vec3 = create_test_vector(test_size, type);
+        vector_t *simd_result = create_test_vector(test_size, type); 
+        vector_t *scalar_result = create_test_vector(test_size, type); 
+
+        assert(vec1);                                                   // Check if valid
+        assert(vec2);
+        assert(vec3);
+        assert(simd_result);
+        assert(scalar_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range
+        fill_test_vector(vec2); 
+        fill_test_vector(vec3); 
+
+        vector_t *vec3_copy = vector_create(vec3->size, vec3->type);    // Creating copies (to check for modification of inputs)
+        assert(vec3_copy);
+        vec_copy(vec3, vec3_copy); 
+        assert(vector_assert_eq(vec3, vec3_copy));                      // Checking copies, canary regions
+        assert(vector_check_canary(vec3));
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_fma(vec1, vec2, vec3, scalar_result, rand_shift_amount) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_fma(vec1, vec2, vec3, simd_result, rand_shift_amount) == VECTOR_SUCCESS);
+        timer_end(&vec_time);  
+
+        assert(vector_assert_eq(simd_result, scalar_result));           // Check results
+        assert(vector_assert_eq(vec3, vec3_copy));                      // Check modification of inputs
+
+        assert(vec_fma(vec1, vec2, vec3, vec3, rand_shift_amount) == VECTOR_SUCCESS);   // Accumulating in place
+        assert(vector_assert_eq(vec3, scalar_result));
+
+        if (type != DTYPE_FLOAT32){                                     // Argument checks
+            assert(vec_fma(vec1, vec2, vec3, simd_result, 32) == VECTOR_INVALID_ARGUMENT);
+        }
+        vector_check_canary(vec1);                                      // Check modification of canary region
+        vector_check_canary(vec2);
+        vector_check_canary(vec3);
+        vector_check_canary(simd_result);
+        vector_check_canary(scalar_result);
+  
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(vec2);
+        vector_destroy(vec3);
+        vector_destroy(vec3_copy);
+        vector_destroy(simd_result);
+        vector_destroy(scalar_result);
+    } 
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_fma", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_fma", "scalar_time: %d", scalar_time);
+    }
+}
+
 void vector_test_sum(bool verbose, dtype type){ 
 
     timer_init();
@@ -632,6 +713,112 @@ void vector_test_sum(bool verbose, dtype type){
             ESP_LOGI("vector_test_sum", "scalar_time: %d", scalar_time);
     }
 }
+
+void vector_test_sum_i64(bool verbose, dtype type){ 
+
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors  
+        int64_t vector_sum_val;
+        int64_t scalar_sum_val;
+
+        assert(vec1);              
+        fill_test_vector(vec1);                                         // Full range: 64-bit sums cannot overflow
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs) 
+        vec_copy(vec1, vec1_copy);  
+
+        assert(vector_assert_eq(vec1, vec1_copy));                      // Checking copies, canary regions 
+        assert(vector_check_canary(vec1)); 
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_sum_i64(vec1, &scalar_sum_val) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_sum_i64(vec1, &vector_sum_val) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+  
+        if(vector_sum_val != scalar_sum_val){
+            ESP_LOGE("vector_test_sum_i64", "Sum mismatch: vector_sum: %lld, scalar_sum: %lld", (long long)vector_sum_val, (long long)scalar_sum_val);
+            assert(0);
+        }
+        vector_check_canary(vec1);                                      // Check modification of canary region 
+  
+        vector_destroy(vec1);                                           // Free resources 
+        vector_destroy(vec1_copy); 
+    } 
+
+    const int long_size = 70000;                                        // Extremes over more than one ACCX chunk, past 32 bits
+    const int extreme = (type == DTYPE_INT8) ? INT8_MIN : (type == DTYPE_INT16) ? INT16_MIN : INT32_MIN;
+    vector_t *vec1 = create_test_vector(long_size, type);
+    assert(vec1);
+    assert(vec_fill(vec1, extreme) == VECTOR_SUCCESS);
+    int64_t vector_sum_val = 0;
+    assert(vec_sum_i64(vec1, &vector_sum_val) == VECTOR_SUCCESS);
+    assert(vector_sum_val == (int64_t)long_size * extreme);
+    vector_destroy(vec1);
+
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_sum_i64", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_sum_i64", "scalar_time: %d", scalar_time);
+    }
+}
+ 
+void vector_test_sum_unsigned(bool verbose, dtype type){ 
+
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors  
+        uint32_t vector_sum_val;
+        uint32_t scalar_sum_val;
+
+        assert(vec1);              
+        fill_test_vector(vec1);                                         // Fill with random values in range; sums wrap modulo 2^32
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs) 
+        vec_copy(vec1, vec1_copy);  
+
+        assert(vector_assert_eq(vec1, vec1_copy));                      // Checking copies, canary regions 
+        assert(vector_check_canary(vec1)); 
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_sum_unsigned(vec1, &scalar_sum_val) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_sum_unsigned(vec1, &vector_sum_val) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+  
+        if(vector_sum_val != scalar_sum_val){
+            ESP_LOGE("vector_test_sum_unsigned", "Sum mismatch: vector_sum: %lu, scalar_sum: %lu", (unsigned long)vector_sum_val, (unsigned long)scalar_sum_val);
+            assert(0);
+        }
+        vector_assert_eq(vec1, vec1_copy);                              // Check modification of inputs
+        vector_check_canary(vec1);                                      // Check modification of canary region 
+  
+        vector_destroy(vec1);                                           // Free resources 
+        vector_destroy(vec1_copy); 
+    } 
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_sum_unsigned", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_sum_unsigned", "scalar_time: %d", scalar_time);
+    }
+}
  
 void vector_test_sum_f32(bool verbose, dtype type){ 
     assert(type == DTYPE_FLOAT32);
@@ -807,6 +994,74 @@ void vector_test_dotp(bool verbose, dtype type){
     }
 }
 
+void vector_test_dotp_i64(bool verbose, dtype type){ 
+
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                              // Random vector sizes 
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors
+        vector_t *vec2 = create_test_vector(test_size, type); 
+        int64_t scalar_result = 0xDEADBEEF;
+        int64_t simd_result = 0xDEADBEEF;
+
+        assert(vec1);                                                   // Check if valid
+        assert(vec2); 
+
+        fill_test_vector(vec1);                                         // Fill with random values in range
+        fill_test_vector(vec2); 
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs)
+        vector_t *vec2_copy = vector_create(vec2->size, vec2->type); 
+        vec_copy(vec1, vec1_copy); 
+        vec_copy(vec2, vec2_copy);  
+
+        assert(vector_assert_eq(vec1, vec1_copy));                      // Checking copies, canary regions
+        assert(vector_assert_eq(vec2, vec2_copy));
+        assert(vector_check_canary(vec1));
+        assert(vector_check_canary(vec2));
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_dotp_i64(vec1, vec2, &scalar_result) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_dotp_i64(vec1, vec2, &simd_result) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+ 
+        assert( scalar_result == simd_result);
+        vector_assert_eq(vec1, vec1_copy);                              // Check modification of inputs
+        vector_assert_eq(vec2, vec2_copy);
+        vector_check_canary(vec1);                                      // Check modification of canary region
+        vector_check_canary(vec2); 
+  
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(vec2);
+        vector_destroy(vec1_copy);
+        vector_destroy(vec2_copy); 
+    } 
+
+    const int long_size = 70000;                                        // Extremes over more than one ACCX chunk, past 32 bits
+    const int extreme = (type == DTYPE_INT8) ? INT8_MIN : INT16_MIN;
+    vector_t *vec1 = create_test_vector(long_size, type);
+    assert(vec1);
+    assert(vec_fill(vec1, extreme) == VECTOR_SUCCESS);
+    int64_t simd_result = 0;
+    assert(vec_dotp_i64(vec1, vec1, &simd_result) == VECTOR_SUCCESS);
+    assert(simd_result == (int64_t)long_size * extreme * extreme);
+    vector_destroy(vec1);
+
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_dotp_i64", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_dotp_i64", "scalar_time: %d", scalar_time);
+    }
+}
+
 void vector_test_dotp_f32(bool verbose, dtype type){ 
 
     timer_init();
@@ -1232,6 +1487,55 @@ void vector_test_mac(bool verbose, dtype type){
     }
 }
 
+void vector_test_mac_i64(bool verbose, dtype type){ 
+
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors  
+        int64_t rand_start_val = (int64_t)rand_scalar_val(DTYPE_INT32) << 24;
+        int rand_multiplier = rand_scalar_val(type);
+        int64_t vector_accumulator = rand_start_val;
+        int64_t scalar_accumulator = rand_start_val;
+
+        assert(vec1);              
+        fill_test_vector(vec1);                                         // Full range: products are exact in 64 bits
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs) 
+        vec_copy(vec1, vec1_copy);  
+
+        assert(vector_assert_eq(vec1, vec1_copy));                      // Checking copies, canary regions 
+        assert(vector_check_canary(vec1)); 
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_mac_i64(vec1, &scalar_accumulator, rand_multiplier) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_mac_i64(vec1, &vector_accumulator, rand_multiplier) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+  
+        if(vector_accumulator != scalar_accumulator){
+            ESP_LOGE("vector_test_mac_i64", "Accumulator mismatch: vector_accumulator: %lld, scalar_accumulator: %lld", (long long)vector_accumulator, (long long)scalar_accumulator);
+            assert(0);
+        }
+        vector_check_canary(vec1);                                      // Check modification of canary region 
+  
+        vector_destroy(vec1);                                           // Free resources 
+        vector_destroy(vec1_copy); 
+    } 
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_mac_i64", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_mac_i64", "scalar_time: %d", scalar_time);
+    }
+}
+
 void vector_test_mac_f32(bool verbose, dtype type){ 
 
     timer_init();
@@ -1549,3 +1853,190 @@ void vector_test_convert(bool verbose, dtype type, dtype target_type){
             ESP_LOGI("vector_test_convert", "scalar_time: %d", scalar_time);
     }
 }
+
+void vector_test_convert_shift(bool verbose, dtype type, dtype target_type){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+    const unsigned int max_shift = (type == DTYPE_INT32) ? 31 : 15;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        unsigned int shift_amount = rand() % (max_shift + 1);           // Random shifts, 0 included
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors   
+        vector_t *simd_result = create_test_vector(vec1->size, target_type); 
+        vector_t *scalar_result = create_test_vector(vec1->size, target_type); 
+
+        assert(vec1);                                                   // Check if valid 
+        assert(simd_result);
+        assert(scalar_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range 
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs) 
+        vec_copy(vec1, vec1_copy);  
+
+        assert(vector_assert_eq(vec1, vec1_copy));                      // Checking copies, canary regions 
+        assert(vector_check_canary(vec1)); 
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_convert_shift(vec1, scalar_result, shift_amount) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_convert_shift(vec1, simd_result, shift_amount) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+
+        vector_assert_eq(simd_result, scalar_result);                   // Check results
+        vector_assert_eq(vec1, vec1_copy);                              // Check modification of inputs 
+        vector_check_canary(vec1);                                      // Check modification of canary region 
+        vector_check_canary(simd_result);
+        vector_check_canary(scalar_result);
+
+        assert(vec_convert_shift(vec1, simd_result, max_shift + 1) == VECTOR_INVALID_ARGUMENT);    // Argument checks
+  
+        vector_destroy(vec1);                                           // Free resources 
+        vector_destroy(vec1_copy); 
+        vector_destroy(simd_result);
+        vector_destroy(scalar_result);
+    } 
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_convert_shift", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_convert_shift", "scalar_time: %d", scalar_time);
+    }
+}
+
+void vector_test_quantize(bool verbose, dtype target_type){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+    const dtype type = DTYPE_FLOAT32;
+    const int zp_range = (target_type == DTYPE_INT8) ? 256 : 65536;
+    const int zp_min = (target_type == DTYPE_INT8) ? INT8_MIN : INT16_MIN;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        float scale = (float)(1 + rand() % 400) / 128.0f;               // Random scales, exact halves and quarters included
+        int zero_point = zp_min + rand() % zp_range;                    // Random zero points in range
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors   
+        vector_t *simd_result = create_test_vector(vec1->size, target_type); 
+        vector_t *scalar_result = create_test_vector(vec1->size, target_type); 
+
+        assert(vec1);                                                   // Check if valid 
+        assert(simd_result);
+        assert(scalar_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range 
+        float *data = (float*)(vec1->data);                             // Special values: infinities, a tie
+        data[rand() % vec1->size] = INFINITY;
+        data[rand() % vec1->size] = -INFINITY;
+        data[rand() % vec1->size] = 0.5f * scale;
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs) 
+        vec_copy(vec1, vec1_copy);  
+
+        assert(vector_assert_eq(vec1, vec1_copy));                      // Checking copies, canary regions 
+        assert(vector_check_canary(vec1)); 
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_quantize(vec1, scalar_result, scale, zero_point) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_quantize(vec1, simd_result, scale, zero_point) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+
+        vector_assert_eq(simd_result, scalar_result);                   // Check results
+        vector_assert_eq(vec1, vec1_copy);                              // Check modification of inputs 
+        vector_check_canary(vec1);                                      // Check modification of canary region 
+        vector_check_canary(simd_result);
+        vector_check_canary(scalar_result);
+
+        int nan_index = rand() % vec1->size;                            // NaN maps to the minimum
+        data[nan_index] = NAN;
+        assert(vec_quantize(vec1, simd_result, scale, zero_point) == VECTOR_SUCCESS);
+        int32_t nan_result = (target_type == DTYPE_INT8) ? ((int8_t*)(simd_result->data))[nan_index] : ((int16_t*)(simd_result->data))[nan_index];
+        assert(nan_result == ((target_type == DTYPE_INT8) ? INT8_MIN : INT16_MIN));
+
+        assert(vec_quantize(vec1, simd_result, 0.0f, zero_point) == VECTOR_INVALID_ARGUMENT);     // Argument checks
+        assert(vec_quantize(vec1, simd_result, -scale, zero_point) == VECTOR_INVALID_ARGUMENT);
+        assert(vec_quantize(vec1, simd_result, NAN, zero_point) == VECTOR_INVALID_ARGUMENT);
+        assert(vec_quantize(vec1, simd_result, scale, zp_min - 1) == VECTOR_INVALID_ARGUMENT);
+  
+        vector_destroy(vec1);                                           // Free resources 
+        vector_destroy(vec1_copy); 
+        vector_destroy(simd_result);
+        vector_destroy(scalar_result);
+    } 
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_quantize", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_quantize", "scalar_time: %d", scalar_time);
+    }
+}
+
+void vector_test_dequantize(bool verbose, dtype type){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+    const dtype target_type = DTYPE_FLOAT32;
+    const int zp_range = (type == DTYPE_INT8) ? 256 : 65536;
+    const int zp_min = (type == DTYPE_INT8) ? INT8_MIN : INT16_MIN;
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        float scale = (float)(1 + rand() % 400) / 128.0f;               // Random scales, exact halves and quarters included
+        int zero_point = zp_min + rand() % zp_range;                    // Random zero points in range
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors   
+        vector_t *simd_result = create_test_vector(vec1->size, target_type); 
+        vector_t *scalar_result = create_test_vector(vec1->size, target_type); 
+
+        assert(vec1);                                                   // Check if valid 
+        assert(simd_result);
+        assert(scalar_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range 
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs) 
+        vec_copy(vec1, vec1_copy);  
+
+        assert(vector_assert_eq(vec1, vec1_copy));                      // Checking copies, canary regions 
+        assert(vector_check_canary(vec1)); 
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_dequantize(vec1, scalar_result, scale, zero_point) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_dequantize(vec1, simd_result, scale, zero_point) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+
+        vector_assert_eq(simd_result, scalar_result);                   // Check results
+        vector_assert_eq(vec1, vec1_copy);                              // Check modification of inputs 
+        vector_check_canary(vec1);                                      // Check modification of canary region 
+        vector_check_canary(simd_result);
+        vector_check_canary(scalar_result);
+
+        assert(vec_dequantize(vec1, simd_result, 0.0f, zero_point) == VECTOR_INVALID_ARGUMENT);     // Argument checks
+        assert(vec_dequantize(vec1, simd_result, -scale, zero_point) == VECTOR_INVALID_ARGUMENT);
+        assert(vec_dequantize(vec1, simd_result, NAN, zero_point) == VECTOR_INVALID_ARGUMENT);
+        assert(vec_dequantize(vec1, simd_result, scale, zp_min - 1) == VECTOR_INVALID_ARGUMENT);
+  
+        vector_destroy(vec1);                                           // Free resources 
+        vector_destroy(vec1_copy); 
+        vector_destroy(simd_result);
+        vector_destroy(scalar_result);
+    } 
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI("vector_test_dequantize", "vector_time: %d", vec_time);
+            ESP_LOGI("vector_test_dequantize", "scalar_time: %d", scalar_time);
+    }
+}
@@ -10,10 +10,14 @@ void vector_test_add_scalar_alias(bool verbose, dtype type);
 void vector_test_add_scalar_f32_alias(bool verbose, dtype type);
 void vector_test_mul_shift(bool verbose, dtype type);
 void vector_test_mul_shift_alias(bool verbose, dtype type);
+void vector_test_fma(bool verbose, dtype type);
 void vector_test_sum(bool verbose, dtype type);
+void vector_test_sum_i64(bool verbose, dtype type);
 void vector_test_sum_f32(bool verbose, dtype type);
+void vector_test_sum_unsigned(bool verbose, dtype type);
 void vector_test_mul_scalar_shift(bool verbose, dtype type); 
 void vector_test_dotp(bool verbose, dtype type);
+void vector_test_dotp_i64(bool verbose, dtype type);
 void vector_test_dotp_f32(bool verbose, dtype type);
 void vector_test_abs(bool verbose, dtype type);
 void vector_test_ceil(bool verbose, dtype type);
@@ -22,10 +26,14 @@ void vector_test_floor(bool verbose, dtype type);
 void vector_test_floor_f32(bool verbose, dtype type); 
 void vector_test_neg(bool verbose, dtype type);
 void vector_test_mac(bool verbose, dtype type);
+void vector_test_mac_i64(bool verbose, dtype type);
 void vector_test_mac_f32(bool verbose, dtype type);
 void vector_test_zeros(bool verbose, dtype type);
 void vector_test_ones(bool verbose, dtype type);
 void vector_test_fill(bool verbose, dtype type);
 void vector_test_fill_f32(bool verbose, dtype type);
 void vector_test_copy(bool verbose, dtype type);
-void vector_test_convert(bool verbose, dtype type, dtype target_type);
\ No newline at end of file
+void vector_test_convert(bool verbose, dtype type, dtype target_type);
+void vector_test_convert_shift(bool verbose, dtype type, dtype target_type);
+void vector_test_quantize(bool verbose, dtype target_type);
+void vector_test_dequantize(bool verbose, dtype type);
@@ -0,0 +1,148 @@
+#include "vector.h"
+#include "vector_compare_functions.h"
+#include "scalar_compare_functions.h"
+#include "vector_test_helper.h"
+#include "vector_basic_functions.h"
+#include "vector_compare_test.h" 
+#include "esp_log.h"
+#include <stdlib.h> 
+#include <string.h>
+#include <math.h>
+
+typedef vector_status_t (*compare_function_t)(const vector_t *vec1, const vector_t *vec2, vector_t *result);
+
+// FLOAT32 special values mixed into the inputs, so the NaN and signed zero rules are exercised
+static const float specials_f32[] = { NAN, -NAN, 0.0f, -0.0f, INFINITY, -INFINITY };
+#define NUM_SPECIALS_F32 (sizeof(specials_f32) / sizeof(specials_f32[0]))
+
+static void inject_specials_f32(vector_t *vec, int first, int step){
+    float *data = (float*)(vec->data);
+    for (int i = first; i < (int)vec->size; i += step){
+        if (rand() % 4 == 0){ data[i] = specials_f32[rand() % NUM_SPECIALS_F32];}
+    }
+}
+
+// vector_assert_eq() with FLOAT32 compared bit for bit, any NaN matching any NaN; masks and NaN results are NaNs
+static bool compare_assert_eq(vector_t *vec1, vector_t *vec2){
+    if (vec1->type != DTYPE_FLOAT32){ return vector_assert_eq(vec1, vec2);}
+    const float *data1 = (const float*)(vec1->data);
+    const float *data2 = (const float*)(vec2->data);
+    bool equals_flag = true;
+    for (int i = 0; i < (int)vec1->size; i++){
+        bool both_nan = isnan(data1[i]) && isnan(data2[i]);
+        if (!both_nan && memcmp(&data1[i], &data2[i], sizeof(float)) != 0){
+            uint32_t bits1, bits2;
+            memcpy(&bits1, &data1[i], sizeof(bits1));
+            memcpy(&bits2, &data2[i], sizeof(bits2));
+            ESP_LOGE("vector_assert_eq_f32", "Mismatch found at %d, vec1: 0x%08x, vec2 0x%08x", i, (unsigned)bits1, (unsigned)bits2);
+            equals_flag = false;
+        }
+    }
+    return equals_flag;
+}
+
+/**
+ * Runs one comparison against its scalar reference on random vectors. Every other element of vec2 is
+ * copied from vec1 so that the equal case is exercised as often as the strict ones. FLOAT32 inputs
+ * also get NaNs, infinities and signed zeros, equal pairs included.
+ */
+static void vector_test_compare(bool verbose, dtype type, const char *tag, compare_function_t vec_fn, compare_function_t scalar_fn){ 
+
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t scalar_time = 0;
+    const size_t elem = sizeof_dtype(type);
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes 
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors
+        vector_t *vec2 = create_test_vector(test_size, type);
+        vector_t *simd_result = create_test_vector(vec1->size, vec1->type); 
+        vector_t *scalar_result = create_test_vector(vec2->size, vec2->type); 
+
+        assert(vec1);                                                   // Check if valid
+        assert(vec2);
+        assert(simd_result);
+        assert(scalar_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range
+        fill_test_vector(vec2); 
+        if (type == DTYPE_FLOAT32){ inject_specials_f32(vec1, 0, 1);}
+        for (int i = 0; i < test_size; i += 2){
+            memcpy((uint8_t*)vec2->data + i * elem, (uint8_t*)vec1->data + i * elem, elem);
+        }
+        if (type == DTYPE_FLOAT32){ inject_specials_f32(vec2, 1, 2);}
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating copies (to check for modification of inputs)
+        vector_t *vec2_copy = vector_create(vec2->size, vec2->type); 
+        vec_copy(vec1, vec1_copy); 
+        vec_copy(vec2, vec2_copy);  
+
+        assert(compare_assert_eq(vec1, vec1_copy));                     // Checking copies, canary regions
+        assert(compare_assert_eq(vec2, vec2_copy));
+        assert(vector_check_canary(vec1));
+        assert(vector_check_canary(vec2));
+ 
+        timer_start();                                                  // Scalar functions are assumed intended behavior
+        assert(scalar_fn(vec1, vec2, scalar_result) == VECTOR_SUCCESS);
+        timer_end(&scalar_time);
+
+        timer_start();                                                  // Running tests
+        assert(vec_fn(vec1, vec2, simd_result) == VECTOR_SUCCESS);
+        timer_end(&vec_time); 
+
+        compare_assert_eq(simd_result, scalar_result);                  // Check results
+        compare_assert_eq(vec1, vec1_copy);                             // Check modification of inputs
+        compare_assert_eq(vec2, vec2_copy);
+        vector_check_canary(vec1);                                      // Check modification of canary region
+        vector_check_canary(vec2);
+        vector_check_canary(simd_result);
+        vector_check_canary(scalar_result);
+  
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(vec2);
+        vector_destroy(vec1_copy);
+        vector_destroy(vec2_copy);
+        vector_destroy(simd_result);
+        vector_destroy(scalar_result);
+    } 
+    timer_deinit();
+    if (verbose){
+            ESP_LOGI(tag, "vector_time: %d", vec_time);
+            ESP_LOGI(tag, "scalar_time: %d", scalar_time);
+    }
+}
+
+void vector_test_max(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_max", vec_max, scalar_max);
+}
+
+void vector_test_min(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_min", vec_min, scalar_min);
+}
+
+void vector_test_gt(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_gt", vec_gt, scalar_gt);
+}
+
+void vector_test_lt(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_lt", vec_lt, scalar_lt);
+}
+
+void vector_test_eq(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_eq", vec_eq, scalar_eq);
+}
+
+void vector_test_ge(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_ge", vec_ge, scalar_ge);
+}
+
+void vector_test_le(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_le", vec_le, scalar_le);
+}
+
+void vector_test_ne(bool verbose, dtype type){
+    vector_test_compare(verbose, type, "vector_test_ne", vec_ne, scalar_ne);
+}
@@ -0,0 +1,10 @@
+#include "vector.h"
+
+void vector_test_max(bool verbose, dtype type); 
+void vector_test_min(bool verbose, dtype type); 
+void vector_test_gt(bool verbose, dtype type); 
+void vector_test_lt(bool verbose, dtype type); 
+void vector_test_eq(bool verbose, dtype type); 
+void vector_test_ge(bool verbose, dtype type); 
+void vector_test_le(bool verbose, dtype type); 
+void vector_test_ne(bool verbose, dtype type); 
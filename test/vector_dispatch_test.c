@@ -0,0 +1,210 @@
+#include "vector.h"
+#include "vector_basic_functions.h"
+#include "vector_bitwise_functions.h"
+#include "vector_compare_functions.h"
+#include "vector_dispatch.h"
+#include "vector_test_helper.h"
+#include "vector_dispatch_test.h"
+#include "simd_functions.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_CALLS 4096
+
+typedef vector_status_t (*binary_wrapper_t)(const vector_t *vec1, const vector_t *vec2, vector_t *result);
+typedef vector_status_t (*unary_wrapper_t)(const vector_t *vec1, vector_t *result);
+
+static vector_status_t vec_mul_by_one(const vector_t *vec1, const vector_t *vec2, vector_t *result){
+    return vec_mul(vec1, vec2, result, 1);
+}
+
+static vector_status_t vec_copy_const(const vector_t *vec1, vector_t *result){
+    return vec_copy((vector_t*)vec1, result);
+}
+
+// The public wrapper each prepared op must agree with, indexed by vector_binary_op_t / vector_unary_op_t
+static const binary_wrapper_t binary_wrappers[VECTOR_BINARY_OP_COUNT] = {
+    [VECTOR_OP_ADD] = vec_add,  [VECTOR_OP_SUB] = vec_sub,  [VECTOR_OP_MUL] = vec_mul_by_one,
+    [VECTOR_OP_AND] = vec_and,  [VECTOR_OP_OR]  = vec_or,   [VECTOR_OP_XOR] = vec_xor,
+    [VECTOR_OP_MAX] = vec_max,  [VECTOR_OP_MIN] = vec_min,
+    [VECTOR_OP_GT]  = vec_gt,   [VECTOR_OP_LT]  = vec_lt,   [VECTOR_OP_EQ]  = vec_eq,
+    [VECTOR_OP_GE]  = vec_ge,   [VECTOR_OP_LE]  = vec_le,   [VECTOR_OP_NE]  = vec_ne,
+};
+
+static const unary_wrapper_t unary_wrappers[VECTOR_UNARY_OP_COUNT] = {
+    [VECTOR_OP_ABS] = vec_abs,  [VECTOR_OP_NEG] = vec_neg,  [VECTOR_OP_NOT] = vec_not,  [VECTOR_OP_COPY] = vec_copy_const,
+};
+
+// Bitwise comparison; FLOAT32 bitwise ops produce NaN patterns that vector_assert_eq() rejects
+static bool vector_assert_bits_eq(const vector_t *vec1, const vector_t *vec2){
+    if (memcmp(vec1->data, vec2->data, vec1->size * sizeof_dtype(vec1->type)) != 0){
+        ESP_LOGE("vector_assert_bits_eq", "Mismatch found");
+        return false;
+    }
+    return true;
+}
+
+// Per-call switch dispatch as vec_add did it before the dispatch tables; kept as the benchmark baseline
+static vector_status_t switch_add(const vector_t *vec1, const vector_t *vec2, vector_t *result){
+    if (vec1->size != vec2->size || vec1->size != result->size){ return VECTOR_SIZE_MISMATCH;}
+    if (vec1->type != vec2->type || vec1->type != result->type){ return VECTOR_TYPE_MISMATCH;}
+    switch (vec1->type) {
+        case DTYPE_INT8:    return simd_add_i8((int8_t*)(vec1->data), (int8_t*)(vec2->data), (int8_t*)(result->data), vec1->size);
+        case DTYPE_INT16:   return simd_add_i16((int16_t*)(vec1->data), (int16_t*)(vec2->data), (int16_t*)(result->data), vec1->size);
+        case DTYPE_INT32:   return simd_add_i32((int32_t*)(vec1->data), (int32_t*)(vec2->data), (int32_t*)(result->data), vec1->size);
+        case DTYPE_FLOAT32: return simd_add_f32((float*)(vec1->data), (float*)(vec2->data), (float*)(result->data), vec1->size);
+        default:            return VECTOR_ERROR;
+    }
+}
+
+void vector_test_prepared_binary(bool verbose, dtype type){
+    set_rand_seed();
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors
+        vector_t *vec2 = create_test_vector(test_size, type);
+        vector_t *plan_result = create_test_vector(test_size, type);
+        vector_t *wrapper_result = create_test_vector(test_size, type);
+
+        assert(vec1);                                                   // Check if valid
+        assert(vec2);
+        assert(plan_result);
+        assert(wrapper_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range
+        fill_test_vector(vec2);
+
+        for (int op = 0; op < VECTOR_BINARY_OP_COUNT; op++){
+            vector_binary_plan_t plan;
+            unsigned int shift_amount = (op == VECTOR_OP_MUL) ? 1 : 0;
+            vector_status_t status = vec_prepare_binary(&plan, op, vec1, vec2, plan_result, shift_amount);
+            vector_status_t expected = binary_wrappers[op](vec1, vec2, wrapper_result);
+            if (expected == VECTOR_NOT_IMPLEMENTED){
+                assert(status == VECTOR_NOT_IMPLEMENTED);
+                continue;
+            }
+            assert(status == VECTOR_SUCCESS);
+            assert(vec_run_binary(&plan, vec1, vec2, plan_result) == expected);
+            vector_assert_bits_eq(plan_result, wrapper_result);         // Check results
+            vector_check_canary(plan_result);                           // Check modification of canary region
+        }
+
+        vector_binary_plan_t plan;                                      // Argument checks happen at prepare time
+        vector_t *short_result = create_test_vector(test_size + 1, type);
+        assert(short_result);
+        assert(vec_prepare_binary(&plan, VECTOR_OP_ADD, vec1, vec2, short_result, 0) == VECTOR_SIZE_MISMATCH);
+        assert(vec_prepare_binary(&plan, VECTOR_BINARY_OP_COUNT, vec1, vec2, plan_result, 0) == VECTOR_INVALID_ARGUMENT);
+        assert(vec_prepare_binary(&plan, VECTOR_OP_ADD, vec1, vec2, plan_result, 1) == VECTOR_INVALID_ARGUMENT);
+        if (type != DTYPE_FLOAT32){
+            assert(vec_prepare_binary(&plan, VECTOR_OP_MUL, vec1, vec2, plan_result, 32) == VECTOR_INVALID_ARGUMENT);
+        }
+
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(vec2);
+        vector_destroy(plan_result);
+        vector_destroy(wrapper_result);
+        vector_destroy(short_result);
+    }
+    if (verbose){
+            ESP_LOGI("vector_test_prepared_binary", "passed");
+    }
+}
+
+void vector_test_prepared_unary(bool verbose, dtype type){
+    set_rand_seed();
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_SIZE;                          // Random vector sizes
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors
+        vector_t *plan_result = create_test_vector(test_size, type);
+        vector_t *wrapper_result = create_test_vector(test_size, type);
+
+        assert(vec1);                                                   // Check if valid
+        assert(plan_result);
+        assert(wrapper_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range
+
+        for (int op = 0; op < VECTOR_UNARY_OP_COUNT; op++){
+            vector_unary_plan_t plan;
+            vector_status_t status = vec_prepare_unary(&plan, op, vec1, plan_result);
+            vector_status_t expected = unary_wrappers[op](vec1, wrapper_result);
+            if (expected == VECTOR_NOT_IMPLEMENTED){
+                assert(status == VECTOR_NOT_IMPLEMENTED);
+                continue;
+            }
+            assert(status == VECTOR_SUCCESS);
+            assert(vec_run_unary(&plan, vec1, plan_result) == expected);
+            vector_assert_bits_eq(plan_result, wrapper_result);         // Check results
+            vector_check_canary(plan_result);                           // Check modification of canary region
+        }
+
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(plan_result);
+        vector_destroy(wrapper_result);
+    }
+    if (verbose){
+            ESP_LOGI("vector_test_prepared_unary", "passed");
+    }
+}
+
+/**
+ * Per-call overhead of element-wise dispatch on small vectors. Times BENCH_CALLS calls of vec_add
+ * through the old per-call switch, through the dispatch table (vec_add) and through a prepared op.
+ */
+void vector_bench_dispatch(bool verbose, dtype type){
+    static const size_t bench_sizes[] = { 16, 32, 64 };
+
+    timer_init();
+    set_rand_seed();
+
+    for (size_t s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); s++){
+        uint32_t switch_time = 0;                                       // Runtime logs
+        uint32_t table_time = 0;
+        uint32_t prepared_time = 0;
+
+        vector_t *vec1 = create_test_vector(bench_sizes[s], type);
+        vector_t *vec2 = create_test_vector(bench_sizes[s], type);
+        vector_t *result = create_test_vector(bench_sizes[s], type);
+        assert(vec1);
+        assert(vec2);
+        assert(result);
+        fill_test_vector(vec1);
+        fill_test_vector(vec2);
+
+        vector_binary_plan_t plan;
+        assert(vec_prepare_binary(&plan, VECTOR_OP_ADD, vec1, vec2, result, 0) == VECTOR_SUCCESS);
+
+        timer_start();
+        for (int i = 0; i < BENCH_CALLS; i++){
+            switch_add(vec1, vec2, result);
+        }
+        timer_end(&switch_time);
+
+        timer_start();
+        for (int i = 0; i < BENCH_CALLS; i++){
+            vec_add(vec1, vec2, result);
+        }
+        timer_end(&table_time);
+
+        timer_start();
+        for (int i = 0; i < BENCH_CALLS; i++){
+            vec_run_binary(&plan, vec1, vec2, result);
+        }
+        timer_end(&prepared_time);
+
+        vector_check_canary(result);
+
+        if (verbose){
+            ESP_LOGI("vector_bench_dispatch", "size %d x %d calls: switch_time: %d, table_time: %d, prepared_time: %d",
+                     (int)bench_sizes[s], BENCH_CALLS, (int)switch_time, (int)table_time, (int)prepared_time);
+        }
+
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(vec2);
+        vector_destroy(result);
+    }
+    timer_deinit();
+}
@@ -0,0 +1,5 @@
+#include "vector.h"
+
+void vector_test_prepared_binary(bool verbose, dtype type);
+void vector_test_prepared_unary(bool verbose, dtype type);
+void vector_bench_dispatch(bool verbose, dtype type);
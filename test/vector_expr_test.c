@@ -0,0 +1,257 @@
+#include "vector.h"
+#include "vector_expr.h"
+#include "vector_basic_functions.h"
+#include "vector_test_helper.h"
+#include "vector_expr_test.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_EXPR_SIZE (4 * MAX_SIZE)                                    // Spans several VECTOR_EXPR_TILE tiles
+
+// Post-shift that keeps products (and sums of them) of random operands in range
+static unsigned int expr_test_shift(dtype type){
+    return (type == DTYPE_FLOAT32) ? 0 : 4 * sizeof_dtype(type);
+}
+
+/**
+ * Evaluates abs((a + b) * c >> shift) as one expression and compares it with the same chain of
+ * vec_* calls, both into a separate result and into one of its own inputs.
+ */
+void vector_test_expr_eval(bool verbose, dtype type){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t expr_time = 0;
+    const unsigned int shift = expr_test_shift(type);
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_EXPR_SIZE;                     // Random vector sizes
+        vector_t *vec1 = create_test_vector(test_size, type);           // Allocating the test vectors
+        vector_t *vec2 = create_test_vector(test_size, type);
+        vector_t *vec3 = create_test_vector(test_size, type);
+        vector_t *expr_result = create_test_vector(test_size, type);
+        vector_t *vec_result = create_test_vector(test_size, type);
+
+        assert(vec1);                                                   // Check if valid
+        assert(vec2);
+        assert(vec3);
+        assert(expr_result);
+        assert(vec_result);
+
+        fill_test_vector(vec1);                                         // Fill with random values in range
+        fill_test_vector(vec2);
+        fill_test_vector(vec3);
+
+        vector_t *vec1_copy = vector_create(vec1->size, vec1->type);    // Creating a copy (to check for modification of inputs)
+        vec_copy(vec1, vec1_copy);
+
+        timer_start();                                                  // Unfused chain is the reference
+        assert(vec_add(vec1, vec2, vec_result) == VECTOR_SUCCESS);
+        assert(vec_mul(vec_result, vec3, vec_result, shift) == VECTOR_SUCCESS);
+        assert(vec_abs(vec_result, vec_result) == VECTOR_SUCCESS);
+        timer_end(&vec_time);
+
+        vector_expr_t expr;
+        vec_expr_init(&expr);
+        int a = vec_expr_input(&expr, vec1);
+        int b = vec_expr_input(&expr, vec2);
+        int c = vec_expr_input(&expr, vec3);
+        int sum = vec_expr_binary(&expr, VECTOR_OP_ADD, a, b, 0);
+        int prod = vec_expr_binary(&expr, VECTOR_OP_MUL, sum, c, shift);
+        int root = vec_expr_unary(&expr, VECTOR_OP_ABS, prod);
+        assert(root >= 0);
+
+        timer_start();                                                  // Running tests
+        assert(vec_expr_eval(&expr, root, expr_result) == VECTOR_SUCCESS);
+        timer_end(&expr_time);
+
+        vector_assert_eq(expr_result, vec_result);                      // Check results
+        vector_assert_eq(vec1, vec1_copy);                              // Check modification of inputs
+
+        assert(vec_expr_eval(&expr, a, expr_result) == VECTOR_SUCCESS);  // A bare input evaluates to a copy
+        vector_assert_eq(expr_result, vec1);
+
+        assert(vec_expr_eval(&expr, root, vec1) == VECTOR_SUCCESS);     // Result aliasing an input
+        vector_assert_eq(vec1, vec_result);
+
+        vector_check_canary(vec1);                                      // Check modification of canary region
+        vector_check_canary(vec2);
+        vector_check_canary(vec3);
+        vector_check_canary(expr_result);
+        vector_check_canary(vec_result);
+
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(vec2);
+        vector_destroy(vec3);
+        vector_destroy(vec1_copy);
+        vector_destroy(expr_result);
+        vector_destroy(vec_result);
+    }
+    timer_deinit();
+    if (verbose){
+        ESP_LOGI("vector_test_expr_eval", "vector_time: %d", vec_time);
+        ESP_LOGI("vector_test_expr_eval", "expr_time: %d", expr_time);
+    }
+}
+
+/**
+ * Sum of squares of a centered vector and sum of a scaled vector, reduced without materializing
+ * the intermediate, against vec_add_scalar/vec_mul_scalar followed by vec_dotp/vec_sum.
+ */
+void vector_test_expr_reduce(bool verbose, dtype type){
+    timer_init();
+    set_rand_seed();
+
+    uint32_t vec_time = 0;                                              // Runtime logs
+    uint32_t expr_time = 0;
+    const unsigned int shift = expr_test_shift(type);
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_EXPR_SIZE;                     // Random vector sizes
+        vector_t *vec1 = create_test_vector(test_size, type);
+        vector_t *scratch = create_test_vector(test_size, type);
+        assert(vec1);
+        assert(scratch);
+        fill_test_vector(vec1);
+
+        vector_expr_t expr;
+        vec_expr_init(&expr);
+        int x = vec_expr_input(&expr, vec1);
+
+        if (type == DTYPE_FLOAT32){
+            float offset = rand_float_val();
+            float vec_dotp_result, vec_sum_result, expr_dotp_result, expr_sum_result;
+
+            timer_start();
+            assert(vec_add_scalar_f32(vec1, -offset, scratch) == VECTOR_SUCCESS);
+            assert(vec_dotp_f32(scratch, scratch, &vec_dotp_result) == VECTOR_SUCCESS);
+            assert(vec_mul_scalar_f32(vec1, 0.5f, scratch) == VECTOR_SUCCESS);
+            assert(vec_sum_f32(scratch, &vec_sum_result) == VECTOR_SUCCESS);
+            timer_end(&vec_time);
+
+            int centered = vec_expr_add_scalar_f32(&expr, x, -offset);
+            int halved = vec_expr_mul_scalar_f32(&expr, x, 0.5f);
+            assert(halved >= 0);
+
+            timer_start();
+            assert(vec_expr_dotp_f32(&expr, centered, centered, &expr_dotp_result) == VECTOR_SUCCESS);
+            assert(vec_expr_sum_f32(&expr, halved, &expr_sum_result) == VECTOR_SUCCESS);
+            timer_end(&expr_time);
+
+            assert(float_eq(expr_dotp_result, vec_dotp_result));
+            assert(float_eq(expr_sum_result, vec_sum_result));
+        } else {
+            int offset = rand_scalar_val(type) / 4;
+            int32_t vec_dotp_result, vec_sum_result, expr_dotp_result, expr_sum_result;
+
+            timer_start();
+            assert(vec_add_scalar(vec1, -offset, scratch) == VECTOR_SUCCESS);
+            assert(vec_dotp(scratch, scratch, &vec_dotp_result) == VECTOR_SUCCESS);
+            assert(vec_mul_scalar(vec1, 3, scratch, shift) == VECTOR_SUCCESS);
+            assert(vec_sum(scratch, &vec_sum_result) == VECTOR_SUCCESS);
+            timer_end(&vec_time);
+
+            int centered = vec_expr_add_scalar(&expr, x, -offset);
+            int scaled = vec_expr_mul_scalar(&expr, x, 3, shift);
+            assert(scaled >= 0);
+
+            timer_start();
+            assert(vec_expr_dotp(&expr, centered, centered, &expr_dotp_result) == VECTOR_SUCCESS);
+            assert(vec_expr_sum(&expr, scaled, &expr_sum_result) == VECTOR_SUCCESS);
+            timer_end(&expr_time);
+
+            if (expr_dotp_result != vec_dotp_result || expr_sum_result != vec_sum_result){
+                ESP_LOGE("vector_test_expr_reduce", "Mismatch, dotp: %d vs %d, sum: %d vs %d",
+                         (int)expr_dotp_result, (int)vec_dotp_result, (int)expr_sum_result, (int)vec_sum_result);
+            }
+        }
+
+        vector_check_canary(vec1);                                      // Check modification of canary region
+        vector_check_canary(scratch);
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(scratch);
+    }
+    timer_deinit();
+
+    if (type == DTYPE_INT32){                                           // Saturating lanes must carry across tiles
+        vector_t *vec1 = create_test_vector(3 * VECTOR_EXPR_TILE + 5, type);
+        vector_t *eval = create_test_vector(3 * VECTOR_EXPR_TILE + 5, type);
+        assert(vec1 && eval);
+        int32_t *data = (int32_t*)vec1->data;
+        for (size_t i = 0; i < vec1->size; i++){
+            data[i] = (i % 3) ? INT32_MAX / 2 : INT32_MIN / 2;
+        }
+        vector_expr_t expr;
+        vec_expr_init(&expr);
+        int x = vec_expr_input(&expr, vec1);
+        int doubled = vec_expr_binary(&expr, VECTOR_OP_ADD, x, x, 0);
+        int32_t vec_sum_result, expr_sum_result;
+        assert(vec_expr_eval(&expr, doubled, eval) == VECTOR_SUCCESS);
+        assert(vec_sum(eval, &vec_sum_result) == VECTOR_SUCCESS);
+        assert(vec_expr_sum(&expr, doubled, &expr_sum_result) == VECTOR_SUCCESS);
+        if (expr_sum_result != vec_sum_result){
+            ESP_LOGE("vector_test_expr_reduce", "Saturating sum mismatch: %d vs %d", (int)expr_sum_result, (int)vec_sum_result);
+        }
+        vector_destroy(vec1);
+        vector_destroy(eval);
+    }
+
+    if (verbose){
+        ESP_LOGI("vector_test_expr_reduce", "vector_time: %d", vec_time);
+        ESP_LOGI("vector_test_expr_reduce", "expr_time: %d", expr_time);
+    }
+}
+
+// The first builder error is latched and reported by every later call
+void vector_test_expr_errors(bool verbose, dtype type){
+    (void)verbose;
+    vector_t *vec1 = create_test_vector(8, type);
+    vector_t *vec2 = create_test_vector(9, type);
+    vector_t *result = create_test_vector(8, type);
+    assert(vec1);
+    assert(vec2);
+    assert(result);
+    fill_test_vector(vec1);
+    fill_test_vector(vec2);
+
+    vector_expr_t expr;
+    vec_expr_init(&expr);
+    int a = vec_expr_input(&expr, vec1);
+    assert(a == 0);
+    assert(vec_expr_input(&expr, vec2) == -1);
+    assert(expr.status == VECTOR_SIZE_MISMATCH);
+    assert(vec_expr_unary(&expr, VECTOR_OP_ABS, a) == -1);
+    assert(vec_expr_eval(&expr, a, result) == VECTOR_SIZE_MISMATCH);
+
+    vec_expr_init(&expr);
+    a = vec_expr_input(&expr, vec1);
+    assert(vec_expr_binary(&expr, VECTOR_OP_ADD, a, 5, 0) == -1);   // Unknown operand node
+    assert(expr.status == VECTOR_INVALID_ARGUMENT);
+
+    vec_expr_init(&expr);
+    a = vec_expr_input(&expr, vec1);
+    if (type == DTYPE_FLOAT32){
+        assert(vec_expr_add_scalar(&expr, a, 1) == -1);
+        assert(expr.status == VECTOR_UNSUPPORTED_OPERATION);
+    } else {
+        assert(vec_expr_binary(&expr, VECTOR_OP_ADD, a, a, 1) == -1);   // Shift on a non-MUL op
+        assert(expr.status == VECTOR_INVALID_ARGUMENT);
+        int32_t sum;
+        assert(vec_expr_sum(&expr, a, &sum) == VECTOR_INVALID_ARGUMENT);
+    }
+
+    vec_expr_init(&expr);
+    a = vec_expr_input(&expr, vec1);
+    int node = a;
+    while (node >= 0){                                                  // Runs into the node limit
+        node = vec_expr_unary(&expr, VECTOR_OP_NEG, node);
+    }
+    assert(expr.count == VECTOR_EXPR_MAX_NODES);
+    assert(expr.status == VECTOR_INVALID_ARGUMENT);
+
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+    vector_destroy(result);
+}
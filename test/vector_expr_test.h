@@ -0,0 +1,5 @@
+#include "vector.h"
+
+void vector_test_expr_eval(bool verbose, dtype type);
+void vector_test_expr_reduce(bool verbose, dtype type);
+void vector_test_expr_errors(bool verbose, dtype type);
@@ -0,0 +1,157 @@
+#include "vector.h"
+#include "vector_fft.h"
+#include "vector_test_helper.h"
+#include "vector_fft_test.h"
+#include "esp_log.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_FFT_LOG2 8                                                  // Up to MAX_SIZE complex samples
+#define PI 3.14159265358979323846
+
+static double element(const vector_t *vec, size_t i, int exponent){
+    if (vec->type == DTYPE_INT16){ return ldexp(((int16_t*)vec->data)[i], exponent);}
+    return ((float*)vec->data)[i];
+}
+
+// Direct DFT in double; real input when stride is 1, complex interleaved when 2
+static void dft_reference(const vector_t *input, size_t n, bool real, bool inverse, double *out){
+    const double sign = inverse ? 1.0 : -1.0;
+    for (size_t k = 0; k < n; k++){
+        double re = 0.0, im = 0.0;
+        for (size_t t = 0; t < n; t++){
+            double xr = real ? element(input, t, 0) : element(input, 2 * t, 0);
+            double xi = real ? 0.0 : element(input, 2 * t + 1, 0);
+            double a = sign * 2.0 * PI * (double)((k * t) % n) / (double)n;
+            re += xr * cos(a) - xi * sin(a);
+            im += xr * sin(a) + xi * cos(a);
+        }
+        out[2 * k] = inverse ? re / n : re;
+        out[2 * k + 1] = inverse ? im / n : im;
+    }
+}
+
+// Error energy relative to signal energy over count values
+static void check_snr(const double *expected, const vector_t *actual, size_t count, int exponent, const char *what){
+    double signal = 0.0, noise = 0.0;
+    for (size_t i = 0; i < count; i++){
+        double e = expected[i] - element(actual, i, exponent);
+        signal += expected[i] * expected[i];
+        noise += e * e;
+    }
+    const double limit = (actual->type == DTYPE_INT16) ? 1e-4 : 1e-10;  // About 40 dB for Q15 block floating point
+    if (noise > limit * signal){
+        ESP_LOGE("vector_test_fft", "%s: noise/signal %g for %u values", what, noise / signal, (unsigned)count);
+    }
+}
+
+static void check_fft(dtype type, size_t n){
+    vector_t *input = create_test_vector(2 * n, type);
+    vector_t *data = create_test_vector(2 * n, type);
+    double *expected = malloc(2 * n * sizeof(double));
+    assert(input && data && expected);
+    fill_test_vector(input);
+    const size_t elem = sizeof_dtype(type);
+    int exponent = 0;
+
+    memcpy(data->data, input->data, 2 * n * elem);
+    assert(vec_fft(data, &exponent) == VECTOR_SUCCESS);
+    dft_reference(input, n, false, false, expected);
+    check_snr(expected, data, 2 * n, exponent, "fft");
+
+    memcpy(data->data, input->data, 2 * n * elem);
+    assert(vec_ifft(data, &exponent) == VECTOR_SUCCESS);
+    dft_reference(input, n, false, true, expected);
+    check_snr(expected, data, 2 * n, exponent, "ifft");
+
+    if (n >= 4){                                                        // The n real samples of input, spectrum in data + 2
+        vector_t *spectrum = create_test_vector(n + 2, type);
+        vector_t real;
+        assert(spectrum);
+        assert(vector_set_unaligned(&real, input->data, n, type) == VECTOR_SUCCESS);
+        assert(vec_rfft(&real, spectrum, &exponent) == VECTOR_SUCCESS);
+        dft_reference(&real, n, true, false, expected);
+        check_snr(expected, spectrum, n + 2, exponent, "rfft");
+        assert(vector_check_canary(spectrum));
+        vector_destroy(spectrum);
+    }
+
+    assert(vector_check_canary(data));
+    free(expected);
+    vector_destroy(input);
+    vector_destroy(data);
+}
+
+static void check_round_trip(dtype type, size_t n){
+    vector_t *input = create_test_vector(2 * n, type);
+    vector_t *data = create_test_vector(2 * n, type);
+    double *expected = malloc(2 * n * sizeof(double));
+    assert(input && data && expected);
+    fill_test_vector(input);
+    memcpy(data->data, input->data, 2 * n * sizeof_dtype(type));
+
+    int e1 = 0, e2 = 0;
+    assert(vec_fft(data, &e1) == VECTOR_SUCCESS);
+    assert(vec_ifft(data, &e2) == VECTOR_SUCCESS);
+    for (size_t i = 0; i < 2 * n; i++){ expected[i] = element(input, i, 0);}
+    check_snr(expected, data, 2 * n, e1 + e2, "round trip");
+
+    free(expected);
+    vector_destroy(input);
+    vector_destroy(data);
+}
+
+static void check_errors(dtype type){
+    int exponent;
+    vector_t *vec = create_test_vector(24, type);                      // 12 complex samples
+    vector_t *small = create_test_vector(2, type);
+    assert(vec && small);
+    fill_test_vector(vec);
+
+    if (type != DTYPE_INT16 && type != DTYPE_FLOAT32){
+        assert(vec_fft(vec, &exponent) == VECTOR_UNSUPPORTED_OPERATION);
+        assert(vector_fft_init(16, type) == VECTOR_UNSUPPORTED_OPERATION);
+    } else {
+        assert(vec_fft(NULL, &exponent) == VECTOR_NULL);
+        assert(vec_fft(vec, &exponent) == VECTOR_INVALID_ARGUMENT);
+        assert(vec_ifft(vec, &exponent) == VECTOR_INVALID_ARGUMENT);
+        assert(vector_fft_init(12, type) == VECTOR_INVALID_ARGUMENT);
+        assert(vector_fft_init(2 * VECTOR_FFT_MAX_SIZE, type) == VECTOR_INVALID_ARGUMENT);
+        assert(vector_fft_init(16, type) == VECTOR_SUCCESS);
+        if (type == DTYPE_INT16){
+            vec->size = 16;
+            assert(vec_fft(vec, NULL) == VECTOR_NULL);
+            vec->size = 24;
+        }
+
+        vector_t view;                                                  // 8 complex samples off the 16-byte grid
+        assert(vector_set_unaligned(&view, (uint8_t*)vec->data + sizeof_dtype(type), 16, type) == VECTOR_SUCCESS);
+        assert(vec_fft(&view, &exponent) == VECTOR_UNALIGNED_DATA);
+
+        vector_t real;
+        assert(vector_set_unaligned(&real, vec->data, 8, type) == VECTOR_SUCCESS);
+        assert(vec_rfft(&real, vec, &exponent) == VECTOR_SIZE_MISMATCH);
+        assert(vec_rfft(&real, small, &exponent) == VECTOR_SIZE_MISMATCH);
+        real.size = 2;
+        assert(vec_rfft(&real, small, &exponent) == VECTOR_INVALID_ARGUMENT);
+    }
+
+    vector_destroy(vec);
+    vector_destroy(small);
+}
+
+void vector_test_fft(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    if (type == DTYPE_INT16 || type == DTYPE_FLOAT32){
+        for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+            size_t n = (size_t)1 << (1 + rand() % MAX_FFT_LOG2);
+            check_fft(type, n);
+            check_round_trip(type, n);
+        }
+    }
+    check_errors(type);
+    vector_fft_deinit();
+}
@@ -0,0 +1,3 @@
+#include "vector.h"
+
+void vector_test_fft(bool verbose, dtype type);
@@ -0,0 +1,370 @@
+#include "vector.h"
+#include "vector_filter.h"
+#include "vector_test_helper.h"
+#include "vector_filter_test.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#define MAX_SIGNAL (4 * MAX_SIZE)                                       // Longer than one VECTOR_FIR_TILE
+#define MAX_TAPS 64
+#define MAX_BLOCK 100
+#define MAX_STAGES 4
+#define MAX_CHANNELS 12                                                 // More than one INT16 lane group
+
+// Direct-form reference over the whole signal, Q15 rounding and saturation as documented
+static void fir_reference(const vector_t *input, const vector_t *taps, vector_t *expected){
+    for (size_t n = 0; n < input->size; n++){
+        if (input->type == DTYPE_INT16){
+            const int16_t *x = input->data, *h = taps->data;
+            int64_t acc = 0;
+            for (size_t k = 0; k < taps->size && k <= n; k++){ acc += (int32_t)x[n - k] * h[k];}
+            acc = (acc + (1 << 14)) >> 15;
+            if (acc > INT16_MAX){ acc = INT16_MAX;}
+            if (acc < INT16_MIN){ acc = INT16_MIN;}
+            ((int16_t*)expected->data)[n] = (int16_t)acc;
+        } else {
+            const float *x = input->data, *h = taps->data;
+            float acc = 0.0f;
+            for (size_t k = 0; k < taps->size && k <= n; k++){ acc += x[n - k] * h[k];}
+            ((float*)expected->data)[n] = acc;
+        }
+    }
+}
+
+static void check_filter_eq(const vector_t *expected, const vector_t *actual, const char *what){
+    for (size_t i = 0; i < expected->size; i++){
+        bool ok = (expected->type == DTYPE_INT16)
+            ? ((int16_t*)expected->data)[i] == ((int16_t*)actual->data)[i]
+            : float_eq(((float*)expected->data)[i], ((float*)actual->data)[i]);
+        if (!ok){
+            ESP_LOGE("vector_test_filter", "%s mismatch at %u of %u", what, (unsigned)i, (unsigned)expected->size);
+            return;
+        }
+    }
+}
+
+static void check_fir(dtype type, size_t ntaps, size_t signal){
+    vector_t *input = create_test_vector(signal, type);
+    vector_t *taps = create_test_vector(ntaps, type);
+    vector_t *expected = create_test_vector(signal, type);
+    vector_t *output = create_test_vector(signal, type);
+    vector_t *inplace = create_test_vector(signal, type);
+    assert(input && taps && expected && output && inplace);
+    fill_test_vector(input);
+    fill_test_vector(taps);
+    fir_reference(input, taps, expected);
+
+    vector_fir_state_t fir;
+    assert(vector_fir_init(&fir, ntaps, type) == VECTOR_SUCCESS);
+
+    const size_t elem = sizeof_dtype(type);
+    for (size_t off = 0; off < signal;){                                // Random blocks, empty ones included
+        size_t n = rand() % (MAX_BLOCK + 1);
+        if (n > signal - off){ n = signal - off;}
+        vector_t in_block, out_block;
+        assert(vector_set_unaligned(&in_block, (uint8_t*)input->data + off * elem, n, type) == VECTOR_SUCCESS);
+        assert(vector_set_unaligned(&out_block, (uint8_t*)output->data + off * elem, n, type) == VECTOR_SUCCESS);
+        assert(vec_fir(&in_block, taps, &fir, &out_block) == VECTOR_SUCCESS);
+        off += n;
+    }
+    check_filter_eq(expected, output, "streamed");
+
+    vector_fir_reset(&fir);                                             // Same signal again, one in-place call
+    memcpy(inplace->data, input->data, signal * elem);
+    assert(vec_fir(inplace, taps, &fir, inplace) == VECTOR_SUCCESS);
+    check_filter_eq(expected, inplace, "in-place");
+
+    assert(vector_check_canary(output) && vector_check_canary(inplace));
+    vector_fir_deinit(&fir);
+    vector_destroy(input);
+    vector_destroy(taps);
+    vector_destroy(expected);
+    vector_destroy(output);
+    vector_destroy(inplace);
+}
+
+static void check_errors(dtype type){
+    vector_fir_state_t fir;
+    if (type != DTYPE_INT16 && type != DTYPE_FLOAT32){
+        assert(vector_fir_init(&fir, 8, type) == VECTOR_UNSUPPORTED_OPERATION);
+        return;
+    }
+    assert(vector_fir_init(NULL, 8, type) == VECTOR_NULL);
+    assert(vector_fir_init(&fir, 0, type) == VECTOR_INVALID_ARGUMENT);
+    if (type == DTYPE_INT16){
+        assert(vector_fir_init(&fir, VECTOR_FIR_MAX_TAPS_I16 + 1, type) == VECTOR_INVALID_ARGUMENT);
+    }
+    assert(vector_fir_init(&fir, 8, type) == VECTOR_SUCCESS);
+
+    dtype other = (type == DTYPE_INT16) ? DTYPE_FLOAT32 : DTYPE_INT16;
+    vector_t *taps = create_test_vector(8, type);
+    vector_t *short_taps = create_test_vector(7, type);
+    vector_t *vec1 = create_test_vector(16, type);
+    vector_t *vec2 = create_test_vector(17, type);
+    vector_t *wrong = create_test_vector(16, other);
+    assert(taps && short_taps && vec1 && vec2 && wrong);
+    fill_test_vector(taps);
+    fill_test_vector(vec1);
+
+    assert(vec_fir(NULL, taps, &fir, vec1) == VECTOR_NULL);
+    assert(vec_fir(vec1, taps, NULL, vec1) == VECTOR_NULL);
+    assert(vec_fir(vec1, short_taps, &fir, vec1) == VECTOR_SIZE_MISMATCH);
+    assert(vec_fir(vec1, taps, &fir, vec2) == VECTOR_SIZE_MISMATCH);
+    assert(vec_fir(wrong, taps, &fir, wrong) == VECTOR_TYPE_MISMATCH);
+
+    vector_fir_deinit(&fir);
+    vector_destroy(taps);
+    vector_destroy(short_taps);
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+    vector_destroy(wrong);
+}
+
+// Stable random sections: |a1| <= 0.5 and |a2| <= 0.25 keep every pole inside the unit circle
+static void fill_biquad_coeffs(vector_t *coeffs){
+    for (size_t i = 0; i < coeffs->size; i++){
+        const int scale = (i % 5 == 3) ? 2 : (i % 5 == 4) ? 4 : 1;
+        if (coeffs->type == DTYPE_INT16){
+            ((int16_t*)coeffs->data)[i] = (int16_t)((rand() % 32768 - 16384) / scale);       // Q14
+        } else {
+            ((float*)coeffs->data)[i] = ((float)rand() / RAND_MAX * 2.0f - 1.0f) / scale;
+        }
+    }
+}
+
+// Channel-by-channel direct form I reference with the documented Q14 / fused multiply-add arithmetic
+static void biquad_reference(const vector_t *input, const vector_t *coeffs, size_t channels, vector_t *expected){
+    const size_t stages = coeffs->size / 5;
+    const size_t frames = input->size / channels;
+    for (size_t ch = 0; ch < channels; ch++){
+        double d[MAX_STAGES][4] = {{0}};                                // x1, x2, y1, y2; exact for both dtypes
+        for (size_t n = 0; n < frames; n++){
+            const size_t i = n * channels + ch;
+            if (input->type == DTYPE_INT16){
+                const int16_t *c = coeffs->data;
+                int16_t x = ((int16_t*)input->data)[i];
+                for (size_t s = 0; s < stages; s++){
+                    const int16_t *k = c + 5 * s;
+                    int32_t na1 = (k[3] == INT16_MIN) ? INT16_MAX : -k[3];
+                    int32_t na2 = (k[4] == INT16_MIN) ? INT16_MAX : -k[4];
+                    int64_t acc = (int64_t)x * k[0] + (int64_t)d[s][0] * k[1] + (int64_t)d[s][1] * k[2]
+                                + (int64_t)d[s][2] * na1 + (int64_t)d[s][3] * na2;
+                    acc >>= 14;
+                    if (acc > INT16_MAX){ acc = INT16_MAX;}
+                    if (acc < INT16_MIN){ acc = INT16_MIN;}
+                    d[s][1] = d[s][0]; d[s][0] = x;
+                    d[s][3] = d[s][2]; d[s][2] = (double)acc;
+                    x = (int16_t)acc;
+                }
+                ((int16_t*)expected->data)[i] = x;
+            } else {
+                const float *c = coeffs->data;
+                float x = ((float*)input->data)[i];
+                for (size_t s = 0; s < stages; s++){
+                    const float *k = c + 5 * s;
+                    float y = x * k[0];
+                    y = fmaf((float)d[s][0], k[1], y);
+                    y = fmaf((float)d[s][1], k[2], y);
+                    y = fmaf((float)d[s][2], -k[3], y);
+                    y = fmaf((float)d[s][3], -k[4], y);
+                    d[s][1] = d[s][0]; d[s][0] = x;
+                    d[s][3] = d[s][2]; d[s][2] = y;
+                    x = y;
+                }
+                ((float*)expected->data)[i] = x;
+            }
+        }
+    }
+}
+
+static void check_biquad(dtype type, size_t stages, size_t channels, size_t frames){
+    const size_t size = frames * channels;
+    vector_t *input = create_test_vector(size, type);
+    vector_t *coeffs = create_test_vector(5 * stages, type);
+    vector_t *expected = create_test_vector(size, type);
+    vector_t *output = create_test_vector(size, type);
+    vector_t *inplace = create_test_vector(size, type);
+    assert(input && coeffs && expected && output && inplace);
+    fill_test_vector(input);
+    fill_biquad_coeffs(coeffs);
+    biquad_reference(input, coeffs, channels, expected);
+
+    vector_biquad_state_t biquad;
+    assert(vector_biquad_init(&biquad, stages, channels, type) == VECTOR_SUCCESS);
+
+    const size_t frame = channels * sizeof_dtype(type);
+    for (size_t off = 0; off < frames;){                                // Random blocks of whole frames
+        size_t n = rand() % (MAX_BLOCK + 1);
+        if (n > frames - off){ n = frames - off;}
+        vector_t in_block, out_block;
+        assert(vector_set_unaligned(&in_block, (uint8_t*)input->data + off * frame, n * channels, type) == VECTOR_SUCCESS);
+        assert(vector_set_unaligned(&out_block, (uint8_t*)output->data + off * frame, n * channels, type) == VECTOR_SUCCESS);
+        assert(vec_biquad_cascade(&in_block, coeffs, &biquad, &out_block) == VECTOR_SUCCESS);
+        off += n;
+    }
+    check_filter_eq(expected, output, "biquad streamed");
+
+    vector_biquad_reset(&biquad);
+    memcpy(inplace->data, input->data, size * sizeof_dtype(type));
+    assert(vec_biquad_cascade(inplace, coeffs, &biquad, inplace) == VECTOR_SUCCESS);
+    check_filter_eq(expected, inplace, "biquad in-place");
+
+    assert(vector_check_canary(output) && vector_check_canary(inplace));
+    vector_biquad_deinit(&biquad);
+    vector_destroy(input);
+    vector_destroy(coeffs);
+    vector_destroy(expected);
+    vector_destroy(output);
+    vector_destroy(inplace);
+}
+
+static void check_biquad_errors(dtype type){
+    vector_biquad_state_t biquad;
+    if (type != DTYPE_INT16 && type != DTYPE_FLOAT32){
+        assert(vector_biquad_init(&biquad, 1, 1, type) == VECTOR_UNSUPPORTED_OPERATION);
+        return;
+    }
+    assert(vector_biquad_init(NULL, 1, 1, type) == VECTOR_NULL);
+    assert(vector_biquad_init(&biquad, 0, 1, type) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_biquad_init(&biquad, 1, 0, type) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_biquad_init(&biquad, 2, 3, type) == VECTOR_SUCCESS);
+
+    dtype other = (type == DTYPE_INT16) ? DTYPE_FLOAT32 : DTYPE_INT16;
+    vector_t *coeffs = create_test_vector(10, type);
+    vector_t *short_coeffs = create_test_vector(5, type);
+    vector_t *vec1 = create_test_vector(12, type);
+    vector_t *vec2 = create_test_vector(13, type);
+    vector_t *wrong = create_test_vector(12, other);
+    assert(coeffs && short_coeffs && vec1 && vec2 && wrong);
+    fill_biquad_coeffs(coeffs);
+    fill_test_vector(vec1);
+    fill_test_vector(vec2);
+
+    assert(vec_biquad_cascade(NULL, coeffs, &biquad, vec1) == VECTOR_NULL);
+    assert(vec_biquad_cascade(vec1, coeffs, NULL, vec1) == VECTOR_NULL);
+    assert(vec_biquad_cascade(vec1, short_coeffs, &biquad, vec1) == VECTOR_SIZE_MISMATCH);
+    assert(vec_biquad_cascade(vec1, coeffs, &biquad, vec2) == VECTOR_SIZE_MISMATCH);
+    assert(vec_biquad_cascade(vec2, coeffs, &biquad, vec2) == VECTOR_SIZE_MISMATCH);   // 13 is not whole 3-channel frames
+    assert(vec_biquad_cascade(wrong, coeffs, &biquad, wrong) == VECTOR_TYPE_MISMATCH);
+
+    vector_biquad_deinit(&biquad);
+    vector_destroy(coeffs);
+    vector_destroy(short_coeffs);
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+    vector_destroy(wrong);
+}
+
+void vector_test_fir(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    if (type == DTYPE_INT16 || type == DTYPE_FLOAT32){
+        for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+            size_t ntaps = 1 + rand() % MAX_TAPS;                       // Padded to the kernel block when not a multiple
+            size_t signal = 1 + rand() % MAX_SIGNAL;
+            check_fir(type, ntaps, signal);
+        }
+    }
+    check_errors(type);
+}
+
+void vector_test_biquad(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    if (type == DTYPE_INT16 || type == DTYPE_FLOAT32){
+        for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+            size_t stages = 1 + rand() % MAX_STAGES;
+            size_t channels = 1 + rand() % MAX_CHANNELS;
+            size_t frames = 1 + rand() % MAX_SIGNAL;
+            check_biquad(type, stages, channels, frames);
+        }
+    }
+    check_biquad_errors(type);
+}
+
+static double xcorr_element(const vector_t *vec, size_t i){
+    switch (vec->type){
+        case DTYPE_INT8:  return ((int8_t*)vec->data)[i];
+        case DTYPE_INT16: return ((int16_t*)vec->data)[i];
+        default:          return ((float*)vec->data)[i];
+    }
+}
+
+static void check_xcorr(dtype type, size_t size, size_t max_lag, bool autocorr){
+    const dtype out_type = (type == DTYPE_FLOAT32) ? DTYPE_FLOAT32 : DTYPE_INT32;
+    vector_t *vec1 = create_test_vector(size, type);
+    vector_t *vec2 = autocorr ? vec1 : create_test_vector(size, type);
+    vector_t *result = create_test_vector(max_lag + 1, out_type);
+    assert(vec1 && vec2 && result);
+    fill_test_vector(vec1);
+    if (!autocorr){ fill_test_vector(vec2);}
+
+    assert((autocorr ? vec_autocorr(vec1, max_lag, result) : vec_xcorr(vec1, vec2, max_lag, result)) == VECTOR_SUCCESS);
+    for (size_t l = 0; l <= max_lag; l++){
+        int64_t exact = 0;                                              // Integer reference, exact in 64 bits
+        double expected = 0.0;
+        for (size_t n = 0; n + l < size; n++){
+            expected += xcorr_element(vec1, n) * xcorr_element(vec2, n + l);
+            exact += (int64_t)xcorr_element(vec1, n) * (int64_t)xcorr_element(vec2, n + l);
+        }
+        bool ok = (type == DTYPE_FLOAT32)
+            ? float_eq((float)expected, ((float*)result->data)[l])
+            : (int32_t)(uint32_t)exact == ((int32_t*)result->data)[l];  // Low 32 bits, as vec_dotp
+        if (!ok){
+            ESP_LOGE("vector_test_filter", "xcorr mismatch at lag %u of %u (size %u)", (unsigned)l, (unsigned)max_lag, (unsigned)size);
+            break;
+        }
+    }
+
+    assert(vector_check_canary(result));
+    vector_destroy(result);
+    if (!autocorr){ vector_destroy(vec2);}
+    vector_destroy(vec1);
+}
+
+static void check_xcorr_errors(dtype type){
+    const bool supported = type == DTYPE_INT8 || type == DTYPE_INT16 || type == DTYPE_FLOAT32;
+    const dtype out_type = (type == DTYPE_FLOAT32) ? DTYPE_FLOAT32 : DTYPE_INT32;
+    vector_t *vec1 = create_test_vector(16, type);
+    vector_t *vec2 = create_test_vector(17, type);
+    vector_t *result = create_test_vector(4, out_type);
+    vector_t *wrong = create_test_vector(4, out_type == DTYPE_INT32 ? DTYPE_FLOAT32 : DTYPE_INT32);
+    assert(vec1 && vec2 && result && wrong);
+    fill_test_vector(vec1);
+    fill_test_vector(vec2);
+
+    if (!supported){
+        assert(vec_autocorr(vec1, 3, result) == VECTOR_UNSUPPORTED_OPERATION);
+    } else {
+        assert(vec_xcorr(NULL, vec1, 3, result) == VECTOR_NULL);
+        assert(vec_xcorr(vec1, vec2, 3, result) == VECTOR_SIZE_MISMATCH);
+        assert(vec_autocorr(vec1, 4, result) == VECTOR_SIZE_MISMATCH);
+        assert(vec_autocorr(vec1, 3, wrong) == VECTOR_TYPE_MISMATCH);
+        vec1->size = 3;
+        assert(vec_autocorr(vec1, 3, result) == VECTOR_INVALID_ARGUMENT);
+        vec1->size = 16;
+    }
+
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+    vector_destroy(result);
+    vector_destroy(wrong);
+}
+
+void vector_test_xcorr(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    if (type == DTYPE_INT8 || type == DTYPE_INT16 || type == DTYPE_FLOAT32){
+        for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+            size_t size = 1 + rand() % MAX_SIZE;
+            size_t max_lag = rand() % size;
+            check_xcorr(type, size, max_lag, run_num & 1);
+        }
+    }
+    check_xcorr_errors(type);
+}
@@ -0,0 +1,5 @@
+#include "vector.h"
+
+void vector_test_fir(bool verbose, dtype type);
+void vector_test_biquad(bool verbose, dtype type);
+void vector_test_xcorr(bool verbose, dtype type);
@@ -0,0 +1,251 @@
+#include "vector.h"
+#include "vector_basic_functions.h"
+#include "vector_bitwise_functions.h"
+#include "vector_parallel.h"
+#include "vector_test_helper.h"
+#include "vector_parallel_test.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define PARALLEL_TEST_MIN_SIZE 64                                       // Low threshold so every test size splits
+#define MAX_PARALLEL_SIZE (8 * MAX_SIZE)
+#define BENCH_REPEATS 64
+
+// Same call with parallel mode off and on; the results must agree
+static void check_elementwise(vector_t *vec1, vector_t *vec2, vector_t *expected, vector_t *actual){
+    const size_t bytes = vec1->size * sizeof_dtype(vec1->type);
+    const unsigned int shift = (vec1->type == DTYPE_FLOAT32) ? 0 : 2 * sizeof_dtype(vec1->type);
+
+    assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+    assert(vec_add(vec1, vec2, expected) == VECTOR_SUCCESS);
+    assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+    assert(vec_add(vec1, vec2, actual) == VECTOR_SUCCESS);
+    if (memcmp(expected->data, actual->data, bytes) != 0){
+        ESP_LOGE("vector_test_parallel", "vec_add mismatch at size %d", (int)vec1->size);
+    }
+
+    assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+    assert(vec_mul(vec1, vec2, expected, shift) == VECTOR_SUCCESS);
+    assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+    assert(vec_mul(vec1, vec2, actual, shift) == VECTOR_SUCCESS);
+    if (memcmp(expected->data, actual->data, bytes) != 0){
+        ESP_LOGE("vector_test_parallel", "vec_mul mismatch at size %d", (int)vec1->size);
+    }
+
+    assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+    assert(vec_abs(vec1, expected) == VECTOR_SUCCESS);
+    assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+    assert(vec_abs(vec1, actual) == VECTOR_SUCCESS);
+    if (memcmp(expected->data, actual->data, bytes) != 0){
+        ESP_LOGE("vector_test_parallel", "vec_abs mismatch at size %d", (int)vec1->size);
+    }
+}
+
+static void check_reductions(const vector_t *vec1, const vector_t *vec2){
+    switch (vec1->type){
+        case DTYPE_FLOAT32: {
+            float expected, actual;
+            assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+            assert(vec_sum_f32(vec1, &expected) == VECTOR_SUCCESS);
+            assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+            assert(vec_sum_f32(vec1, &actual) == VECTOR_SUCCESS);
+            assert(float_eq(expected, actual));
+            assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+            assert(vec_dotp_f32(vec1, vec2, &expected) == VECTOR_SUCCESS);
+            assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+            assert(vec_dotp_f32(vec1, vec2, &actual) == VECTOR_SUCCESS);
+            assert(float_eq(expected, actual));
+            break;
+        }
+        case DTYPE_UINT8:
+        case DTYPE_UINT16:
+        case DTYPE_UINT32: {
+            uint32_t expected, actual;
+            assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+            assert(vec_sum_unsigned(vec1, &expected) == VECTOR_SUCCESS);
+            assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+            assert(vec_sum_unsigned(vec1, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_parallel", "vec_sum_unsigned mismatch: %u vs %u", (unsigned)expected, (unsigned)actual);
+            }
+            break;
+        }
+        default: {
+            int32_t expected, actual;
+            assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+            assert(vec_sum(vec1, &expected) == VECTOR_SUCCESS);
+            assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+            assert(vec_sum(vec1, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_parallel", "vec_sum mismatch: %d vs %d", (int)expected, (int)actual);
+            }
+            assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+            assert(vec_dotp(vec1, vec2, &expected) == VECTOR_SUCCESS);
+            assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+            assert(vec_dotp(vec1, vec2, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_parallel", "vec_dotp mismatch: %d vs %d", (int)expected, (int)actual);
+            }
+            int64_t expected_wide, actual_wide;
+            assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+            assert(vec_dotp_i64(vec1, vec2, &expected_wide) == VECTOR_SUCCESS);
+            assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+            assert(vec_dotp_i64(vec1, vec2, &actual_wide) == VECTOR_SUCCESS);
+            if (expected_wide != actual_wide){
+                ESP_LOGE("vector_test_parallel", "vec_dotp_i64 mismatch: %lld vs %lld", (long long)expected_wide, (long long)actual_wide);
+            }
+            assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+            assert(vec_sum_i64(vec1, &expected_wide) == VECTOR_SUCCESS);
+            assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+            assert(vec_sum_i64(vec1, &actual_wide) == VECTOR_SUCCESS);
+            if (expected_wide != actual_wide){
+                ESP_LOGE("vector_test_parallel", "vec_sum_i64 mismatch: %lld vs %lld", (long long)expected_wide, (long long)actual_wide);
+            }
+            break;
+        }
+    }
+}
+
+// int32 sums saturate per lane, so parallel mode must not change them on saturating input
+static void check_saturating_sum(size_t test_size, size_t offset){
+    uint8_t *buf = heap_caps_aligned_alloc(16, test_size * sizeof(int32_t) + 16, MALLOC_CAP_DEFAULT);
+    assert(buf);
+    vector_t vec;
+    assert(vector_set_unaligned(&vec, buf + offset, test_size, DTYPE_INT32) == VECTOR_SUCCESS);
+    int32_t *data = (int32_t*)vec.data;
+    for (size_t i = 0; i < test_size; i++){
+        data[i] = INT32_MAX;
+    }
+
+    int32_t expected, actual;
+    assert(vector_parallel_set_min_size(0) == VECTOR_SUCCESS);
+    assert(vec_sum(&vec, &expected) == VECTOR_SUCCESS);
+    assert(vector_parallel_set_min_size(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+    assert(vec_sum(&vec, &actual) == VECTOR_SUCCESS);
+    if (expected != actual){
+        ESP_LOGE("vector_test_parallel", "saturating vec_sum mismatch at offset %u: %d vs %d", (unsigned)offset, (int)expected, (int)actual);
+    }
+    heap_caps_free(buf);
+}
+
+void vector_test_parallel(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+    const size_t elem = sizeof_dtype(type);
+    assert(vector_parallel_set_min_size(1) == VECTOR_ERROR);           // Not started yet
+    assert(vector_parallel_init(PARALLEL_TEST_MIN_SIZE) == VECTOR_SUCCESS);
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_PARALLEL_SIZE;                 // Random vector sizes, short ones stay unsplit
+        vector_t *vec1 = create_test_vector(test_size, type);
+        vector_t *vec2 = create_test_vector(test_size, type);
+        vector_t *expected = create_test_vector(test_size, type);
+        vector_t *actual = create_test_vector(test_size, type);
+        assert(vec1 && vec2 && expected && actual);
+        fill_test_vector(vec1);
+        fill_test_vector(vec2);
+
+        check_elementwise(vec1, vec2, expected, actual);
+        check_reductions(vec1, vec2);
+
+        const size_t offset = (rand() % (16 / elem)) * elem;            // Both halves take the unaligned path
+        uint8_t *buf1 = heap_caps_aligned_alloc(16, test_size * elem + 16, MALLOC_CAP_DEFAULT);
+        uint8_t *buf2 = heap_caps_aligned_alloc(16, test_size * elem + 16, MALLOC_CAP_DEFAULT);
+        assert(buf1 && buf2);
+        vector_t u1, u2;
+        assert(vector_set_unaligned(&u1, buf1 + offset, test_size, type) == VECTOR_SUCCESS);
+        assert(vector_set_unaligned(&u2, buf2, test_size, type) == VECTOR_SUCCESS);
+        memcpy(u1.data, vec1->data, test_size * elem);
+        memcpy(u2.data, vec2->data, test_size * elem);
+        check_elementwise(&u1, &u2, expected, actual);
+        check_reductions(&u1, &u2);
+
+        vector_check_canary(expected);
+        vector_check_canary(actual);
+        vector_destroy(vec1);
+        vector_destroy(vec2);
+        vector_destroy(expected);
+        vector_destroy(actual);
+        heap_caps_free(buf1);
+        heap_caps_free(buf2);
+    }
+
+    if (type == DTYPE_INT32){
+        check_saturating_sum(8192, 0);
+        check_saturating_sum(8192 + 3, sizeof(int32_t));
+    }
+
+    assert(vector_parallel_init(0) == VECTOR_SUCCESS);                 // Already running: only the threshold changes
+    vector_parallel_deinit();
+    assert(vector_parallel_set_min_size(1) == VECTOR_ERROR);
+    vector_parallel_deinit();
+}
+
+/**
+ * Scaling of split ops with vector size. Times BENCH_REPEATS calls of vec_add and vec_dotp on one
+ * core and split across two; the size where the split time drops below the serial time is the
+ * break-even to pass to vector_parallel_init().
+ */
+void vector_bench_parallel(bool verbose, dtype type){
+    static const size_t bench_sizes[] = { 256, 1024, 4096, 16384, 65536 };
+
+    timer_init();
+    set_rand_seed();
+    assert(vector_parallel_init(1) == VECTOR_SUCCESS);
+
+    for (size_t s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); s++){
+        uint32_t serial_time = 0;                                       // Runtime logs
+        uint32_t split_time = 0;
+        uint32_t serial_dotp_time = 0;
+        uint32_t split_dotp_time = 0;
+        int32_t dotp;
+        float dotp_f32;
+
+        vector_t *vec1 = create_test_vector(bench_sizes[s], type);
+        vector_t *vec2 = create_test_vector(bench_sizes[s], type);
+        vector_t *result = create_test_vector(bench_sizes[s], type);
+        assert(vec1 && vec2 && result);
+        fill_test_vector(vec1);
+        fill_test_vector(vec2);
+
+        for (int pass = 0; pass < 2; pass++){
+            assert(vector_parallel_set_min_size(pass ? 1 : 0) == VECTOR_SUCCESS);
+            uint32_t add_time = 0;
+            uint32_t dotp_time = 0;
+
+            timer_start();
+            for (int i = 0; i < BENCH_REPEATS; i++){
+                vec_add(vec1, vec2, result);
+            }
+            timer_end(&add_time);
+
+            timer_start();
+            for (int i = 0; i < BENCH_REPEATS; i++){
+                if (type == DTYPE_FLOAT32){
+                    vec_dotp_f32(vec1, vec2, &dotp_f32);
+                } else {
+                    vec_dotp(vec1, vec2, &dotp);
+                }
+            }
+            timer_end(&dotp_time);
+
+            *(pass ? &split_time : &serial_time) = add_time;
+            *(pass ? &split_dotp_time : &serial_dotp_time) = dotp_time;
+        }
+
+        vector_check_canary(result);
+
+        if (verbose){
+            ESP_LOGI("vector_bench_parallel", "size %d x %d calls: add serial: %d, add split: %d, dotp serial: %d, dotp split: %d",
+                     (int)bench_sizes[s], BENCH_REPEATS, (int)serial_time, (int)split_time, (int)serial_dotp_time, (int)split_dotp_time);
+        }
+
+        vector_destroy(vec1);                                           // Free resources
+        vector_destroy(vec2);
+        vector_destroy(result);
+    }
+    vector_parallel_deinit();
+    timer_deinit();
+}
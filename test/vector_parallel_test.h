@@ -0,0 +1,4 @@
+#include "vector.h"
+
+void vector_test_parallel(bool verbose, dtype type);
+void vector_bench_parallel(bool verbose, dtype type);
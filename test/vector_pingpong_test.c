@@ -0,0 +1,139 @@
+#include "vector.h"
+#include "vector_pingpong.h"
+#include "vector_test_helper.h"
+#include "vector_pingpong_test.h"
+#include "esp_log.h"
+#include <stdlib.h>
+
+#define PINGPONG_SIZE 96                                                // Elements per block
+#define PINGPONG_BLOCKS 200                                             // Blocks the threaded producer writes
+
+typedef struct {
+    uint32_t next;                                                      // Number of the next block to write
+    bool done;                                                          // Written and read with __atomic builtins
+} ramp_producer_t;
+
+// Element i of block k; small enough to be exact in every dtype
+static int ramp_value(uint32_t k, size_t i){
+    return (int)((k + i) % 100);
+}
+
+static void set_elem(vector_t *vec, size_t i, int value){
+    switch (vec->type){
+        case DTYPE_INT8:    ((int8_t*)vec->data)[i] = (int8_t)value; break;
+        case DTYPE_INT16:   ((int16_t*)vec->data)[i] = (int16_t)value; break;
+        case DTYPE_INT32:   ((int32_t*)vec->data)[i] = value; break;
+        case DTYPE_FLOAT32: ((float*)vec->data)[i] = (float)value; break;
+        case DTYPE_UINT8:   ((uint8_t*)vec->data)[i] = (uint8_t)value; break;
+        case DTYPE_UINT16:  ((uint16_t*)vec->data)[i] = (uint16_t)value; break;
+        case DTYPE_UINT32:  ((uint32_t*)vec->data)[i] = (uint32_t)value; break;
+        default: break;
+    }
+}
+
+static int get_elem(const vector_t *vec, size_t i){
+    switch (vec->type){
+        case DTYPE_INT8:    return ((int8_t*)vec->data)[i];
+        case DTYPE_INT16:   return ((int16_t*)vec->data)[i];
+        case DTYPE_INT32:   return ((int32_t*)vec->data)[i];
+        case DTYPE_FLOAT32: return (int)((float*)vec->data)[i];
+        case DTYPE_UINT8:   return ((uint8_t*)vec->data)[i];
+        case DTYPE_UINT16:  return ((uint16_t*)vec->data)[i];
+        case DTYPE_UINT32:  return (int)((uint32_t*)vec->data)[i];
+        default: return -1;
+    }
+}
+
+static void fill_block(vector_t *buffer, uint32_t k){
+    for (size_t i = 0; i < buffer->size; i++){
+        set_elem(buffer, i, ramp_value(k, i));
+    }
+}
+
+static vector_status_t ramp_produce(vector_t *buffer, void *ctx){
+    ramp_producer_t *producer = ctx;
+    if (producer->next == PINGPONG_BLOCKS){
+        __atomic_store_n(&producer->done, true, __ATOMIC_RELEASE);
+        return VECTOR_ERROR;                                            // Ends the producer task
+    }
+    fill_block(buffer, producer->next++);
+    return VECTOR_SUCCESS;
+}
+
+// A block must be one whole ramp, never a mix of two producer passes
+static vector_status_t check_block(vector_t *buffer, void *ctx){
+    (void)ctx;
+    uint32_t k = (uint32_t)get_elem(buffer, 0);
+    for (size_t i = 1; i < buffer->size; i++){
+        if (get_elem(buffer, i) != ramp_value(k, i)){
+            ESP_LOGE("vector_test_pingpong", "torn block at %d", (int)i);
+            return VECTOR_ERROR;
+        }
+    }
+    return VECTOR_SUCCESS;
+}
+
+// Ownership transitions, driven step by step from one task
+static void check_protocol(dtype type){
+    vector_pingpong_t pp;
+    assert(vector_pingpong_init(&pp, PINGPONG_SIZE, type, VECTOR_PLACEMENT_DEFAULT) == VECTOR_SUCCESS);
+    assert(vector_pingpong_acquire(&pp) == NULL);                      // Nothing published yet
+
+    vector_t *first = vector_pingpong_fill_buffer(&pp);
+    fill_block(first, 1);
+    assert(vector_pingpong_commit(&pp) == VECTOR_SUCCESS);
+    vector_t *second = vector_pingpong_fill_buffer(&pp);
+    assert(second != first);
+    assert(vector_pingpong_acquire(&pp) == first);                     // Same vector: no copy
+    assert(vector_pingpong_acquire(&pp) == NULL);                      // One block at a time
+
+    fill_block(second, 2);                                              // Consumer still busy: the new block is dropped
+    assert(vector_pingpong_commit(&pp) == VECTOR_SUCCESS);
+    assert(pp.overruns == 1);
+    assert(vector_pingpong_fill_buffer(&pp) == second);
+    assert(vector_pingpong_release(&pp, second) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_pingpong_release(&pp, first) == VECTOR_SUCCESS);
+    assert(vector_pingpong_release(&pp, first) == VECTOR_INVALID_ARGUMENT);
+
+    fill_block(second, 3);
+    assert(vector_pingpong_commit(&pp) == VECTOR_SUCCESS);
+    assert(vector_pingpong_fill_buffer(&pp) == first);
+    fill_block(first, 4);                                               // Consumer behind: the older block is dropped
+    assert(vector_pingpong_commit(&pp) == VECTOR_SUCCESS);
+    assert(pp.overruns == 2);
+    assert(vector_pingpong_fill_buffer(&pp) == second);
+    assert(vector_pingpong_acquire(&pp) == first);
+    assert(get_elem(first, 0) == ramp_value(4, 0));
+    assert(vector_pingpong_release(&pp, first) == VECTOR_SUCCESS);
+    assert(pp.commits == 4 && pp.processed == 2);
+
+    vector_pingpong_deinit(&pp);
+}
+
+// Producer task and consumer running concurrently
+static void check_threaded(dtype type){
+    vector_pingpong_t pp;
+    ramp_producer_t producer = { .next = 0, .done = false };
+    assert(vector_pingpong_init(&pp, PINGPONG_SIZE, type, VECTOR_PLACEMENT_DEFAULT) == VECTOR_SUCCESS);
+    assert(vector_pingpong_start_producer(&pp, ramp_produce, &producer) == VECTOR_SUCCESS);
+    assert(vector_pingpong_start_producer(&pp, ramp_produce, &producer) == VECTOR_INVALID_ARGUMENT);
+
+    while (!__atomic_load_n(&producer.done, __ATOMIC_ACQUIRE)){
+        assert(vector_pingpong_process(&pp, check_block, NULL) == VECTOR_SUCCESS);
+    }
+    vector_pingpong_stop_producer(&pp);
+    while (pp.processed + pp.overruns < pp.commits){                   // Drain the last published block
+        assert(vector_pingpong_process(&pp, check_block, NULL) == VECTOR_SUCCESS);
+    }
+    if (pp.commits != PINGPONG_BLOCKS || pp.processed + pp.overruns != pp.commits){
+        ESP_LOGE("vector_test_pingpong", "commits %u, processed %u, overruns %u",
+                 (unsigned)pp.commits, (unsigned)pp.processed, (unsigned)pp.overruns);
+    }
+    vector_pingpong_deinit(&pp);
+}
+
+void vector_test_pingpong(bool verbose, dtype type){
+    (void)verbose;
+    check_protocol(type);
+    check_threaded(type);
+}
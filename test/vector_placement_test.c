@@ -0,0 +1,138 @@
+#include "vector.h"
+#include "vector_basic_functions.h"
+#include "vector_test_helper.h"
+#include "vector_placement_test.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(ESP_PLATFORM)                                             // Needs the host allocator hook
+
+#define SIM_MAX_BLOCKS 16
+#define SIM_INTERNAL_BYTES 1024                                         // Internal SRAM budget of the simulated heap
+#define SIM_SPIRAM_THRESHOLD 256                                        // Default allocations this large go to PSRAM
+
+/**
+ * Simulated ESP32-S3 heap: a small internal SRAM plus an unlimited PSRAM, with the default heap
+ * preferring PSRAM for large blocks as CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL does. Blocks come from
+ * the host heap and are tagged with the caps they were placed in.
+ */
+typedef struct {
+    struct { void *ptr; size_t size; uint32_t caps; } blocks[SIM_MAX_BLOCKS];
+    size_t internal_used;
+} sim_heap_t;
+
+static void *sim_alloc(size_t alignment, size_t size, uint32_t caps, void *ctx){
+    sim_heap_t *heap = ctx;
+    bool internal;
+    if (caps & MALLOC_CAP_SPIRAM){
+        internal = false;
+    } else if (caps & (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA)){
+        internal = true;
+    } else {
+        internal = size < SIM_SPIRAM_THRESHOLD && heap->internal_used + size <= SIM_INTERNAL_BYTES;
+    }
+    if (internal && heap->internal_used + size > SIM_INTERNAL_BYTES){ return NULL;}
+
+    for (int i = 0; i < SIM_MAX_BLOCKS; i++){
+        if (heap->blocks[i].ptr){ continue;}
+        void *ptr = NULL;
+        if (posix_memalign(&ptr, alignment < sizeof(void *) ? sizeof(void *) : alignment, size) != 0){ return NULL;}
+        heap->blocks[i].ptr = ptr;
+        heap->blocks[i].size = size;
+        heap->blocks[i].caps = MALLOC_CAP_8BIT | (internal ? MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA : MALLOC_CAP_SPIRAM);
+        if (internal){ heap->internal_used += size;}
+        return ptr;
+    }
+    return NULL;
+}
+
+static void sim_free(void *ptr, void *ctx){
+    sim_heap_t *heap = ctx;
+    for (int i = 0; i < SIM_MAX_BLOCKS; i++){
+        if (heap->blocks[i].ptr != ptr){ continue;}
+        if (heap->blocks[i].caps & MALLOC_CAP_INTERNAL){ heap->internal_used -= heap->blocks[i].size;}
+        heap->blocks[i].ptr = NULL;
+        free(ptr);
+        return;
+    }
+    ESP_LOGE("sim_free", "Freeing unknown block %p", ptr);
+}
+
+static uint32_t sim_get_caps(const void *ptr, void *ctx){
+    sim_heap_t *heap = ctx;
+    for (int i = 0; i < SIM_MAX_BLOCKS; i++){
+        const uint8_t *start = heap->blocks[i].ptr;
+        if (start && (const uint8_t*)ptr >= start && (const uint8_t*)ptr < start + heap->blocks[i].size){ return heap->blocks[i].caps;}
+    }
+    return MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL;                      // Stack and statics
+}
+
+/**
+ * Places vectors under the simulated heap: default placement of a large vector lands in PSRAM,
+ * explicit requests are honoured or fail (or fall back), and migration moves the data into
+ * internal RAM unchanged.
+ */
+void vector_test_placement(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    static sim_heap_t heap;
+    memset(&heap, 0, sizeof(heap));
+    const esp_host_heap_hooks_t hooks = { sim_alloc, sim_free, sim_get_caps, &heap };
+    const size_t elem = sizeof_dtype(type);
+    const size_t large = SIM_INTERNAL_BYTES / 2 / elem;                 // Above the PSRAM threshold, fits internal RAM
+
+    esp_host_heap_set_hooks(&hooks);
+
+    vector_t *hot = vector_create(large, type);                         // Silently lands in PSRAM
+    assert(hot);
+    assert(vector_placement(hot) == VECTOR_PLACEMENT_PSRAM);
+    vector_t *small = vector_create_ex(16 / elem, type, VECTOR_PLACEMENT_INTERNAL);
+    assert(small);
+    assert(vector_placement(small) & VECTOR_PLACEMENT_INTERNAL);
+
+    assert(vector_create_ex(2 * large, type, VECTOR_PLACEMENT_INTERNAL) == NULL);    // Exceeds internal RAM
+    vector_t *spill = vector_create_ex(2 * large, type, VECTOR_PLACEMENT_INTERNAL | VECTOR_PLACEMENT_FALLBACK);
+    assert(spill);
+    assert(vector_placement(spill) == VECTOR_PLACEMENT_PSRAM);
+    assert(vector_create_ex(large, type, VECTOR_PLACEMENT_INTERNAL | VECTOR_PLACEMENT_PSRAM) == NULL);
+
+    fill_test_vector(hot);                                              // Migration keeps the contents
+    vector_t *reference = vector_create(large, type);
+    memcpy(reference->data, hot->data, large * elem);
+    assert(vector_migrate(hot, VECTOR_PLACEMENT_INTERNAL) == VECTOR_SUCCESS);
+    assert(vector_placement(hot) & VECTOR_PLACEMENT_INTERNAL);
+    assert(hot->owns_data);
+    vector_assert_eq(hot, reference);
+
+    void *data = hot->data;
+    assert(vector_migrate(hot, VECTOR_PLACEMENT_INTERNAL) == VECTOR_SUCCESS);        // Already there
+    assert(hot->data == data);
+    assert(vector_migrate(spill, VECTOR_PLACEMENT_INTERNAL) == VECTOR_ERROR);        // No room; left in place
+    assert(vector_placement(spill) == VECTOR_PLACEMENT_PSRAM);
+    assert(vector_migrate(hot, VECTOR_PLACEMENT_INTERNAL | VECTOR_PLACEMENT_PSRAM) == VECTOR_INVALID_ARGUMENT);
+
+    assert(vec_add(hot, reference, reference) == VECTOR_SUCCESS);       // Still usable after the move
+
+    vector_destroy(hot);
+    vector_destroy(small);
+    vector_destroy(spill);
+    vector_destroy(reference);
+    esp_host_heap_set_hooks(NULL);
+
+    assert(heap.internal_used == 0);                                    // Everything was freed under the hooks
+    for (int i = 0; i < SIM_MAX_BLOCKS; i++){
+        assert(heap.blocks[i].ptr == NULL);
+    }
+}
+
+#else
+
+void vector_test_placement(bool verbose, dtype type){
+    (void)verbose;
+    (void)type;
+}
+
+#endif
@@ -0,0 +1,208 @@
+#include "vector.h"
+#include "vector_basic_functions.h"
+#include "vector_stream.h"
+#include "vector_test_helper.h"
+#include "vector_stream_test.h"
+#include "esp_log.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_STREAM_SIZE (4 * MAX_SIZE)
+#define MAX_CHUNK 100                                                   // Deliberately not a multiple of 16 bytes
+
+static bool is_unsigned(dtype type){
+    return type == DTYPE_UINT8 || type == DTYPE_UINT16 || type == DTYPE_UINT32;
+}
+
+static int64_t element(const vector_t *vec, size_t i){
+    switch (vec->type){
+        case DTYPE_INT8:   return ((int8_t*)vec->data)[i];
+        case DTYPE_INT16:  return ((int16_t*)vec->data)[i];
+        case DTYPE_INT32:  return ((int32_t*)vec->data)[i];
+        case DTYPE_UINT8:  return ((uint8_t*)vec->data)[i];
+        case DTYPE_UINT16: return ((uint16_t*)vec->data)[i];
+        case DTYPE_UINT32: return ((uint32_t*)vec->data)[i];
+        default: return 0;
+    }
+}
+
+// Feeds vec1 (and vec2) in random chunks at their natural, unaligned offsets
+static void feed(vector_stream_t *stream, const vector_t *vec1, const vector_t *vec2){
+    const size_t elem = sizeof_dtype(vec1->type);
+    for (size_t off = 0; off < vec1->size;){
+        size_t n = rand() % (MAX_CHUNK + 1);                            // Empty chunks included
+        if (n > vec1->size - off){ n = vec1->size - off;}
+        vector_t c1, c2;
+        assert(vector_set_unaligned(&c1, (uint8_t*)vec1->data + off * elem, n, vec1->type) == VECTOR_SUCCESS);
+        assert(vector_set_unaligned(&c2, (uint8_t*)vec2->data + off * elem, n, vec2->type) == VECTOR_SUCCESS);
+        assert(vector_stream_update(stream, &c1, &c2) == VECTOR_SUCCESS);
+        off += n;
+    }
+}
+
+static void check_stream(dtype type, int test_size){
+    vector_t *vec1 = create_test_vector(test_size, type);
+    vector_t *vec2 = create_test_vector(test_size, type);
+    assert(vec1 && vec2);
+    fill_test_vector(vec1);
+    fill_test_vector(vec2);
+
+    static vector_stream_t stream;
+    uint32_t stats = VECTOR_STREAM_SUM | VECTOR_STREAM_MINMAX;
+    if (!is_unsigned(type)){ stats |= VECTOR_STREAM_DOTP;}
+    assert(vector_stream_begin(&stream, type, stats) == VECTOR_SUCCESS);
+    feed(&stream, vec1, vec2);
+    assert(vector_stream_finish(&stream) == VECTOR_SUCCESS);
+    assert(stream.count == (uint64_t)test_size);
+
+    switch (type){
+        case DTYPE_FLOAT32: {
+            float expected;
+            assert(vec_sum_f32(vec1, &expected) == VECTOR_SUCCESS);
+            assert(float_eq(expected, (float)stream.sum_f32));
+            assert(vec_dotp_f32(vec1, vec2, &expected) == VECTOR_SUCCESS);
+            assert(float_eq(expected, (float)stream.dotp_f32));
+            break;
+        }
+        case DTYPE_UINT8:
+        case DTYPE_UINT16:
+        case DTYPE_UINT32: {
+            int64_t expected = 0;
+            for (int i = 0; i < test_size; i++){                        // Exact, unlike vec_sum_unsigned
+                expected += element(vec1, i);
+            }
+            if (expected != stream.sum){
+                ESP_LOGE("vector_test_stream", "sum mismatch: %lld vs %lld", (long long)expected, (long long)stream.sum);
+            }
+            break;
+        }
+        default: {
+            int32_t expected;
+            if (type != DTYPE_INT32){                                   // int32 sums saturate per lane, so the split may differ on overflow
+                assert(vec_sum(vec1, &expected) == VECTOR_SUCCESS);
+                if (expected != stream.sum){
+                    ESP_LOGE("vector_test_stream", "sum mismatch: %d vs %lld", (int)expected, (long long)stream.sum);
+                }
+            }
+            assert(vec_dotp(vec1, vec2, &expected) == VECTOR_SUCCESS);
+            if (expected != (int32_t)(uint32_t)stream.dotp){
+                ESP_LOGE("vector_test_stream", "dotp mismatch: %d vs %lld", (int)expected, (long long)stream.dotp);
+            }
+            break;
+        }
+    }
+
+    if (type == DTYPE_FLOAT32){
+        const float *data = (const float*)vec1->data;
+        float lo = data[0], hi = lo;
+        for (int i = 1; i < test_size; i++){
+            if (data[i] < lo){ lo = data[i];}
+            if (data[i] > hi){ hi = data[i];}
+        }
+        if (lo != stream.min_f32 || hi != stream.max_f32){
+            ESP_LOGE("vector_test_stream", "min/max mismatch: %f/%f vs %f/%f", lo, hi, stream.min_f32, stream.max_f32);
+        }
+    } else {
+        int64_t lo = element(vec1, 0), hi = lo;
+        for (int i = 1; i < test_size; i++){
+            int64_t v = element(vec1, i);
+            if (v < lo){ lo = v;}
+            if (v > hi){ hi = v;}
+        }
+        if (lo != stream.min || hi != stream.max){
+            ESP_LOGE("vector_test_stream", "min/max mismatch: %lld/%lld vs %lld/%lld",
+                     (long long)lo, (long long)hi, (long long)stream.min, (long long)stream.max);
+        }
+    }
+
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+}
+
+// Streams of infinities: the min/max lanes must not clamp them to +-FLT_MAX
+static void check_infinities(void){
+    static vector_stream_t stream;
+    vector_t *vec = create_test_vector(5, DTYPE_FLOAT32);
+    assert(vec);
+    float *data = (float*)vec->data;
+
+    for (int sign = -1; sign <= 1; sign += 2){
+        for (int i = 0; i < 5; i++){
+            data[i] = sign * INFINITY;
+        }
+        assert(vector_stream_begin(&stream, DTYPE_FLOAT32, VECTOR_STREAM_MINMAX) == VECTOR_SUCCESS);
+        assert(vector_stream_update(&stream, vec, NULL) == VECTOR_SUCCESS);
+        assert(vector_stream_finish(&stream) == VECTOR_SUCCESS);
+        if (stream.min_f32 != data[0] || stream.max_f32 != data[0]){
+            ESP_LOGE("vector_test_stream", "min/max of infinities: %f/%f vs %f", stream.min_f32, stream.max_f32, data[0]);
+        }
+    }
+    vector_destroy(vec);
+}
+
+// One chunk whose unsigned sum leaves 32 bits; the stream sum must still be exact
+static void check_wide_unsigned(dtype type){
+    static vector_stream_t stream;
+    const size_t size = (type == DTYPE_UINT32) ? 35 : 70001;            // UINT16 spans two slices
+    vector_t *vec = create_test_vector(size, type);
+    assert(vec);
+    int64_t expected = 0;
+    for (size_t i = 0; i < size; i++){
+        switch (type){
+            case DTYPE_UINT8:  ((uint8_t*)vec->data)[i] = UINT8_MAX;         break;
+            case DTYPE_UINT16: ((uint16_t*)vec->data)[i] = UINT16_MAX;       break;
+            default:           ((uint32_t*)vec->data)[i] = UINT32_MAX - i;  break;
+        }
+        expected += element(vec, i);
+    }
+
+    assert(vector_stream_begin(&stream, type, VECTOR_STREAM_SUM) == VECTOR_SUCCESS);
+    assert(vector_stream_update(&stream, vec, NULL) == VECTOR_SUCCESS);
+    assert(vector_stream_finish(&stream) == VECTOR_SUCCESS);
+    if (expected != stream.sum){
+        ESP_LOGE("vector_test_stream", "wide unsigned sum mismatch: %lld vs %lld", (long long)expected, (long long)stream.sum);
+    }
+    vector_destroy(vec);
+}
+
+static void check_errors(dtype type){
+    static vector_stream_t stream;
+    vector_t *vec1 = create_test_vector(8, type);
+    vector_t *vec2 = create_test_vector(9, type);
+    assert(vec1 && vec2);
+    dtype other = (type == DTYPE_INT8) ? DTYPE_INT16 : DTYPE_INT8;
+
+    assert(vector_stream_begin(NULL, type, VECTOR_STREAM_SUM) == VECTOR_NULL);
+    assert(vector_stream_begin(&stream, type, 0) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_stream_begin(&stream, type, 1u << 7) == VECTOR_INVALID_ARGUMENT);
+    if (is_unsigned(type)){
+        assert(vector_stream_begin(&stream, type, VECTOR_STREAM_DOTP) == VECTOR_UNSUPPORTED_OPERATION);
+        assert(vector_stream_begin(&stream, type, VECTOR_STREAM_SUM) == VECTOR_SUCCESS);
+        assert(vector_stream_update(&stream, vec1, NULL) == VECTOR_SUCCESS);   // b is ignored without DOTP
+    } else {
+        assert(vector_stream_begin(&stream, type, VECTOR_STREAM_DOTP) == VECTOR_SUCCESS);
+        assert(vector_stream_update(&stream, vec1, NULL) == VECTOR_NULL);
+        assert(vector_stream_update(&stream, vec1, vec2) == VECTOR_SIZE_MISMATCH);
+    }
+    assert(vector_stream_begin(&stream, other, VECTOR_STREAM_SUM) == VECTOR_SUCCESS);
+    assert(vector_stream_update(&stream, vec1, vec1) == VECTOR_TYPE_MISMATCH);
+    assert(vector_stream_finish(&stream) == VECTOR_SUCCESS);
+    assert(stream.count == 0);
+
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+}
+
+void vector_test_stream(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_STREAM_SIZE;                  // Random stream lengths
+        check_stream(type, test_size);
+    }
+    if (type == DTYPE_FLOAT32){ check_infinities();}
+    if (is_unsigned(type)){ check_wide_unsigned(type);}
+    check_errors(type);
+}
@@ -57,7 +57,8 @@ float rand_float_val(){
 
 void fill_test_vector(vector_t *vec){
     switch (vec->type){
-        case (DTYPE_INT8): {
+        case (DTYPE_INT8):                                    // Same bit pattern as the unsigned type
+        case (DTYPE_UINT8): {
             int8_t* data = vec->data;
             for (int i = 0; i < vec->size; i++){
                 uint8_t u = (uint8_t)rand();
@@ -65,7 +66,8 @@ void fill_test_vector(vector_t *vec){
             }
             break;
         }
-        case (DTYPE_INT16): {
+        case (DTYPE_INT16):                                    // Same bit pattern as the unsigned type
+        case (DTYPE_UINT16): {
             int16_t* data = vec->data;
             for (int i = 0; i < vec->size; i++){ 
                 uint16_t u = (uint16_t)rand();
@@ -73,7 +75,8 @@ void fill_test_vector(vector_t *vec){
             }
             break;
         }
-        case (DTYPE_INT32): {
+        case (DTYPE_INT32):                                    // Same bit pattern as the unsigned type
+        case (DTYPE_UINT32): {
             int32_t* data = vec->data;
             for (int i = 0; i < vec->size; i++){
                 int32_t val = (rand() << 16) ^ rand();
@@ -208,6 +211,48 @@ bool vector_assert_eq(vector_t *vec1, vector_t *vec2){
             } 
             break;
         }
+        case (DTYPE_UINT8): {
+            uint8_t *vec1_data = (uint8_t*)(vec1->data);
+            uint8_t *vec2_data = (uint8_t*)(vec2->data);
+            for (int i = 0; i < vec1->size; i++)
+            {
+                uint8_t val1 = vec1_data[i]; 
+                uint8_t val2 = vec2_data[i];
+                if (val1 != val2){
+                    ESP_LOGE("vector_assert_eq", "Mismatch found at %d, vec1: %u, vec2 %u", i, (unsigned)val1, (unsigned)val2);
+                    equals_flag = false;
+                }
+            } 
+            break;
+        }
+        case (DTYPE_UINT16): {
+            uint16_t *vec1_data = (uint16_t*)(vec1->data);
+            uint16_t *vec2_data = (uint16_t*)(vec2->data);
+            for (int i = 0; i < vec1->size; i++)
+            {
+                uint16_t val1 = vec1_data[i]; 
+                uint16_t val2 = vec2_data[i];
+                if (val1 != val2){
+                    ESP_LOGE("vector_assert_eq", "Mismatch found at %d, vec1: %u, vec2 %u", i, (unsigned)val1, (unsigned)val2);
+                    equals_flag = false;
+                }
+            } 
+            break;
+        }
+        case (DTYPE_UINT32): {
+            uint32_t *vec1_data = (uint32_t*)(vec1->data);
+            uint32_t *vec2_data = (uint32_t*)(vec2->data);
+            for (int i = 0; i < vec1->size; i++)
+            {
+                uint32_t val1 = vec1_data[i]; 
+                uint32_t val2 = vec2_data[i];
+                if (val1 != val2){
+                    ESP_LOGE("vector_assert_eq", "Mismatch found at %d, vec1: %lu, vec2 %lu", i, (unsigned long)val1, (unsigned long)val2);
+                    equals_flag = false;
+                }
+            } 
+            break;
+        }
         default:
             break;
     }
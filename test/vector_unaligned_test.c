@@ -0,0 +1,206 @@
+#include "vector.h"
+#include "vector_basic_functions.h"
+#include "vector_bitwise_functions.h"
+#include "vector_test_helper.h"
+#include "vector_unaligned_test.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_UNALIGNED_SIZE (4 * MAX_SIZE)                               // Spans several realignment tiles
+
+// Random element-aligned offset into a 16-byte block
+static size_t rand_offset(size_t elem){
+    return (rand() % (16 / elem)) * elem;
+}
+
+// View of buf at byte offset, holding a copy of src's elements
+static void wrap_copy(vector_t *view, uint8_t *buf, size_t offset, const vector_t *src){
+    assert(vector_set_unaligned(view, buf + offset, src->size, src->type) == VECTOR_SUCCESS);
+    memcpy(view->data, src->data, src->size * sizeof_dtype(src->type));
+}
+
+// Element-wise results on unaligned views must match the same ops on aligned vectors
+static void check_elementwise(dtype type, int test_size){
+    const size_t elem = sizeof_dtype(type);
+    const size_t bytes = test_size * elem;
+    const unsigned int shift = (type == DTYPE_FLOAT32) ? 0 : 2 * elem;
+    vector_t *vec1 = create_test_vector(test_size, type);
+    vector_t *vec2 = create_test_vector(test_size, type);
+    vector_t *expected = create_test_vector(test_size, type);
+    vector_t *actual = create_test_vector(test_size, type);
+    uint8_t *buf1 = heap_caps_aligned_alloc(16, bytes + 16, MALLOC_CAP_DEFAULT);
+    uint8_t *buf2 = heap_caps_aligned_alloc(16, bytes + 16, MALLOC_CAP_DEFAULT);
+    uint8_t *buf3 = heap_caps_aligned_alloc(16, bytes + 16, MALLOC_CAP_DEFAULT);
+    assert(vec1 && vec2 && expected && actual && buf1 && buf2 && buf3);
+    fill_test_vector(vec1);
+    fill_test_vector(vec2);
+
+    vector_t u1, u2, ur;
+    wrap_copy(&u1, buf1, rand_offset(elem), vec1);
+    wrap_copy(&u2, buf2, rand_offset(elem), vec2);
+    assert(vector_set_unaligned(&ur, buf3 + rand_offset(elem), test_size, type) == VECTOR_SUCCESS);
+
+    assert(vec_add(vec1, vec2, expected) == VECTOR_SUCCESS);
+    assert(vec_add(&u1, &u2, &ur) == VECTOR_SUCCESS);
+    memcpy(actual->data, ur.data, bytes);
+    vector_assert_eq(actual, expected);
+
+    assert(vec_mul(vec1, vec2, expected, shift) == VECTOR_SUCCESS);
+    assert(vec_mul(&u1, &u2, &ur, shift) == VECTOR_SUCCESS);
+    memcpy(actual->data, ur.data, bytes);
+    vector_assert_eq(actual, expected);
+
+    assert(vec_xor(vec1, vec2, expected) == VECTOR_SUCCESS);
+    assert(vec_xor(&u1, &u2, &ur) == VECTOR_SUCCESS);
+    if (memcmp(ur.data, expected->data, bytes) != 0){                  // Bitwise, FLOAT32 results may be NaN
+        ESP_LOGE("vector_test_unaligned", "vec_xor mismatch");
+    }
+
+    assert(vec_not(vec1, expected) == VECTOR_SUCCESS);
+    assert(vec_not(&u1, &ur) == VECTOR_SUCCESS);
+    if (memcmp(ur.data, expected->data, bytes) != 0){
+        ESP_LOGE("vector_test_unaligned", "vec_not mismatch");
+    }
+
+    assert(vec_sub(vec1, vec2, expected) == VECTOR_SUCCESS);           // In place on a shared misalignment
+    assert(vec_sub(&u1, &u2, &u1) == VECTOR_SUCCESS);
+    memcpy(actual->data, u1.data, bytes);
+    vector_assert_eq(actual, expected);
+
+    wrap_copy(&u2, buf2, (size_t)((uint8_t*)u1.data - buf1), vec2);   // Same offset for every operand
+    assert(vec_copy(&u2, &u1) == VECTOR_SUCCESS);
+    memcpy(actual->data, u1.data, bytes);
+    vector_assert_eq(actual, vec2);
+
+    vector_check_canary(vec1);
+    vector_check_canary(vec2);
+    vector_check_canary(expected);
+    vector_check_canary(actual);
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+    vector_destroy(expected);
+    vector_destroy(actual);
+    heap_caps_free(buf1);
+    heap_caps_free(buf2);
+    heap_caps_free(buf3);
+}
+
+// Reductions on unaligned views must match the aligned results
+static void check_reductions(dtype type, int test_size){
+    const size_t elem = sizeof_dtype(type);
+    const size_t bytes = test_size * elem;
+    vector_t *vec1 = create_test_vector(test_size, type);
+    vector_t *vec2 = create_test_vector(test_size, type);
+    uint8_t *buf1 = heap_caps_aligned_alloc(16, bytes + 16, MALLOC_CAP_DEFAULT);
+    uint8_t *buf2 = heap_caps_aligned_alloc(16, bytes + 16, MALLOC_CAP_DEFAULT);
+    assert(vec1 && vec2 && buf1 && buf2);
+    fill_test_vector(vec1);
+    fill_test_vector(vec2);
+
+    vector_t u1, u2;
+    wrap_copy(&u1, buf1, rand_offset(elem), vec1);
+    wrap_copy(&u2, buf2, rand_offset(elem), vec2);
+
+    switch (type){
+        case DTYPE_FLOAT32: {
+            float expected, actual;
+            assert(vec_sum_f32(vec1, &expected) == VECTOR_SUCCESS);
+            assert(vec_sum_f32(&u1, &actual) == VECTOR_SUCCESS);
+            assert(float_eq(expected, actual));
+            assert(vec_dotp_f32(vec1, vec2, &expected) == VECTOR_SUCCESS);
+            assert(vec_dotp_f32(&u1, &u2, &actual) == VECTOR_SUCCESS);
+            assert(float_eq(expected, actual));
+            break;
+        }
+        case DTYPE_UINT8:
+        case DTYPE_UINT16:
+        case DTYPE_UINT32: {
+            uint32_t expected, actual;
+            assert(vec_sum_unsigned(vec1, &expected) == VECTOR_SUCCESS);
+            assert(vec_sum_unsigned(&u1, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_unaligned", "vec_sum_unsigned mismatch: %u vs %u", (unsigned)expected, (unsigned)actual);
+            }
+            break;
+        }
+        default: {
+            int32_t expected, actual;
+            assert(vec_sum(vec1, &expected) == VECTOR_SUCCESS);
+            assert(vec_sum(&u1, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_unaligned", "vec_sum mismatch: %d vs %d", (int)expected, (int)actual);
+            }
+            assert(vec_dotp(vec1, vec2, &expected) == VECTOR_SUCCESS);
+            assert(vec_dotp(&u1, &u2, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_unaligned", "vec_dotp mismatch: %d vs %d", (int)expected, (int)actual);
+            }
+            int64_t expected_wide, actual_wide;
+            assert(vec_dotp_i64(vec1, vec2, &expected_wide) == VECTOR_SUCCESS);
+            assert(vec_dotp_i64(&u1, &u2, &actual_wide) == VECTOR_SUCCESS);
+            if (expected_wide != actual_wide){
+                ESP_LOGE("vector_test_unaligned", "vec_dotp_i64 mismatch: %lld vs %lld", (long long)expected_wide, (long long)actual_wide);
+            }
+            assert(vec_sum_i64(vec1, &expected_wide) == VECTOR_SUCCESS);
+            assert(vec_sum_i64(&u1, &actual_wide) == VECTOR_SUCCESS);
+            if (expected_wide != actual_wide){
+                ESP_LOGE("vector_test_unaligned", "vec_sum_i64 mismatch: %lld vs %lld", (long long)expected_wide, (long long)actual_wide);
+            }
+            break;
+        }
+    }
+
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+    heap_caps_free(buf1);
+    heap_caps_free(buf2);
+}
+
+// int32 sums saturate per lane, so an unaligned sum must keep the lanes of the aligned one
+static void check_saturating_sum(int test_size){
+    const size_t bytes = test_size * sizeof(int32_t);
+    vector_t *vec = create_test_vector(test_size, DTYPE_INT32);
+    uint8_t *buf = heap_caps_aligned_alloc(16, bytes + 16, MALLOC_CAP_DEFAULT);
+    assert(vec && buf);
+    int32_t *data = (int32_t*)vec->data;
+    for (int i = 0; i < test_size; i++){
+        data[i] = (i % 3) ? INT32_MAX : INT32_MIN + 1;                  // Lanes saturate both ways
+    }
+
+    for (size_t offset = sizeof(int32_t); offset < 16; offset += sizeof(int32_t)){
+        vector_t u;
+        wrap_copy(&u, buf, offset, vec);
+        int32_t expected, actual;
+        assert(vec_sum(vec, &expected) == VECTOR_SUCCESS);
+        assert(vec_sum(&u, &actual) == VECTOR_SUCCESS);
+        if (expected != actual){
+            ESP_LOGE("vector_test_unaligned", "saturating vec_sum mismatch at offset %u: %d vs %d", (unsigned)offset, (int)expected, (int)actual);
+        }
+    }
+
+    vector_destroy(vec);
+    heap_caps_free(buf);
+}
+
+void vector_test_unaligned(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        int test_size = 1 + rand() % MAX_UNALIGNED_SIZE;               // Random vector sizes
+        check_elementwise(type, test_size);
+        check_reductions(type, test_size);
+        if (type == DTYPE_INT32){ check_saturating_sum(test_size);}
+    }
+
+    vector_t view;
+    alignas(16) static uint8_t buf[32];
+    if (sizeof_dtype(type) > 1){                                        // Elements must still be naturally aligned
+        assert(vector_set_unaligned(&view, buf + 1, 4, type) == VECTOR_UNALIGNED_DATA);
+    }
+    assert(vector_set_unaligned(&view, buf + sizeof_dtype(type), 4, type) == VECTOR_SUCCESS);
+    assert(!view.owns_data);
+    assert(vector_ok(&view) == VECTOR_UNALIGNED_DATA);
+}
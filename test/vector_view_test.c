@@ -0,0 +1,233 @@
+#include "vector.h"
+#include "vector_basic_functions.h"
+#include "vector_view.h"
+#include "vector_test_helper.h"
+#include "vector_view_test.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CHANNELS 5                                                  // Covers the fixed strides 2-4 and the generic path
+
+// Dense copy of channel c of an interleaved vector, built without the view functions
+static vector_t *reference_channel(const vector_t *vec, size_t channels, size_t c){
+    const size_t elem = sizeof_dtype(vec->type);
+    const size_t frames = vec->size / channels;
+    vector_t *ref = create_test_vector(frames, vec->type);
+    assert(ref);
+    for (size_t i = 0; i < frames; i++){
+        memcpy((uint8_t*)ref->data + i * elem, (const uint8_t*)vec->data + (i * channels + c) * elem, elem);
+    }
+    return ref;
+}
+
+static void check_view_eq(const vector_view_t *view, vector_t *expected){
+    vector_t *actual = create_test_vector(view->size, view->type);
+    assert(actual);
+    assert(vec_view_gather(view, actual) == VECTOR_SUCCESS);
+    vector_assert_eq(actual, expected);
+    vector_check_canary(actual);
+    vector_destroy(actual);
+}
+
+// Reductions over channel 0 and 1 views must match the same reductions on dense copies
+static void check_reductions(const vector_view_t *v0, const vector_view_t *v1, const vector_t *r0, const vector_t *r1){
+    switch (v0->type){
+        case DTYPE_FLOAT32: {
+            float expected, actual;
+            assert(vec_sum_f32(r0, &expected) == VECTOR_SUCCESS);
+            assert(vec_view_sum_f32(v0, &actual) == VECTOR_SUCCESS);
+            assert(float_eq(expected, actual));
+            assert(vec_dotp_f32(r0, r1, &expected) == VECTOR_SUCCESS);
+            assert(vec_view_dotp_f32(v0, v1, &actual) == VECTOR_SUCCESS);
+            assert(float_eq(expected, actual));
+            break;
+        }
+        case DTYPE_UINT8:
+        case DTYPE_UINT16:
+        case DTYPE_UINT32: {
+            uint32_t expected, actual;
+            assert(vec_sum_unsigned(r0, &expected) == VECTOR_SUCCESS);
+            assert(vec_view_sum_unsigned(v0, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_view", "vec_view_sum_unsigned mismatch: %u vs %u", (unsigned)expected, (unsigned)actual);
+            }
+            break;
+        }
+        default: {
+            int32_t expected, actual;
+            assert(vec_sum(r0, &expected) == VECTOR_SUCCESS);
+            assert(vec_view_sum(v0, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_view", "vec_view_sum mismatch: %d vs %d", (int)expected, (int)actual);
+            }
+            assert(vec_dotp(r0, r1, &expected) == VECTOR_SUCCESS);
+            assert(vec_view_dotp(v0, v1, &actual) == VECTOR_SUCCESS);
+            if (expected != actual){
+                ESP_LOGE("vector_test_view", "vec_view_dotp mismatch: %d vs %d", (int)expected, (int)actual);
+            }
+            break;
+        }
+    }
+}
+
+// Per-channel ops on interleaved data must match the same ops on dense copies of the channels
+static void check_channels(dtype type, size_t channels, size_t frames){
+    const unsigned int shift = (type == DTYPE_FLOAT32) ? 0 : 2 * sizeof_dtype(type);
+    vector_t *vec = create_test_vector(frames * channels, type);
+    assert(vec);
+    fill_test_vector(vec);
+
+    vector_view_t views[MAX_CHANNELS];
+    vector_t *refs[MAX_CHANNELS];
+    assert(vector_view_deinterleave(vec, channels, views) == VECTOR_SUCCESS);
+    for (size_t c = 0; c < channels; c++){
+        refs[c] = reference_channel(vec, channels, c);
+        assert(views[c].size == frames && views[c].stride == channels);
+        check_view_eq(&views[c], refs[c]);
+    }
+
+    const size_t c1 = channels > 1 ? 1 : 0;                         // Single-channel views alias every operand
+    const size_t last = channels - 1;
+    check_reductions(&views[0], &views[c1], refs[0], refs[c1]);
+
+    vector_t *expected = create_test_vector(frames, type);
+    assert(expected);
+    assert(vec_mul(refs[0], refs[c1], expected, shift) == VECTOR_SUCCESS);
+    assert(vec_view_binary(VECTOR_OP_MUL, &views[0], &views[c1], &views[last], shift) == VECTOR_SUCCESS);
+    check_view_eq(&views[last], expected);
+    assert(vec_copy(expected, refs[last]) == VECTOR_SUCCESS);
+
+    assert(vec_add(refs[0], refs[0], expected) == VECTOR_SUCCESS);  // In place on one channel
+    assert(vec_view_binary(VECTOR_OP_ADD, &views[0], &views[0], &views[0], 0) == VECTOR_SUCCESS);
+    check_view_eq(&views[0], expected);
+    assert(vec_copy(expected, refs[0]) == VECTOR_SUCCESS);
+
+    assert(vec_abs(refs[c1], expected) == VECTOR_SUCCESS);
+    assert(vec_view_unary(VECTOR_OP_ABS, &views[c1], &views[c1]) == VECTOR_SUCCESS);
+    check_view_eq(&views[c1], expected);
+    assert(vec_copy(expected, refs[c1]) == VECTOR_SUCCESS);
+
+    fill_test_vector(expected);                                     // Re-interleaving leaves the other channels alone
+    assert(vec_view_scatter(expected, &views[0]) == VECTOR_SUCCESS);
+    check_view_eq(&views[0], expected);
+    for (size_t c = 1; c < channels; c++){
+        check_view_eq(&views[c], refs[c]);
+    }
+
+    for (size_t c = 0; c < channels; c++){
+        vector_check_canary(refs[c]);
+        vector_destroy(refs[c]);
+    }
+    vector_check_canary(vec);
+    vector_check_canary(expected);
+    vector_destroy(vec);
+    vector_destroy(expected);
+}
+
+// int32 sums saturate per lane, so a strided sum must keep the lanes of the dense one across tiles
+static void check_saturating_sum(size_t channels, size_t frames){
+    vector_t *vec = create_test_vector(frames * channels, DTYPE_INT32);
+    assert(vec);
+    int32_t *data = (int32_t*)vec->data;
+    for (size_t i = 0; i < vec->size; i++){
+        data[i] = (i % 3) ? INT32_MAX : INT32_MIN + 1;                  // Lanes saturate both ways
+    }
+
+    vector_view_t views[MAX_CHANNELS];
+    assert(vector_view_deinterleave(vec, channels, views) == VECTOR_SUCCESS);
+    for (size_t c = 0; c < channels; c++){
+        vector_t *ref = reference_channel(vec, channels, c);
+        int32_t expected, actual;
+        assert(vec_sum(ref, &expected) == VECTOR_SUCCESS);
+        assert(vec_view_sum(&views[c], &actual) == VECTOR_SUCCESS);
+        if (expected != actual){
+            ESP_LOGE("vector_test_view", "saturating vec_view_sum mismatch: %d vs %d", (int)expected, (int)actual);
+        }
+        vector_destroy(ref);
+    }
+    vector_destroy(vec);
+}
+
+// A stride-1 slice at an odd offset runs on the unaligned path
+static void check_slice(dtype type, size_t test_size){
+    vector_t *vec1 = create_test_vector(test_size + 1, type);
+    vector_t *vec2 = create_test_vector(test_size + 1, type);
+    vector_t *r1 = create_test_vector(test_size, type);
+    vector_t *r2 = create_test_vector(test_size, type);
+    vector_t *expected = create_test_vector(test_size, type);
+    assert(vec1 && vec2 && r1 && r2 && expected);
+    fill_test_vector(vec1);
+    fill_test_vector(vec2);
+
+    vector_view_t s1, s2;
+    vector_t as_vec;
+    assert(vector_view(vec1, 1, test_size, 1, &s1) == VECTOR_SUCCESS);
+    assert(vector_view(vec2, 1, test_size, 1, &s2) == VECTOR_SUCCESS);
+    assert(vec_view_gather(&s1, r1) == VECTOR_SUCCESS);
+    assert(vec_view_gather(&s2, r2) == VECTOR_SUCCESS);
+    assert(vector_view_as_vector(&s1, &as_vec) == VECTOR_SUCCESS);
+    assert(as_vec.data == s1.data && as_vec.size == test_size && !as_vec.owns_data);
+
+    assert(vec_sub(r1, r2, expected) == VECTOR_SUCCESS);
+    assert(vec_view_binary(VECTOR_OP_SUB, &s1, &s2, &s2, 0) == VECTOR_SUCCESS);
+    check_view_eq(&s2, expected);
+    check_reductions(&s1, &s2, r1, expected);
+
+    vector_check_canary(vec1);
+    vector_check_canary(vec2);
+    vector_destroy(vec1);
+    vector_destroy(vec2);
+    vector_destroy(r1);
+    vector_destroy(r2);
+    vector_destroy(expected);
+}
+
+static void check_errors(dtype type){
+    vector_t *vec = create_test_vector(12, type);
+    vector_t *dense = create_test_vector(5, type);
+    assert(vec && dense);
+    vector_view_t view, other;
+
+    assert(vector_view(vec, 0, 12, 1, &view) == VECTOR_SUCCESS);
+    assert(vector_view(vec, 11, 1, 7, &view) == VECTOR_SUCCESS);
+    assert(vector_view(vec, 2, 4, 3, &view) == VECTOR_SUCCESS);     // Elements 2, 5, 8, 11
+    assert(vector_view(vec, 2, 5, 3, &view) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_view(vec, 12, 1, 1, &view) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_view(vec, 0, 0, 1, &view) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_view(vec, 0, 1, 0, &view) == VECTOR_INVALID_ARGUMENT);
+    assert(vector_view(NULL, 0, 1, 1, &view) == VECTOR_NULL);
+    vector_view_t views[MAX_CHANNELS];
+    assert(vector_view_deinterleave(vec, 5, views) == VECTOR_SIZE_MISMATCH);
+    assert(vector_view_deinterleave(vec, 0, views) == VECTOR_INVALID_ARGUMENT);
+
+    assert(vector_view(vec, 0, 4, 3, &view) == VECTOR_SUCCESS);
+    assert(vector_view(vec, 1, 5, 2, &other) == VECTOR_SUCCESS);
+    assert(vector_view_as_vector(&view, dense) == VECTOR_INVALID_ARGUMENT);
+    assert(vec_view_gather(&view, dense) == VECTOR_SIZE_MISMATCH);
+    assert(vec_view_binary(VECTOR_OP_ADD, &view, &other, &view, 0) == VECTOR_SIZE_MISMATCH);
+    assert(vec_view_gather(&other, dense) == VECTOR_SUCCESS);
+    if (type != DTYPE_FLOAT32){
+        assert(vec_view_binary(VECTOR_OP_ADD, &view, &view, &view, 1) == VECTOR_INVALID_ARGUMENT);
+    }
+    view.stride = 0;
+    assert(vec_view_unary(VECTOR_OP_COPY, &view, &view) == VECTOR_INVALID_ARGUMENT);
+
+    vector_destroy(vec);
+    vector_destroy(dense);
+}
+
+void vector_test_view(bool verbose, dtype type){
+    (void)verbose;
+    set_rand_seed();
+
+    for (int run_num = 0; run_num < TEST_RUNS; run_num++){
+        size_t frames = 1 + rand() % (2 * MAX_SIZE);                    // Spans more than one scratch tile
+        size_t channels = 1 + rand() % MAX_CHANNELS;
+        check_channels(type, channels, frames);
+        check_slice(type, frames);
+        if (type == DTYPE_INT32){ check_saturating_sum(channels, frames);}
+    }
+    if (type == DTYPE_INT32){ check_saturating_sum(3, 3 * VECTOR_VIEW_TILE + 5);}   // Several tiles, partial last block
+    check_errors(type);
+}